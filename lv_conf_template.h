@@ -83,6 +83,14 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** 1: Allocate the small, frequently created and deleted objects (e.g. draw tasks, event descriptors)
+ *  from slabs of fixed size blocks instead of `lv_malloc()`. It reduces the allocation overhead and fragmentation. */
+#define LV_USE_MEM_SLAB 0
+#if LV_USE_MEM_SLAB
+    /** Size of the chunks which are allocated with `lv_malloc()` to hold the blocks of a size class */
+    #define LV_MEM_SLAB_CHUNK_SIZE (4 * 1024U)    /**< [bytes] */
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -154,6 +162,21 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/** Size of the frame arena. The draw tasks and the temporary draw buffers created while refreshing
+ *  a display are allocated from it and it's reset at once when the refresh is ready.
+ *  If it gets full `lv_malloc()` is used. See `lv_draw_arena_get_stat()` to size it.
+ *  0: don't use a frame arena. */
+#define LV_DRAW_ARENA_SIZE 0  /**< [bytes]*/
+
+/** Skip drawing the widgets which are fully hidden by opaque widgets drawn after them.
+ *  Before drawing an area the largest this many opaque widgets are collected. 0: disable */
+#define LV_REFR_OCCLUDER_MAX 0
+
+#if LV_REFR_OCCLUDER_MAX
+    /** Smaller opaque widgets are not worth testing against [px]*/
+    #define LV_REFR_OCCLUDER_MIN_SIZE 1024
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -197,6 +220,11 @@
      *  - > 1 means multiple threads will render the screen in parallel. */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /** Number of slots in the queue of the draw tasks which are ready to be rendered.
+     *  The draw threads take the tasks from this queue. Used only with `LV_USE_OS`.
+     *  Must be a power of 2 and at least 2. */
+    #define LV_DRAW_SW_TASK_QUEUE_SIZE  16
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -214,6 +242,11 @@
          *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
         #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 
+        /** Number of shadow corners of the maximal size to cache.
+         *  The cache uses at most `LV_DRAW_SW_SHADOW_CACHE_SIZE^2 * LV_DRAW_SW_SHADOW_CACHE_CNT` bytes,
+         *  so more corners fit in it if they are smaller. The least recently used corners are dropped first. */
+        #define LV_DRAW_SW_SHADOW_CACHE_CNT 1
+
         /** Set number of maximally-cached circle data.
          *  The circumference of 1/4 circle are saved for anti-aliasing.
          *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
@@ -230,6 +263,13 @@
     /** Enable drawing complex gradients in software: linear at an angle, radial or conical */
     #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    0
 
+    /** Size of the gradient color map cache in bytes.
+     *  The color and opacity maps of the horizontal and vertical gradients and the 256 element
+     *  tables of the complex gradients are saved and reused while the stops and the size are the same.
+     *  A map of `size` entries uses about `size * 4` bytes.
+     *  - 0: disables caching */
+    #define LV_DRAW_SW_GRADIENT_CACHE_SIZE      0
+
 #endif
 
 /*Use TSi's aka (Think Silicon) NemaGFX */
@@ -568,6 +608,34 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Number of entries in the cache of resolved style values. An entry stores the resolved values of the
+ *  built-in style properties for a part of a widget in a given state so that getting them is an array read.
+ *  An entry needs about `LV_STYLE_NUM_BUILT_IN_PROPS * (sizeof(lv_style_value_t) + 1/8) + 32` bytes.
+ *  0: disable the cache */
+#define LV_OBJ_STYLE_RESOLVED_CACHE_CNT     0
+
+/** Number of style slots stored in each `lv_obj_t`. Widgets having at most this many styles
+ *  (including their local and transition styles) don't allocate a separate array for them.
+ *  A slot needs 8 bytes on 32-bit and 16 bytes on 64-bit systems. */
+#define LV_OBJ_STYLE_INLINE_CNT     0
+
+/** Allocate the special attributes and the local styles of the widgets from pools in chunks of
+ *  this many blocks instead of one by one to reduce the heap fragmentation.
+ *  The chunks of a pool are freed when all of its blocks are free.
+ *  0: allocate them one by one */
+#define LV_OBJ_ATTR_POOL_BLOCK_CNT  0
+
+/** Count the created and existing widgets of each class. See `lv_obj_class_get_alloc_stat()` */
+#define LV_OBJ_CLASS_ALLOC_STAT     0
+
+/** Count how many times the events were sent to the widgets. See `lv_obj_get_event_dispatch_stat()` */
+#define LV_OBJ_EVENT_DISPATCH_STAT  0
+
+/** Keep the properties of the styles sorted by ID and add a 256 bit property bitmap to each `lv_style_t`
+ *  so a property can be found without searching the whole style.
+ *  Constant styles created with `LV_STYLE_CONST_INIT_SORTED` are binary searched. */
+#define LV_STYLE_PROP_INDEX     0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -1194,6 +1262,18 @@
     #define LV_PROFILER_EVENT 1
 #endif
 
+/** 1: Enable the render timeline profiler.
+ *  Records frames, draw tasks, layer allocations and flush waits into per-thread ring buffers
+ *  which can be exported as Chrome trace JSON. */
+#define LV_USE_PROFILER_TIMELINE 0
+#if LV_USE_PROFILER_TIMELINE
+    /** Number of events stored per thread. The oldest events are overwritten. */
+    #define LV_PROFILER_TIMELINE_EVENT_CNT 1024
+
+    /** Max number of threads which can record events */
+    #define LV_PROFILER_TIMELINE_THREAD_CNT 8
+#endif
+
 /** 1: Enable Monkey test */
 #define LV_USE_MONKEY 0
 
@@ -1362,6 +1442,10 @@
      * The GBM library aims to provide a platform independent memory management system
      * it supports the major GPU vendors - This option requires linking with libgbm */
     #define LV_USE_LINUX_DRM_GBM_BUFFERS 0
+
+    /** Number of frame buffers: 2 or 3.
+     *  With 3 buffers LVGL can render the next frame while the previous one is waiting for the page flip. */
+    #define LV_LINUX_DRM_BUFFER_CNT 2
 #endif
 
 /** Interface for TFT_eSPI */
@@ -21,6 +21,7 @@ extern "C" {
 #include "src/lv_init.h"
 
 #include "src/stdlib/lv_mem.h"
+#include "src/stdlib/lv_mem_slab.h"
 #include "src/stdlib/lv_string.h"
 #include "src/stdlib/lv_sprintf.h"
 
@@ -31,6 +32,7 @@ extern "C" {
 #include "src/misc/lv_async.h"
 #include "src/misc/lv_anim_timeline.h"
 #include "src/misc/lv_profiler_builtin.h"
+#include "src/misc/lv_profiler_timeline.h"
 #include "src/misc/lv_rb.h"
 #include "src/misc/lv_utils.h"
 #include "src/misc/lv_iter.h"
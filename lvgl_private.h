@@ -23,6 +23,7 @@ extern "C" {
 #include "src/misc/cache/lv_cache_private.h"
 #include "src/layouts/lv_layout_private.h"
 #include "src/stdlib/lv_mem_private.h"
+#include "src/stdlib/lv_mem_slab_private.h"
 #include "src/others/file_explorer/lv_file_explorer_private.h"
 #include "src/others/fragment/lv_fragment_private.h"
 #include "src/others/translation/lv_translation_private.h"
@@ -30,6 +31,7 @@ extern "C" {
 #include "src/libs/barcode/lv_barcode_private.h"
 #include "src/draw/lv_draw_triangle_private.h"
 #include "src/draw/lv_draw_private.h"
+#include "src/draw/lv_draw_arena_private.h"
 #include "src/draw/lv_draw_rect_private.h"
 #include "src/draw/lv_draw_image_private.h"
 #include "src/draw/lv_image_decoder_private.h"
@@ -62,6 +64,7 @@ extern "C" {
 #include "src/misc/lv_area_private.h"
 #include "src/misc/lv_fs_private.h"
 #include "src/misc/lv_profiler_builtin_private.h"
+#include "src/misc/lv_profiler_timeline_private.h"
 #include "src/misc/lv_event_private.h"
 #include "src/misc/lv_bidi_private.h"
 #include "src/misc/lv_rb_private.h"
@@ -92,6 +95,7 @@ extern "C" {
 #include "src/widgets/button/lv_button_private.h"
 #include "src/widgets/scale/lv_scale_private.h"
 #include "src/widgets/led/lv_led_private.h"
+#include "src/widgets/list/lv_list_private.h"
 #include "src/widgets/arc/lv_arc_private.h"
 #include "src/widgets/tileview/lv_tileview_private.h"
 #include "src/widgets/spinbox/lv_spinbox_private.h"
@@ -67,6 +67,7 @@ fout.write(
 #define LV_DRAW_SW_ASM_NEON             1
 #define LV_DRAW_SW_ASM_HELIUM           2
 #define LV_DRAW_SW_ASM_RISCV_V          3
+#define LV_DRAW_SW_ASM_X86              4
 #define LV_DRAW_SW_ASM_CUSTOM           255
 
 #define LV_NEMA_LIB_NONE            0
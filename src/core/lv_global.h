@@ -24,6 +24,7 @@ extern "C" {
 #include "../misc/lv_area.h"
 #include "../misc/lv_color_op.h"
 #include "../misc/lv_ll.h"
+#include "../misc/lv_array.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_style.h"
 #include "../misc/lv_timer.h"
@@ -40,6 +41,8 @@ extern "C" {
 
 #include "../misc/lv_types.h"
 
+#include "../core/lv_obj_class_private.h"
+#include "../core/lv_obj_event.h"
 #include "../misc/lv_timer_private.h"
 #include "../misc/lv_anim_private.h"
 #include "../tick/lv_tick_private.h"
@@ -48,6 +51,7 @@ extern "C" {
 #include "../draw/sw/lv_draw_sw_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../stdlib/builtin/lv_tlsf_private.h"
+#include "../stdlib/lv_mem_slab_private.h"
 #include "../debugging/sysmon/lv_sysmon_private.h"
 #include "../debugging/test/lv_test_private.h"
 #include "../layouts/lv_layout_private.h"
@@ -73,6 +77,10 @@ struct _lv_freetype_context_t;
 struct _lv_profiler_builtin_ctx_t;
 #endif
 
+#if LV_USE_PROFILER_TIMELINE
+struct _lv_profiler_timeline_ctx_t;
+#endif
+
 #if LV_USE_NUTTX
 struct _lv_nuttx_ctx_t;
 #endif
@@ -98,6 +106,20 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    lv_obj_style_resolved_t * style_resolved_cache;
+    uint32_t style_resolved_cache_hand;
+#endif
+#if LV_OBJ_ATTR_POOL_BLOCK_CNT
+    lv_mem_slab_t obj_attr_pools[LV_OBJ_ATTR_POOL_LAST];
+#endif
+#if LV_OBJ_CLASS_ALLOC_STAT
+    lv_array_t obj_class_alloc_stats;
+#endif
+#if LV_OBJ_EVENT_DISPATCH_STAT
+    lv_obj_event_dispatch_stat_t obj_event_dispatch_stat[LV_EVENT_LAST];
+#endif
+    uint32_t obj_draw_retained_cnt;     /**< Number of widgets with retained drawing enabled*/
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
@@ -110,7 +132,18 @@ typedef struct _lv_global_t {
     lv_layout_dsc_t * layout_list;
     bool layout_update_mutex;
 
+    bool inv_coalesce;                  /**< Invalidating the same area of the same widget again is skipped*/
+    const lv_obj_t * inv_coalesce_obj;  /**< The last widget invalidated while coalescing*/
+    lv_area_t inv_coalesce_area;        /**< The area of `inv_coalesce_obj` which is already invalidated*/
+
     uint32_t memory_zero;
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_t mem_slabs[LV_MEM_SLAB_CLASS_CNT];
+    uint32_t mem_slab_large_cnt;
+#if LV_USE_OS
+    lv_mutex_t mem_slab_mutex;
+#endif
+#endif
     uint32_t math_rand_seed;
 
     lv_event_t * event_header;
@@ -142,6 +175,9 @@ typedef struct _lv_global_t {
 #if LV_DRAW_SW_COMPLEX
     lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
 #endif
+#if defined(LV_DRAW_SW_GRADIENT_CACHE_SIZE) && LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    lv_cache_t * sw_grad_cache;
+#endif
 
 #if LV_USE_LOG
     lv_log_print_g_cb_t custom_log_print_cb;
@@ -219,6 +255,10 @@ typedef struct _lv_global_t {
     struct _lv_profiler_builtin_ctx_t * profiler_context;
 #endif
 
+#if LV_USE_PROFILER_TIMELINE
+    struct _lv_profiler_timeline_ctx_t * profiler_timeline_context;
+#endif
+
 
 #if LV_USE_FILE_EXPLORER
     lv_style_t file_explorer_quick_access_style;
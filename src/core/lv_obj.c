@@ -26,6 +26,7 @@
 #include "../misc/lv_anim_timeline.h"
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_string.h"
+#include "lv_global.h"
 #include "lv_obj_draw_private.h"
 
 /*********************
@@ -416,7 +417,7 @@ void lv_obj_allocate_spec_attr(lv_obj_t * obj)
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     if(obj->spec_attr == NULL) {
-        obj->spec_attr = lv_malloc_zeroed(sizeof(lv_obj_spec_attr_t));
+        obj->spec_attr = lv_obj_attr_malloc_zeroed(LV_OBJ_ATTR_POOL_SPEC_ATTR);
         LV_ASSERT_MALLOC(obj->spec_attr);
         if(obj->spec_attr == NULL) return;
 
@@ -609,6 +610,10 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    lv_obj_style_resolved_cache_drop(obj);
+#endif
+    if(LV_GLOBAL_DEFAULT()->inv_coalesce_obj == obj) lv_obj_invalidation_coalescing_reset();
 
     /*Remove the animations from this object*/
     lv_anim_delete(obj, NULL);
@@ -637,7 +642,9 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         }
 #endif
 
-        lv_free(obj->spec_attr);
+        lv_obj_free_draw_retained(obj);
+
+        lv_obj_attr_free(LV_OBJ_ATTR_POOL_SPEC_ATTR, obj->spec_attr);
         obj->spec_attr = NULL;
     }
 
@@ -1090,6 +1097,9 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
     /*Invalidate the object in their current state*/
     lv_obj_invalidate(obj);
 
+    /*The inherited styles of the children might change too*/
+    lv_obj_style_children_changed(obj);
+
     obj->state = new_state;
     lv_obj_update_layer_type(obj);
 
@@ -12,11 +12,15 @@
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../stdlib/lv_string.h"
+#include "../stdlib/lv_mem_slab_private.h"
+#include "lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_obj_class)
+#define attr_pools LV_GLOBAL_DEFAULT()->obj_attr_pools
+#define alloc_stats (&LV_GLOBAL_DEFAULT()->obj_class_alloc_stats)
 
 /**********************
  *      TYPEDEFS
@@ -31,10 +35,17 @@
  **********************/
 static void lv_obj_construct(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static uint32_t get_instance_size(const lv_obj_class_t * class_p);
+#if LV_OBJ_CLASS_ALLOC_STAT
+    static lv_obj_class_alloc_stat_t * alloc_stat_find(const lv_obj_class_t * class_p);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static const uint32_t attr_sizes[LV_OBJ_ATTR_POOL_LAST] = {
+    sizeof(lv_obj_spec_attr_t),
+    sizeof(lv_style_t),
+};
 
 /**********************
  *      MACROS
@@ -98,6 +109,25 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
         parent->spec_attr->children[parent->spec_attr->child_cnt - 1] = obj;
     }
 
+#if LV_OBJ_CLASS_ALLOC_STAT
+    lv_obj_class_alloc_stat_t * stat = alloc_stat_find(class_p);
+    if(stat == NULL) {
+        if(lv_array_capacity(alloc_stats) == 0) {
+            lv_array_init(alloc_stats, 16, sizeof(lv_obj_class_alloc_stat_t));
+        }
+        lv_obj_class_alloc_stat_t new_stat = {0};
+        new_stat.class_p = class_p;
+        new_stat.instance_size = s;
+        if(lv_array_push_back(alloc_stats, &new_stat) == LV_RESULT_OK) stat = lv_array_back(alloc_stats);
+    }
+
+    if(stat) {
+        stat->obj_cnt++;
+        stat->create_cnt++;
+        if(stat->obj_cnt > stat->obj_cnt_max) stat->obj_cnt_max = stat->obj_cnt;
+    }
+#endif
+
     return obj;
 }
 
@@ -177,6 +207,71 @@ bool lv_obj_is_group_def(lv_obj_t * obj)
     return class_p->group_def == LV_OBJ_CLASS_GROUP_DEF_TRUE;
 }
 
+void lv_obj_class_deinit(void)
+{
+#if LV_OBJ_ATTR_POOL_BLOCK_CNT
+    uint32_t i;
+    for(i = 0; i < LV_OBJ_ATTR_POOL_LAST; i++) {
+        lv_mem_slab_deinit(&attr_pools[i]);
+    }
+#endif
+
+#if LV_OBJ_CLASS_ALLOC_STAT
+    lv_array_deinit(alloc_stats);
+#endif
+}
+
+void * lv_obj_attr_malloc_zeroed(lv_obj_attr_pool_id_t id)
+{
+#if LV_OBJ_ATTR_POOL_BLOCK_CNT
+    lv_mem_slab_t * pool = &attr_pools[id];
+    if(pool->block_size == 0) lv_mem_slab_init(pool, attr_sizes[id], LV_OBJ_ATTR_POOL_BLOCK_CNT);
+
+    void * block = lv_mem_slab_alloc(pool);
+    if(block) lv_memzero(block, attr_sizes[id]);
+    return block;
+#else
+    return lv_malloc_zeroed(attr_sizes[id]);
+#endif
+}
+
+void lv_obj_attr_free(lv_obj_attr_pool_id_t id, void * p)
+{
+#if LV_OBJ_ATTR_POOL_BLOCK_CNT
+    lv_mem_slab_free(&attr_pools[id], p);
+#else
+    LV_UNUSED(id);
+    lv_free(p);
+#endif
+}
+
+void lv_obj_class_alloc_stat_remove(const lv_obj_class_t * class_p)
+{
+#if LV_OBJ_CLASS_ALLOC_STAT
+    lv_obj_class_alloc_stat_t * stat = alloc_stat_find(class_p);
+    if(stat && stat->obj_cnt > 0) stat->obj_cnt--;
+#else
+    LV_UNUSED(class_p);
+#endif
+}
+
+#if LV_OBJ_CLASS_ALLOC_STAT
+uint32_t lv_obj_class_get_alloc_stat_count(void)
+{
+    return lv_array_size(alloc_stats);
+}
+
+const lv_obj_class_alloc_stat_t * lv_obj_class_get_alloc_stat(uint32_t idx)
+{
+    return lv_array_at(alloc_stats, idx);
+}
+
+const lv_obj_class_alloc_stat_t * lv_obj_class_get_alloc_stat_by_class(const lv_obj_class_t * class_p)
+{
+    return alloc_stat_find(class_p);
+}
+#endif
+
 #if LV_USE_EXT_DATA
 void lv_obj_set_external_data(lv_obj_t * obj, void * data, void (* free_cb)(void * data))
 {
@@ -231,3 +326,17 @@ static uint32_t get_instance_size(const lv_obj_class_t * class_p)
 
     return base->instance_size;
 }
+
+#if LV_OBJ_CLASS_ALLOC_STAT
+static lv_obj_class_alloc_stat_t * alloc_stat_find(const lv_obj_class_t * class_p)
+{
+    uint32_t i;
+    uint32_t cnt = lv_array_size(alloc_stats);
+    for(i = 0; i < cnt; i++) {
+        lv_obj_class_alloc_stat_t * stat = lv_array_at(alloc_stats, i);
+        if(stat->class_p == class_p) return stat;
+    }
+
+    return NULL;
+}
+#endif
@@ -43,6 +43,16 @@ typedef enum {
 } lv_obj_class_theme_inheritable_t;
 
 typedef void (*lv_obj_class_event_cb_t)(lv_obj_class_t * class_p, lv_event_t * e);
+
+#if LV_OBJ_CLASS_ALLOC_STAT
+typedef struct {
+    const lv_obj_class_t * class_p;
+    uint32_t obj_cnt;           /**< Number of existing widgets of the class*/
+    uint32_t obj_cnt_max;       /**< Highest number of widgets of the class existing at the same time*/
+    uint32_t create_cnt;        /**< Number of widgets of the class created since `lv_init()`*/
+    uint32_t instance_size;     /**< Bytes allocated for a widget of the class*/
+} lv_obj_class_alloc_stat_t;
+#endif
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -78,6 +88,29 @@ bool lv_obj_is_group_def(lv_obj_t * obj);
 void lv_obj_set_external_data(lv_obj_t * obj, void * data, void (* free_cb)(void * data));
 #endif
 
+#if LV_OBJ_CLASS_ALLOC_STAT
+/**
+ * Get the number of classes having allocation statistics, i.e. the classes of which
+ * at least one widget was created.
+ * @return          the number of classes
+ */
+uint32_t lv_obj_class_get_alloc_stat_count(void);
+
+/**
+ * Get the allocation statistics of a class by index
+ * @param idx       index of the class from 0 to `lv_obj_class_get_alloc_stat_count() - 1`
+ * @return          pointer to the statistics or NULL if `idx` is out of range
+ */
+const lv_obj_class_alloc_stat_t * lv_obj_class_get_alloc_stat(uint32_t idx);
+
+/**
+ * Get the allocation statistics of a class
+ * @param class_p   pointer to a class, e.g. `&lv_button_class`
+ * @return          pointer to the statistics or NULL if no widget of the class was created yet
+ */
+const lv_obj_class_alloc_stat_t * lv_obj_class_get_alloc_stat_by_class(const lv_obj_class_t * class_p);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -60,6 +60,13 @@ struct _lv_obj_class_t {
     uint32_t theme_inheritable : 1;    /**< Value from ::lv_obj_class_theme_inheritable_t*/
 };
 
+/** The attributes of the widgets which are allocated from pools with `LV_OBJ_ATTR_POOL_BLOCK_CNT`*/
+typedef enum {
+    LV_OBJ_ATTR_POOL_SPEC_ATTR,     /**< `lv_obj_spec_attr_t`*/
+    LV_OBJ_ATTR_POOL_STYLE,         /**< `lv_style_t` of the local and transition styles*/
+    LV_OBJ_ATTR_POOL_LAST,
+} lv_obj_attr_pool_id_t;
+
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -67,6 +74,32 @@ struct _lv_obj_class_t {
 
 void lv_obj_destruct(lv_obj_t * obj);
 
+/**
+ * Free the resources of the widget allocations. Called in `lv_deinit()`.
+ */
+void lv_obj_class_deinit(void);
+
+/**
+ * Allocate a zeroed attribute of a widget. Use a pool if `LV_OBJ_ATTR_POOL_BLOCK_CNT > 0`.
+ * @param id        the type of the attribute
+ * @return          pointer to the allocated memory or NULL on error
+ */
+void * lv_obj_attr_malloc_zeroed(lv_obj_attr_pool_id_t id);
+
+/**
+ * Free an attribute allocated with `lv_obj_attr_malloc_zeroed()`
+ * @param id        the type of the attribute
+ * @param p         pointer to the attribute. Can be NULL.
+ */
+void lv_obj_attr_free(lv_obj_attr_pool_id_t id, void * p);
+
+/**
+ * Count a widget as deleted in the allocation statistics of its class.
+ * Does nothing if `LV_OBJ_CLASS_ALLOC_STAT` is disabled.
+ * @param class_p   the final class of the widget
+ */
+void lv_obj_class_alloc_stat_remove(const lv_obj_class_t * class_p);
+
 /**********************
  *      MACROS
  **********************/
@@ -12,6 +12,8 @@
 #include "../display/lv_display.h"
 #include "../indev/lv_indev.h"
 #include "../stdlib/lv_string.h"
+#include "../misc/lv_area_private.h"
+#include "lv_global.h"
 
 /*********************
  *      DEFINES
@@ -432,6 +434,111 @@ lv_layer_type_t lv_obj_get_layer_type(const lv_obj_t * obj)
     else return LV_LAYER_TYPE_NONE;
 }
 
+void lv_obj_set_draw_retained(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    if(en == false) {
+        lv_obj_free_draw_retained(obj);
+        return;
+    }
+
+    lv_obj_allocate_spec_attr(obj);
+    if(obj->spec_attr->draw_retained) return;
+
+    obj->spec_attr->draw_retained = lv_malloc_zeroed(sizeof(lv_obj_draw_retained_t));
+    LV_ASSERT_MALLOC(obj->spec_attr->draw_retained);
+    if(obj->spec_attr->draw_retained) LV_GLOBAL_DEFAULT()->obj_draw_retained_cnt++;
+}
+
+bool lv_obj_get_draw_retained(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    return obj->spec_attr && obj->spec_attr->draw_retained;
+}
+
+void lv_obj_draw_main(lv_layer_t * layer, lv_obj_t * obj, bool fully_visible)
+{
+    lv_obj_draw_retained_t * retained = obj->spec_attr ? obj->spec_attr->draw_retained : NULL;
+    if(retained == NULL) {
+        lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
+        lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
+        lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
+        return;
+    }
+
+    if(retained->valid &&
+       retained->state == obj->state &&
+       lv_area_is_equal(&retained->coords, &obj->coords) &&
+       lv_color32_eq(retained->recolor, layer->recolor) &&
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+       lv_memcmp(&retained->matrix, &layer->matrix, sizeof(lv_matrix_t)) == 0 &&
+#endif
+       retained->opa == layer->opa) {
+        lv_draw_record_replay(&retained->record, layer);
+        return;
+    }
+
+    lv_obj_reset_draw_retained(obj);
+
+    /*Record only if all the draw tasks are added and not modified in LV_EVENT_DRAW_TASK_ADDED.
+     *Besides widgets can draw other widgets, so be sure there is no other recording in progress.*/
+    bool record = fully_visible && !lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS) &&
+                  LV_GLOBAL_DEFAULT()->draw_info.record == NULL;
+    if(record) lv_draw_record_start(&retained->record, layer);
+
+    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
+    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
+    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
+
+    if(record == false) return;
+
+    /*If retained drawing was disabled in the events (e.g. the widget was deleted) the recording was stopped*/
+    if(LV_GLOBAL_DEFAULT()->draw_info.record != &retained->record) return;
+    lv_draw_record_stop(&retained->record);
+
+    if(retained->record.failed) {
+        lv_draw_record_reset(&retained->record);
+        return;
+    }
+
+    retained->valid = 1;
+    retained->coords = obj->coords;
+    retained->state = obj->state;
+    retained->recolor = layer->recolor;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    retained->matrix = layer->matrix;
+#endif
+    retained->opa = layer->opa;
+}
+
+void lv_obj_reset_draw_retained(const lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL) return;
+
+    lv_obj_draw_retained_t * retained = obj->spec_attr->draw_retained;
+    if(retained == NULL) return;
+
+    retained->valid = 0;
+
+    /*If it's being recorded now, just mark it as outdated*/
+    if(LV_GLOBAL_DEFAULT()->draw_info.record == &retained->record) retained->record.failed = 1;
+    else lv_draw_record_reset(&retained->record);
+}
+
+void lv_obj_free_draw_retained(lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->draw_retained == NULL) return;
+
+    lv_obj_draw_retained_t * retained = obj->spec_attr->draw_retained;
+    lv_draw_record_stop(&retained->record);
+    lv_draw_record_reset(&retained->record);
+    lv_free(retained);
+    obj->spec_attr->draw_retained = NULL;
+    LV_GLOBAL_DEFAULT()->obj_draw_retained_cnt--;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -131,6 +131,25 @@ int32_t lv_obj_calculate_ext_draw_size(lv_obj_t * obj, lv_part_t part);
  */
 void lv_obj_refresh_ext_draw_size(lv_obj_t * obj);
 
+/**
+ * Enable retained drawing for a widget. The draw tasks added in its `LV_EVENT_DRAW_MAIN` events
+ * are copied and added again while the widget, its state and the styles don't change.
+ * It saves the time of the draw events if the widget is redrawn only because an other widget
+ * was invalidated on top of it, at the cost of the memory needed to store the draw descriptors.
+ * @param obj       pointer to an object
+ * @param en        true: enable retained drawing; false: disable it and free the copied draw tasks
+ * @note            the widget shouldn't change the content drawn in `LV_EVENT_DRAW_MAIN`
+ *                  without invalidating itself (e.g. by using data from other widgets).
+ */
+void lv_obj_set_draw_retained(lv_obj_t * obj, bool en);
+
+/**
+ * Get if retained drawing is enabled for a widget
+ * @param obj       pointer to an object
+ * @return          true: retained drawing is enabled
+ */
+bool lv_obj_get_draw_retained(const lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
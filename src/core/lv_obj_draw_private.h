@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_obj_draw.h"
+#include "../draw/lv_draw_private.h"
 
 /*********************
  *      DEFINES
@@ -24,6 +25,19 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** The draw tasks of a widget in retained drawing mode and the circumstances they were recorded in*/
+struct _lv_obj_draw_retained_t {
+    lv_draw_record_t record;
+    lv_area_t coords;           /**< Coordinates of the widget*/
+    lv_color32_t recolor;       /**< Recolor of the layer*/
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    lv_matrix_t matrix;         /**< Transform matrix of the layer*/
+#endif
+    lv_opa_t opa;               /**< Opacity of the layer*/
+    lv_state_t state;
+    uint8_t valid : 1;          /**< 1: `record` can be replayed*/
+};
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -37,6 +51,28 @@ int32_t lv_obj_get_ext_draw_size(const lv_obj_t * obj);
 
 lv_layer_type_t lv_obj_get_layer_type(const lv_obj_t * obj);
 
+/**
+ * Send the `LV_EVENT_DRAW_MAIN_BEGIN/MAIN/MAIN_END` events to a widget,
+ * or add its retained draw tasks if they are still valid.
+ * @param layer         the layer to draw to
+ * @param obj           pointer to an object
+ * @param fully_visible true: the whole ext. draw area of the widget is in the clip area of the layer,
+ *                      so all its draw tasks will be added and they can be retained
+ */
+void lv_obj_draw_main(lv_layer_t * layer, lv_obj_t * obj, bool fully_visible);
+
+/**
+ * Drop the retained draw tasks of a widget. Called when the widget is invalidated.
+ * @param obj       pointer to an object
+ */
+void lv_obj_reset_draw_retained(const lv_obj_t * obj);
+
+/**
+ * Free the retained draw tasks of a widget and disable retained drawing
+ * @param obj       pointer to an object
+ */
+void lv_obj_free_draw_retained(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
@@ -12,11 +12,13 @@
 #include "lv_obj_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
+#include "lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_obj_class)
+#define dispatch_stat LV_GLOBAL_DEFAULT()->obj_event_dispatch_stat
 
 /**********************
  *      TYPEDEFS
@@ -360,6 +362,19 @@ lv_state_t lv_event_get_prev_state(lv_event_t * e)
     }
 }
 
+#if LV_OBJ_EVENT_DISPATCH_STAT
+const lv_obj_event_dispatch_stat_t * lv_obj_get_event_dispatch_stat(lv_event_code_t code)
+{
+    if(code >= LV_EVENT_LAST) return NULL;
+    return &dispatch_stat[code];
+}
+
+void lv_obj_reset_event_dispatch_stat(void)
+{
+    lv_memzero(dispatch_stat, sizeof(dispatch_stat));
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -378,14 +393,29 @@ static lv_result_t event_send_core(lv_event_t * e)
     lv_result_t res = LV_RESULT_OK;
     lv_event_list_t * list = target->spec_attr ?  &target->spec_attr->event_list : NULL;
 
-    res = lv_event_send(list, e, true);
-    if(res != LV_RESULT_OK || e->stop_processing) return res;
+    /*Most widgets have no callback for most of the events (e.g. for the drawing events).
+     *Don't go through their event list twice in this case.*/
+    if(list && !lv_event_list_has_code(list, e->code)) list = NULL;
+
+#if LV_OBJ_EVENT_DISPATCH_STAT
+    if(e->code < LV_EVENT_LAST) {
+        dispatch_stat[e->code].send_cnt++;
+        if(list == NULL) dispatch_stat[e->code].list_skip_cnt++;
+    }
+#endif
+
+    if(list) {
+        res = lv_event_send(list, e, true);
+        if(res != LV_RESULT_OK || e->stop_processing) return res;
+    }
 
     res = lv_obj_event_base(NULL, e);
     if(res != LV_RESULT_OK || e->stop_processing) return res;
 
-    res = lv_event_send(list, e, false);
-    if(res != LV_RESULT_OK || e->stop_processing) return res;
+    if(list) {
+        res = lv_event_send(list, e, false);
+        if(res != LV_RESULT_OK || e->stop_processing) return res;
+    }
 
     lv_obj_t * parent = lv_obj_get_parent(e->current_target);
     if(parent && event_is_bubbled(e)) {
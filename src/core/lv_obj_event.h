@@ -33,6 +33,14 @@ typedef enum {
     LV_COVER_RES_MASKED     = 2,
 } lv_cover_res_t;
 
+#if LV_OBJ_EVENT_DISPATCH_STAT
+typedef struct {
+    uint32_t send_cnt;          /**< Number of times the event was sent to a widget, including bubbling and trickling*/
+    uint32_t list_skip_cnt;     /**< Number of times the event callbacks of the widget were not checked
+                                 *   as the widget had no callback for the event*/
+} lv_obj_event_dispatch_stat_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -202,6 +210,20 @@ lv_draw_task_t * lv_event_get_draw_task(lv_event_t * e);
  */
 lv_state_t lv_event_get_prev_state(lv_event_t * e);
 
+#if LV_OBJ_EVENT_DISPATCH_STAT
+/**
+ * Get how many times an event was sent to the widgets since `lv_init()` or the last reset.
+ * @param code      a built-in event code
+ * @return          pointer to the statistics or NULL if `code` is not a built-in event code
+ */
+const lv_obj_event_dispatch_stat_t * lv_obj_get_event_dispatch_stat(lv_event_code_t code);
+
+/**
+ * Reset the event dispatch statistics of all the event codes
+ */
+void lv_obj_reset_event_dispatch_stat(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -33,6 +33,7 @@
 static int32_t calc_content_width(lv_obj_t * obj);
 static int32_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static lv_obj_t * layout_mark_parents(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
 static bool is_transformed(const lv_obj_t * obj);
 static lv_result_t invalidate_area_core(const lv_obj_t * obj, lv_area_t * area_tmp);
@@ -284,6 +285,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     obj->readjust_scroll_after_layout = 1;
+    layout_mark_parents(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -369,8 +371,14 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
 
-    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
+    /*Mark the parents even if the layout was already dirty as the widget
+     *might have been moved to an other parent since then.
+     *Mark the screen as dirty too to mark that there is something to do on this screen*/
+    lv_obj_t * scr = layout_mark_parents(obj);
+
+    /*The refresh was already requested when the layout became dirty*/
+    if(LV_GLOBAL_DEFAULT()->inv_coalesce && scr->scr_layout_inv) return;
+
     scr->scr_layout_inv = 1;
 
     /*Make the display refreshing*/
@@ -1114,6 +1122,9 @@ lv_result_t lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The widget has changed, so its retained draw tasks are outdated*/
+    lv_obj_reset_draw_retained(obj);
+
     lv_display_t * disp   = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return LV_RESULT_INVALID;
 
@@ -1125,6 +1136,9 @@ lv_result_t lv_obj_invalidate(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The widget has changed, so its retained draw tasks are outdated*/
+    lv_obj_reset_draw_retained(obj);
+
     lv_display_t * disp = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return LV_RESULT_INVALID;
 
@@ -1137,11 +1151,33 @@ lv_result_t lv_obj_invalidate(const lv_obj_t * obj)
     obj_coords.x2 += ext_size;
     obj_coords.y2 += ext_size;
 
+    lv_global_t * global = LV_GLOBAL_DEFAULT();
+    if(global->inv_coalesce && global->inv_coalesce_obj == obj &&
+       lv_area_is_equal(&global->inv_coalesce_area, &obj_coords)) {
+        return LV_RESULT_OK;
+    }
+
     lv_result_t res = obj_invalidate_area_internal(disp, obj, &obj_coords);
 
+    if(global->inv_coalesce) {
+        global->inv_coalesce_obj = res == LV_RESULT_OK ? obj : NULL;
+        global->inv_coalesce_area = obj_coords;
+    }
+
     return res;
 }
 
+void lv_obj_set_invalidation_coalescing(bool en)
+{
+    LV_GLOBAL_DEFAULT()->inv_coalesce = en;
+    lv_obj_invalidation_coalescing_reset();
+}
+
+void lv_obj_invalidation_coalescing_reset(void)
+{
+    LV_GLOBAL_DEFAULT()->inv_coalesce_obj = NULL;
+}
+
 bool lv_obj_area_is_visible(const lv_obj_t * obj, lv_area_t * area)
 {
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
@@ -1557,13 +1593,37 @@ static int32_t calc_content_height(lv_obj_t * obj)
     return LV_MAX(self_h, child_res);
 }
 
+/**
+ * Mark all the parents of a widget to know that a descendant of them has something to do
+ * in the next layout update.
+ * @param obj   pointer to a widget
+ * @return      the screen of the widget
+ */
+static lv_obj_t * layout_mark_parents(lv_obj_t * obj)
+{
+    lv_obj_t * scr = obj;
+    while(scr->parent) {
+        scr = scr->parent;
+        scr->layout_child_inv = 1;
+    }
+
+    return scr;
+}
+
 static void layout_update_core(lv_obj_t * obj)
 {
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+
+    /*Check only the children which or whose descendants have something to do*/
+    if(obj->layout_child_inv) {
+        obj->layout_child_inv = 0;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            if(child->layout_inv || child->layout_child_inv || child->readjust_scroll_after_layout) {
+                layout_update_core(child);
+            }
+        }
     }
 
     if(obj->layout_inv) {
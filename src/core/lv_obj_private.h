@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 #include "../misc/lv_ext_data.h"
 #include "lv_obj.h"
+#include "lv_obj_style_private.h"
 
 /*********************
  *      DEFINES
@@ -42,6 +43,7 @@ struct _lv_obj_spec_attr_t {
 
     int32_t ext_click_pad;          /**< Extra click padding in all direction*/
     int32_t ext_draw_size;          /**< EXTend the size in every direction for drawing.*/
+    lv_obj_draw_retained_t * draw_retained; /**< The retained draw tasks if retained drawing is enabled*/
 
     uint16_t child_cnt;             /**< Number of children*/
     uint16_t scrollbar_mode : 2;    /**< How to display scrollbars, see `lv_scrollbar_mode_t`*/
@@ -60,9 +62,15 @@ struct _lv_obj_t {
     lv_obj_t * parent;
     lv_obj_spec_attr_t * spec_attr;
     lv_obj_style_t * styles;
+#if LV_OBJ_STYLE_INLINE_CNT
+    lv_obj_style_t styles_inline[LV_OBJ_STYLE_INLINE_CNT];  /**< `styles` points here while they fit*/
+#endif
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    lv_obj_style_resolved_t * style_resolved;   /**< Linked list of the cached resolved style values*/
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
@@ -72,6 +80,7 @@ struct _lv_obj_t {
     lv_obj_flag_t flags;
     uint16_t state;
     uint16_t layout_inv : 1;
+    uint16_t layout_child_inv : 1;  /**< The layout of a descendant is invalid or its scroll needs to be readjusted*/
     uint16_t readjust_scroll_after_layout : 1;
     uint16_t scr_layout_inv : 1;
     uint16_t skip_trans : 1;
@@ -92,6 +101,21 @@ struct _lv_obj_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Start or stop coalescing the invalidations of the widgets.
+ * While enabled, invalidating the same area of the last invalidated widget again is skipped
+ * and widgets whose layout is already dirty don't send a new refresh request.
+ * It makes applying many changes to a widget in a row cheaper, e.g. when animating it.
+ * @param en    true: start coalescing; false: stop coalescing
+ */
+void lv_obj_set_invalidation_coalescing(bool en);
+
+/**
+ * Forget the last invalidated area of the coalescing as it's not in the invalidated areas anymore.
+ * Called when the invalidated areas of a display are cleared or when a widget is deleted.
+ */
+void lv_obj_invalidation_coalescing_reset(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -10,6 +10,7 @@
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_draw_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../misc/lv_color.h"
@@ -25,6 +26,8 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define resolved_cache LV_GLOBAL_DEFAULT()->style_resolved_cache
+#define resolved_cache_hand LV_GLOBAL_DEFAULT()->style_resolved_cache_hand
 
 /**********************
  *      TYPEDEFS
@@ -56,6 +59,7 @@ typedef struct {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void styles_resize(lv_obj_t * obj);
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static lv_obj_style_t * get_trans_style(lv_obj_t * obj, lv_style_selector_t selector);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
@@ -74,6 +78,10 @@ static bool style_has_flag(const lv_style_t * style, uint32_t flag);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
 static void remove_style_core(lv_obj_t * obj, const lv_style_t * style, lv_style_selector_t selector, bool theme_only);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    static lv_obj_style_resolved_t * resolved_cache_get(const lv_obj_t * obj, lv_style_selector_t selector);
+    static void resolved_cache_remove(lv_obj_style_resolved_t * resolved);
+#endif
 #if LV_USE_OBSERVER
     static void bind_style_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
     static void bind_style_prop_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
@@ -94,11 +102,21 @@ static void remove_style_core(lv_obj_t * obj, const lv_style_t * style, lv_style
 void lv_obj_style_init(void)
 {
     lv_ll_init(style_trans_ll_p, sizeof(trans_t));
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    resolved_cache = lv_malloc_zeroed(LV_OBJ_STYLE_RESOLVED_CACHE_CNT * sizeof(lv_obj_style_resolved_t));
+    LV_ASSERT_MALLOC(resolved_cache);
+    resolved_cache_hand = 0;
+#endif
 }
 
 void lv_obj_style_deinit(void)
 {
     lv_ll_clear(style_trans_ll_p);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    lv_free(resolved_cache);
+    resolved_cache = NULL;
+#endif
     if(_style_custom_prop_flag_lookup_table != NULL) {
         lv_free(_style_custom_prop_flag_lookup_table);
         _style_custom_prop_flag_lookup_table = NULL;
@@ -133,7 +151,7 @@ void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selecto
     /*Allocate space for the new style and shift the rest of the style to the end*/
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
-    obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+    styles_resize(obj);
     LV_ASSERT_MALLOC(obj->styles);
 
     uint32_t j;
@@ -243,6 +261,15 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The children's look might depend on this property too*/
+    if(prop == LV_STYLE_PROP_ANY || prop == LV_STYLE_OPA || lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE)) {
+        lv_obj_style_children_changed(obj);
+    }
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    lv_obj_style_resolved_cache_drop(obj);
+#endif
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
@@ -323,6 +350,50 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+void lv_obj_style_children_changed(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT == 0
+    /*Without the resolved cache only the retained draw tasks need to be reset*/
+    if(LV_GLOBAL_DEFAULT()->obj_draw_retained_cnt == 0) return;
+#endif
+
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+        lv_obj_style_resolved_cache_drop(child);
+#endif
+        lv_obj_reset_draw_retained(child);
+        lv_obj_style_children_changed(child);
+    }
+}
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+void lv_obj_style_get_resolved_cache_usage(uint32_t * used_cnt, uint32_t * mem_size)
+{
+    if(used_cnt) {
+        *used_cnt = 0;
+        uint32_t i;
+        for(i = 0; i < LV_OBJ_STYLE_RESOLVED_CACHE_CNT; i++) {
+            if(resolved_cache[i].obj) (*used_cnt)++;
+        }
+    }
+
+    if(mem_size) *mem_size = LV_OBJ_STYLE_RESOLVED_CACHE_CNT * sizeof(lv_obj_style_resolved_t);
+}
+
+void lv_obj_style_resolved_cache_drop(lv_obj_t * obj)
+{
+    lv_obj_style_resolved_t * resolved = obj->style_resolved;
+    while(resolved) {
+        resolved->obj = NULL;
+        resolved = resolved->next;
+    }
+    obj->style_resolved = NULL;
+}
+#endif
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_NULL(obj)
@@ -331,10 +402,28 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
     lv_style_value_t value_act = { .ptr = NULL };
     lv_style_res_t found;
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    /*The values without transitions are used only temporarily, don't cache them*/
+    lv_obj_style_resolved_t * resolved = NULL;
+    if(prop < LV_STYLE_NUM_BUILT_IN_PROPS && !obj->skip_trans) {
+        resolved = resolved_cache_get(obj, selector);
+        if(resolved->is_resolved[prop >> 5] & ((uint32_t)1 << (prop & 0x1F))) {
+            return resolved->values[prop];
+        }
+    }
+#endif
+
     found = get_selector_style_prop(obj, selector, prop, &value_act);
-    if(found == LV_STYLE_RES_FOUND) return value_act;
+    if(found != LV_STYLE_RES_FOUND) value_act = lv_style_prop_get_default(prop);
 
-    return lv_style_prop_get_default(prop);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    if(resolved) {
+        resolved->values[prop] = value_act;
+        resolved->is_resolved[prop >> 5] |= (uint32_t)1 << (prop & 0x1F);
+    }
+#endif
+
+    return value_act;
 }
 
 bool lv_obj_has_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
@@ -743,6 +832,37 @@ lv_observer_t * lv_obj_bind_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Resize the style array of a widget to `obj->style_cnt` elements.
+ * If the styles fit into the slots of the widget use them instead of allocating an array.
+ * @param obj       pointer to a widget. `obj->style_cnt` is already the new count.
+ */
+static void styles_resize(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_INLINE_CNT
+    uint32_t cnt = obj->style_cnt;
+    bool is_inline = obj->styles == NULL || obj->styles == obj->styles_inline;
+    if(cnt <= LV_OBJ_STYLE_INLINE_CNT) {
+        if(!is_inline) {
+            lv_memcpy(obj->styles_inline, obj->styles, cnt * sizeof(lv_obj_style_t));
+            lv_free(obj->styles);
+        }
+        obj->styles = obj->styles_inline;
+        return;
+    }
+
+    /*The styles don't fit into the slots anymore. Move them to an array.*/
+    if(is_inline) {
+        lv_obj_style_t * styles = lv_malloc(cnt * sizeof(lv_obj_style_t));
+        if(styles) lv_memcpy(styles, obj->styles_inline, sizeof(obj->styles_inline));
+        obj->styles = styles;
+        return;
+    }
+#endif
+
+    obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+}
+
 /**
  * Get the local style of an object for a given part and for a given state.
  * If the local style for the part-state pair doesn't exist allocate and return it.
@@ -762,7 +882,7 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
-    obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+    styles_resize(obj);
     LV_ASSERT_MALLOC(obj->styles);
 
     for(i = obj->style_cnt - 1; i > 0 ; i--) {
@@ -773,7 +893,7 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
     }
 
     lv_memzero(&obj->styles[i], sizeof(lv_obj_style_t));
-    obj->styles[i].style = lv_malloc_zeroed(sizeof(lv_style_t));
+    obj->styles[i].style = lv_obj_attr_malloc_zeroed(LV_OBJ_ATTR_POOL_STYLE);
     lv_style_init((lv_style_t *)obj->styles[i].style);
 
     obj->styles[i].is_local = 1;
@@ -800,14 +920,14 @@ static lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t sel
 
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
-    obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+    styles_resize(obj);
 
     for(i = obj->style_cnt - 1; i > 0 ; i--) {
         obj->styles[i] = obj->styles[i - 1];
     }
 
     lv_memzero(&obj->styles[0], sizeof(lv_obj_style_t));
-    obj->styles[0].style = lv_malloc(sizeof(lv_style_t));
+    obj->styles[0].style = lv_obj_attr_malloc_zeroed(LV_OBJ_ATTR_POOL_STYLE);
     lv_style_init((lv_style_t *)obj->styles[0].style);
 
     obj->styles[0].is_trans = 1;
@@ -1099,6 +1219,10 @@ static lv_layer_type_t calculate_layer_type(lv_obj_t * obj)
 
 static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
 {
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    lv_obj_style_resolved_cache_drop(obj);
+#endif
+
 #if LV_OBJ_STYLE_CACHE
     uint32_t i;
     if(part == LV_PART_MAIN || part == LV_PART_ANY) {
@@ -1288,7 +1412,7 @@ static void remove_style_core(lv_obj_t * obj, const lv_style_t * style, lv_style
 
         if(obj->styles[i].is_local || obj->styles[i].is_trans) {
             if(obj->styles[i].style) lv_style_reset((lv_style_t *)obj->styles[i].style);
-            lv_free((lv_style_t *)obj->styles[i].style);
+            lv_obj_attr_free(LV_OBJ_ATTR_POOL_STYLE, (lv_style_t *)obj->styles[i].style);
             obj->styles[i].style = NULL;
         }
 
@@ -1299,7 +1423,7 @@ static void remove_style_core(lv_obj_t * obj, const lv_style_t * style, lv_style
         }
 
         obj->style_cnt--;
-        obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+        styles_resize(obj);
 
         deleted = true;
         /*The style from the current `i` index is removed, so `i` points to the next style.
@@ -1314,6 +1438,64 @@ static void remove_style_core(lv_obj_t * obj, const lv_style_t * style, lv_style
 
 
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+
+/**
+ * Get the cache entry of a widget's part and state. If there is no such entry, reuse an entry
+ * which wasn't used recently.
+ * @param obj       pointer to a widget
+ * @param selector  the part and state
+ * @return          the entry
+ */
+static lv_obj_style_resolved_t * resolved_cache_get(const lv_obj_t * obj, lv_style_selector_t selector)
+{
+    lv_obj_style_resolved_t * resolved;
+    for(resolved = obj->style_resolved; resolved; resolved = resolved->next) {
+        if(resolved->selector == selector) break;
+    }
+
+    if(resolved == NULL) {
+        /*Check the entries round robin and give a second chance to the ones used since the last check*/
+        while(1) {
+            resolved = &resolved_cache[resolved_cache_hand];
+            resolved_cache_hand++;
+            if(resolved_cache_hand >= LV_OBJ_STYLE_RESOLVED_CACHE_CNT) resolved_cache_hand = 0;
+
+            if(resolved->obj == NULL) break;
+            if(resolved->used == 0) {
+                resolved_cache_remove(resolved);
+                break;
+            }
+            resolved->used = 0;
+        }
+
+        resolved->obj = obj;
+        resolved->selector = selector;
+        resolved->next = obj->style_resolved;
+        ((lv_obj_t *)obj)->style_resolved = resolved;
+        lv_memzero(resolved->is_resolved, sizeof(resolved->is_resolved));
+    }
+
+    resolved->used = 1;
+    return resolved;
+}
+
+/**
+ * Remove an entry from the list of its widget
+ * @param resolved  pointer to a used entry
+ */
+static void resolved_cache_remove(lv_obj_style_resolved_t * resolved)
+{
+    lv_obj_t * obj = (lv_obj_t *)resolved->obj;
+    lv_obj_style_resolved_t ** next_p = &obj->style_resolved;
+    while(*next_p != resolved) next_p = &(*next_p)->next;
+    *next_p = resolved->next;
+
+    resolved->obj = NULL;
+}
+
+#endif
+
 #if LV_USE_OBSERVER
 
 static void bind_style_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
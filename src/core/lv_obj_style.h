@@ -190,6 +190,15 @@ void lv_obj_style_set_disabled(lv_obj_t * obj, const lv_style_t * style, lv_styl
  */
 bool lv_obj_style_get_disabled(lv_obj_t * obj, const lv_style_t * style, lv_style_selector_t selector);
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+/**
+ * Get the usage of the cache of resolved style values.
+ * @param used_cnt      store the number of entries used by widgets here (can be NULL)
+ * @param mem_size      store the size of the cache in bytes here (can be NULL)
+ */
+void lv_obj_style_get_resolved_cache_usage(uint32_t * used_cnt, uint32_t * mem_size);
+#endif
+
 /**
  * Enable or disable automatic style refreshing when a new style is added/removed to/from an object
  * or any other style change happens.
@@ -42,6 +42,21 @@ struct _lv_obj_style_transition_dsc_t {
     void * user_data;
 };
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+/**
+ * The resolved values of the built-in style properties of a widget's part in a given state.
+ * The values are resolved lazily when they are get the first time.
+ */
+struct _lv_obj_style_resolved_t {
+    lv_obj_style_resolved_t * next;     /**< The next entry of the same widget*/
+    const lv_obj_t * obj;               /**< The widget using the entry. NULL if the entry is free*/
+    uint32_t selector : 24;             /**< The part and state*/
+    uint32_t used : 1;                  /**< Set when the entry is used. Entries not used since the last check are reused first.*/
+    uint32_t is_resolved[(LV_STYLE_NUM_BUILT_IN_PROPS + 31) / 32];  /**< `(1 << (prop % 32))` is set in `is_resolved[prop / 32]` if `values[prop]` is valid*/
+    lv_style_value_t values[LV_STYLE_NUM_BUILT_IN_PROPS];
+};
+#endif
+
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -86,6 +101,22 @@ lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state
  */
 void lv_obj_update_layer_type(lv_obj_t * obj);
 
+/**
+ * Drop the resolved style values and the retained draw tasks of the children of a widget
+ * (recursively) as the style properties they inherit might have changed.
+ * @param obj       pointer to a widget
+ */
+void lv_obj_style_children_changed(lv_obj_t * obj);
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+/**
+ * Remove the resolved style values of a widget from the cache.
+ * Called when the styles of the widget change or the widget is deleted.
+ * @param obj       pointer to a widget
+ */
+void lv_obj_style_resolved_cache_drop(lv_obj_t * obj);
+#endif
+
 /**********************
  *      MACROS
  **********************/
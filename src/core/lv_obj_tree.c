@@ -8,6 +8,8 @@
  *********************/
 #include "lv_obj_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_style_private.h"
+#include "lv_obj_draw_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "../display/lv_display.h"
@@ -191,6 +193,13 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     obj->parent = parent;
 
+    /*The inherited style properties might be different with the new parent*/
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    lv_obj_style_resolved_cache_drop(obj);
+#endif
+    lv_obj_reset_draw_retained(obj);
+    lv_obj_style_children_changed(obj);
+
     /*Notify the original parent because one of its children is lost*/
     lv_obj_scrollbar_invalidate(old_parent);
     lv_obj_send_event(old_parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -720,6 +729,7 @@ static void obj_delete_core(lv_obj_t * obj)
     }
 
     /*All children deleted. Now clean up the object specific data*/
+    lv_obj_class_alloc_stat_remove(obj->class_p);
     lv_obj_destruct(obj);
 
     /*Remove the screen for the screen list*/
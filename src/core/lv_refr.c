@@ -11,14 +11,17 @@
 #include "../misc/lv_area_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../draw/lv_draw_mask.h"
+#include "../draw/lv_draw_arena_private.h"
 #include "lv_obj_private.h"
 #include "lv_obj_event_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../tick/lv_tick.h"
 #include "../misc/lv_timer_private.h"
+#include "../misc/lv_anim_private.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_profiler.h"
+#include "../misc/lv_profiler_timeline.h"
 #include "../misc/lv_types.h"
 #include "../draw/lv_draw_private.h"
 #include "../stdlib/lv_string.h"
@@ -31,6 +34,9 @@
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
 
+/*Minimal height of the tiles. The widgets are redrawn for each tile, so thinner tiles aren't worth it*/
+#define TILE_MIN_HEIGHT 8
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -39,8 +45,13 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static bool inv_area_buf_grow(lv_display_t * disp);
+static void inv_area_merge_cheapest(lv_display_t * disp, const lv_area_t * area_p);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
+static void refr_sync_stale_areas(void);
+static void refr_add_stale_areas(lv_display_t * disp, const lv_draw_buf_t * rendered);
+static void stale_areas_subtract(lv_ll_t * ll, const lv_area_t * area);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
 static void refr_configured_layer(lv_layer_t * layer);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
@@ -50,9 +61,19 @@ static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
 static void wait_for_flushing(lv_display_t * disp);
 static void call_sync_cb(lv_display_t * disp, const lv_area_t * area);
 static void wait_for_syncing(lv_display_t * disp);
+static bool frame_pacing_defer(lv_display_t * disp, lv_timer_t * tmr);
+static void frame_pacing_rendered(lv_display_t * disp);
+static uint32_t frame_pacing_next_vsync(const lv_display_frame_pacing_t * fp, uint32_t tick);
 static lv_result_t layer_get_area(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
                                   lv_area_t * layer_area_out, lv_area_t * obj_draw_size_out);
 static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area);
+#if LV_REFR_OCCLUDER_MAX > 0
+    static void occlusion_collect_younger(lv_refr_occlusion_t * occ, lv_obj_t * border, const lv_area_t * clip);
+    static void occlusion_collect(lv_refr_occlusion_t * occ, lv_obj_t * obj, const lv_area_t * clip);
+    static bool occlusion_is_covered(lv_refr_occlusion_t * occ, const lv_area_t * area, lv_obj_t * obj);
+    static bool obj_is_ancestor(const lv_obj_t * ancestor, const lv_obj_t * obj);
+#endif
+static bool occlusion_check(lv_layer_t * layer, lv_obj_t * obj);
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     static bool refr_check_obj_clip_overflow(lv_layer_t * layer, lv_obj_t * obj);
     static void refr_obj_matrix(lv_layer_t * layer, lv_obj_t * obj);
@@ -91,13 +112,19 @@ void lv_refr_now(lv_display_t * disp)
     lv_anim_refr_now();
 
     if(disp) {
-        if(disp->refr_timer) lv_display_refr_timer(disp->refr_timer);
+        if(disp->refr_timer) {
+            disp->frame_pacing.force = 1;
+            lv_display_refr_timer(disp->refr_timer);
+        }
     }
     else {
         lv_display_t * d;
         d = lv_display_get_next(NULL);
         while(d) {
-            if(d->refr_timer) lv_display_refr_timer(d->refr_timer);
+            if(d->refr_timer) {
+                d->frame_pacing.force = 1;
+                lv_display_refr_timer(d->refr_timer);
+            }
             d = lv_display_get_next(d);
         }
     }
@@ -126,9 +153,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
     /*If the object is visible on the current clip area*/
     layer->_clip_area = clip_coords_for_obj;
 
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
+    lv_obj_draw_main(layer, obj, lv_area_is_in(&obj_coords_ext, &clip_area_ori, 0));
 #if LV_USE_REFR_DEBUG
     lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
     lv_draw_rect_dsc_t draw_dsc;
@@ -290,6 +315,7 @@ lv_result_t lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+        lv_obj_invalidation_coalescing_reset();
         return LV_RESULT_OK;
     }
 
@@ -314,6 +340,7 @@ lv_result_t lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
 
     /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
     if(disp->render_mode == LV_DISPLAY_RENDER_MODE_FULL) {
+        if(disp->inv_area_cap == 0 && !inv_area_buf_grow(disp)) return LV_RESULT_INVALID;
         disp->inv_areas[0] = scr_area;
         disp->inv_p = 1;
         lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
@@ -329,14 +356,15 @@ lv_result_t lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
         if(lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return LV_RESULT_OK;
     }
 
-    /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    /*Save the area. If there is no place for it and the buffer can't grow
+     *join it to the area which grows the least*/
+    if(disp->inv_p >= disp->inv_area_cap && !inv_area_buf_grow(disp)) {
+        inv_area_merge_cheapest(disp, &com_area);
+    }
+    else {
+        lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 
@@ -365,9 +393,20 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 {
     LV_PROFILER_REFR_BEGIN;
     LV_TRACE_REFR("begin");
+#if LV_USE_PROFILER_TIMELINE
+    uint64_t timeline_begin = lv_profiler_timeline_tick_get();
+#endif
 
     if(tmr) {
         disp_refr = tmr->user_data;
+
+        /*Wait until it's time to start rendering for the next vsync. Keep the timer running.*/
+        if(frame_pacing_defer(disp_refr, tmr)) {
+            LV_TRACE_REFR("deferred");
+            LV_PROFILER_REFR_END;
+            return;
+        }
+
         /* Ensure the timer does not run again automatically.
          * This is done before refreshing in case refreshing invalidates something else.
          * However if the performance monitor is enabled keep the timer running to count the FPS.*/
@@ -399,6 +438,11 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+    lv_draw_arena_refr_begin();
+
+    /*Let the animations be where they should be when the frame is shown*/
+    if(disp_refr->frame_pacing.paced) lv_anim_refr_at(disp_refr->frame_pacing.info.present_time);
+
     /*Refresh the screen's layout if required*/
     LV_PROFILER_LAYOUT_BEGIN_TAG("layout");
     lv_obj_update_layout(disp_refr->act_scr);
@@ -412,6 +456,7 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+        lv_obj_invalidation_coalescing_reset();
         LV_LOG_WARN("there is no active screen");
         goto refr_finish;
     }
@@ -421,10 +466,9 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     refr_invalid_areas();
 
     if(disp_refr->inv_p == 0) goto refr_finish;
-    /*In double buffered direct mode or if sync callback is set, save the updated areas.
+    /*If sync callback is set, save the updated areas.
      *They will be used on the next call to synchronize the buffers.*/
-    if((lv_display_is_double_buffered(disp_refr) && disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) ||
-       disp_refr->sync_cb) {
+    if(disp_refr->sync_cb) {
         uint32_t i;
         for(i = 0; i < disp_refr->inv_p; i++) {
             if(disp_refr->inv_area_joined[i])
@@ -434,10 +478,17 @@ void lv_display_refr_timer(lv_timer_t * tmr)
             *sync_area = disp_refr->inv_areas[i];
         }
     }
+    /*In double buffered direct mode the other buffers missed the updated areas*/
+    else if(lv_display_is_double_buffered(disp_refr) && disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
+        refr_add_stale_areas(disp_refr, buf_act);
+    }
 
-    lv_memzero(disp_refr->inv_areas, sizeof(disp_refr->inv_areas));
-    lv_memzero(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
+    lv_memzero(disp_refr->inv_areas, disp_refr->inv_p * sizeof(lv_area_t));
+    lv_memzero(disp_refr->inv_area_joined, disp_refr->inv_p);
     disp_refr->inv_p = 0;
+    lv_obj_invalidation_coalescing_reset();
+
+    frame_pacing_rendered(disp_refr);
 
 refr_finish:
 
@@ -445,8 +496,14 @@ refr_finish:
     lv_draw_sw_mask_cleanup();
 #endif
 
+    lv_draw_arena_refr_end();
+
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
+#if LV_USE_PROFILER_TIMELINE
+    lv_profiler_timeline_add(LV_PROFILER_TIMELINE_EVENT_FRAME, NULL, 0, NULL, timeline_begin);
+#endif
+
     LV_TRACE_REFR("finished");
     LV_PROFILER_REFR_END;
 }
@@ -499,6 +556,7 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
     LV_ASSERT_NULL(layer);
     LV_ASSERT_NULL(obj);
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+    if(occlusion_check(layer, obj)) return;
 
     /*If `opa_layered != LV_OPA_COVER` draw the widget on a new layer and blend that layer with the given opacity.*/
     const lv_opa_t opa_layered = lv_obj_get_style_opa_layered(obj, LV_PART_MAIN);
@@ -616,7 +674,8 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the areas if refreshing the joined area is cheaper than refreshing them one by one.
+ * Besides the size of the areas each area has an `LV_INV_AREA_COST` overhead.
  */
 static void lv_refr_join_area(void)
 {
@@ -624,34 +683,86 @@ static void lv_refr_join_area(void)
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
+    bool joined;
+    /*An enlarged area might be worth joining with the areas checked before, so repeat until there are changes*/
+    do {
+        joined = false;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(disp_refr->inv_area_joined[join_in] != 0) continue;
+
+            /*Check all areas to join them in 'join_in'*/
+            for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
+                /*Handle only unjoined areas and ignore itself*/
+                if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
+                    continue;
+                }
 
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
+                lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
+                /*Join two areas only if the joined area is cheaper to refresh*/
+                if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
+                                                     lv_area_get_size(&disp_refr->inv_areas[join_from]) + LV_INV_AREA_COST)) {
+                    lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+
+                    /*Mark 'join_form' is joined into 'join_in'*/
+                    disp_refr->inv_area_joined[join_from] = 1;
+                    joined = true;
+                }
             }
+        }
+    } while(joined);
+    LV_PROFILER_REFR_END;
+}
 
-            lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+/**
+ * Double the size of the invalidated area buffer of a display
+ * @param disp      pointer to a display
+ * @return          true: the buffer has grown; false: it's already at `LV_INV_BUF_SIZE_MAX` or out of memory
+ */
+static bool inv_area_buf_grow(lv_display_t * disp)
+{
+    uint32_t new_cap = disp->inv_area_cap ? disp->inv_area_cap * 2 : LV_INV_BUF_SIZE;
+    new_cap = LV_MIN(new_cap, LV_INV_BUF_SIZE_MAX);
+    if(new_cap <= disp->inv_area_cap) return false;
+
+    /*Store the areas and the joined flags in one buffer. The joined flags are set only during refreshing,
+     *so they can be simply cleared here.*/
+    lv_area_t * new_areas = lv_realloc(disp->inv_areas, new_cap * (sizeof(lv_area_t) + sizeof(uint8_t)));
+    if(new_areas == NULL) {
+        LV_LOG_WARN("Couldn't allocate memory for %" LV_PRIu32 " invalidated areas", new_cap);
+        return false;
+    }
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+    disp->inv_areas = new_areas;
+    disp->inv_area_joined = (uint8_t *)(new_areas + new_cap);
+    lv_memzero(disp->inv_area_joined, new_cap);
+    disp->inv_area_cap = new_cap;
+    return true;
+}
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
-            }
+/**
+ * Join an area to the invalidated area which needs to grow the least to include it
+ * @param disp      pointer to a display
+ * @param area_p    the area to add
+ */
+static void inv_area_merge_cheapest(lv_display_t * disp, const lv_area_t * area_p)
+{
+    if(disp->inv_p == 0) return;
+
+    uint32_t best_i = 0;
+    uint32_t best_growth = UINT32_MAX;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        lv_area_t joined_area;
+        lv_area_join(&joined_area, &disp->inv_areas[i], area_p);
+        uint32_t growth = lv_area_get_size(&joined_area) - lv_area_get_size(&disp->inv_areas[i]);
+        if(growth < best_growth) {
+            best_growth = growth;
+            best_i = i;
         }
     }
-    LV_PROFILER_REFR_END;
+
+    lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], area_p);
 }
 
 /**
@@ -659,84 +770,36 @@ static void lv_refr_join_area(void)
  */
 static void refr_sync_areas(void)
 {
-    /*Do not sync if not direct double buffered and no sync callback set*/
-    const bool auto_sync = disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT &&
-                           lv_display_is_double_buffered(disp_refr);
-    const bool user_sync = disp_refr->sync_cb != NULL;
-    if(!auto_sync && !user_sync) return;
+    /*In double buffered direct mode copy the stale areas to the buffer to render*/
+    if(disp_refr->sync_cb == NULL) {
+        if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT && lv_display_is_double_buffered(disp_refr)) {
+            refr_sync_stale_areas();
+        }
+        return;
+    }
 
     /*Do not sync if no sync areas*/
     if(lv_ll_is_empty(&disp_refr->sync_areas)) return;
 
     LV_PROFILER_REFR_BEGIN;
-    /*With double buffered direct mode synchronize the rendered areas to the other buffer*/
     /*We need to wait for ready here to not mess up the active screen*/
     wait_for_flushing(disp_refr);
 
     /*Iterate through invalidated areas to see if sync area should be copied*/
     uint16_t i;
-    int8_t j;
-    lv_area_t res[4] = {0};
-    int8_t res_c;
-    lv_area_t * sync_area, * new_area, * next_area;
     for(i = 0; i < disp_refr->inv_p; i++) {
         /*Skip joined areas*/
         if(disp_refr->inv_area_joined[i]) continue;
 
-        /*Iterate over sync areas*/
-        sync_area = lv_ll_get_head(&disp_refr->sync_areas);
-        while(sync_area != NULL) {
-            /*Get next sync area*/
-            next_area = lv_ll_get_next(&disp_refr->sync_areas, sync_area);
-
-            /*Remove intersect of redraw area from sync area and get remaining areas*/
-            res_c = lv_area_diff(res, sync_area, &disp_refr->inv_areas[i]);
-
-            /*New sub areas created after removing intersect*/
-            if(res_c != -1) {
-                /*Replace old sync area with new areas*/
-                for(j = 0; j < res_c; j++) {
-                    new_area = lv_ll_ins_prev(&disp_refr->sync_areas, sync_area);
-                    *new_area = res[j];
-                }
-                lv_ll_remove(&disp_refr->sync_areas, sync_area);
-                lv_free(sync_area);
-            }
-
-            /*Move on to next sync area*/
-            sync_area = next_area;
-        }
-    }
-
-    /*The buffers are already swapped.
-     *So the active buffer is the off screen buffer where LVGL will render*/
-    lv_draw_buf_t * off_screen = disp_refr->buf_act;
-    /*Triple buffer sync buffer for off-screen2 updates.*/
-    lv_draw_buf_t * off_screen2 = NULL;
-    lv_draw_buf_t * on_screen = NULL;
-
-    /* Only compute buffer relationships when auto_sync (direct double-buffered) is used.
-     * When only user_sync is active, these pointers are not needed. */
-    if(auto_sync) {
-        if(disp_refr->buf_act == disp_refr->buf_1) {
-            off_screen2 = disp_refr->buf_2;
-            on_screen = disp_refr->buf_3 ? disp_refr->buf_3 : disp_refr->buf_2;
-        }
-        else if(disp_refr->buf_act == disp_refr->buf_2) {
-            off_screen2 = disp_refr->buf_3 ? disp_refr->buf_3 : disp_refr->buf_1;
-            on_screen = disp_refr->buf_1;
-        }
-        else {
-            off_screen2 = disp_refr->buf_1;
-            on_screen = disp_refr->buf_2;
-        }
+        stale_areas_subtract(&disp_refr->sync_areas, &disp_refr->inv_areas[i]);
     }
 
     uint32_t hor_res = lv_display_get_horizontal_resolution(disp_refr);
     uint32_t ver_res = lv_display_get_vertical_resolution(disp_refr);
 
     lv_area_t disp_area = {0, 0, (int32_t)hor_res - 1, (int32_t)ver_res - 1};
-    /*Copy sync areas (if any remaining)*/
+    /*Sync the remaining areas (if any)*/
+    lv_area_t * sync_area;
     for(sync_area = lv_ll_get_head(&disp_refr->sync_areas); sync_area != NULL;
         sync_area = lv_ll_get_next(&disp_refr->sync_areas, sync_area)) {
         /**
@@ -750,22 +813,13 @@ static void refr_sync_areas(void)
             lv_display_rotate_area(disp_refr, sync_area);
         }
 #endif
-        /*Call sync callback (if set)*/
-        if(disp_refr->sync_cb) {
-            /*Set syncing flags*/
-            disp_refr->syncing = true;
-            disp_refr->syncing_last = lv_ll_get_tail(&disp_refr->sync_areas) == sync_area;
-
-            /*Call sync callback and wait for sync to complete*/
-            call_sync_cb(disp_refr, sync_area);
-            wait_for_syncing(disp_refr);
-        }
-        /*Fallback to internal double buffered direct mode sync*/
-        else {
-            lv_draw_buf_copy(off_screen, sync_area, on_screen, sync_area);
-            if(off_screen2 != on_screen)
-                lv_draw_buf_copy(off_screen2, sync_area, on_screen, sync_area);
-        }
+        /*Set syncing flags*/
+        disp_refr->syncing = true;
+        disp_refr->syncing_last = lv_ll_get_tail(&disp_refr->sync_areas) == sync_area;
+
+        /*Call sync callback and wait for sync to complete*/
+        call_sync_cb(disp_refr, sync_area);
+        wait_for_syncing(disp_refr);
     }
 
     /*Clear sync areas*/
@@ -774,13 +828,134 @@ static void refr_sync_areas(void)
 }
 
 /**
- * Refresh the joined areas
+ * Copy the areas of the buffer to render which were updated in other buffers since
+ * it was rendered last time. They are copied from the newest buffer.
+ */
+static void refr_sync_stale_areas(void)
+{
+    if(disp_refr->inv_p == 0) return;
+
+    lv_draw_buf_t * bufs[3] = {disp_refr->buf_1, disp_refr->buf_2, disp_refr->buf_3};
+    lv_draw_buf_t * off_screen = disp_refr->buf_act;
+    uint32_t act_idx = off_screen == bufs[0] ? 0 : (off_screen == bufs[1] ? 1 : 2);
+    lv_ll_t * stale_ll = &disp_refr->stale_areas[act_idx];
+    if(lv_ll_is_empty(stale_ll)) return;
+
+    LV_PROFILER_REFR_BEGIN;
+
+    /*The areas redrawn now needn't be copied*/
+    uint32_t i;
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i]) continue;
+        stale_areas_subtract(stale_ll, &disp_refr->inv_areas[i]);
+    }
+
+    /*The newest buffer is the one before the active buffer (see `draw_buf_flush`)*/
+    lv_draw_buf_t * newest;
+    if(act_idx == 0) newest = bufs[2] ? bufs[2] : bufs[1];
+    else newest = bufs[act_idx - 1];
+
+    /*With 2 buffers the buffer to render is on the screen until the newest buffer is flushed.
+     *With 3 buffers it's neither on the screen nor waiting to be flushed.*/
+    if(bufs[2] == NULL) wait_for_flushing(disp_refr);
+
+    uint32_t hor_res = lv_display_get_horizontal_resolution(disp_refr);
+    uint32_t ver_res = lv_display_get_vertical_resolution(disp_refr);
+    lv_area_t disp_area = {0, 0, (int32_t)hor_res - 1, (int32_t)ver_res - 1};
+
+    lv_area_t * stale_area;
+    LV_LL_READ(stale_ll, stale_area) {
+        lv_area_t copy_area;
+        if(!lv_area_intersect(&copy_area, stale_area, &disp_area)) continue;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+        if(lv_display_get_matrix_rotation(disp_refr)) {
+            lv_display_rotate_area(disp_refr, &copy_area);
+        }
+#endif
+        lv_draw_buf_copy(off_screen, &copy_area, newest, &copy_area);
+    }
+
+    lv_ll_clear(stale_ll);
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Add the areas rendered in the current frame to the stale areas of the other buffers
+ * @param disp          the refreshed display
+ * @param rendered      the buffer the frame was rendered to
  */
+static void refr_add_stale_areas(lv_display_t * disp, const lv_draw_buf_t * rendered)
+{
+    lv_draw_buf_t * bufs[3] = {disp->buf_1, disp->buf_2, disp->buf_3};
+    uint32_t b;
+    for(b = 0; b < 3; b++) {
+        if(bufs[b] == NULL || bufs[b] == rendered) continue;
+
+        lv_ll_t * stale_ll = &disp->stale_areas[b];
+        uint32_t i;
+        for(i = 0; i < disp->inv_p; i++) {
+            if(disp->inv_area_joined[i]) continue;
+
+            /*Keep the areas disjoint to copy every pixel only once*/
+            stale_areas_subtract(stale_ll, &disp->inv_areas[i]);
+            lv_area_t * stale_area = lv_ll_ins_tail(stale_ll);
+            LV_ASSERT_MALLOC(stale_area);
+            if(stale_area == NULL) break;
+            *stale_area = disp->inv_areas[i];
+        }
+
+        /*Too many small areas: copy their bounding box instead*/
+        if(lv_ll_get_len(stale_ll) > LV_INV_BUF_SIZE_MAX) {
+            lv_area_t bounding = *((lv_area_t *)lv_ll_get_head(stale_ll));
+            lv_area_t * stale_area;
+            LV_LL_READ(stale_ll, stale_area) {
+                lv_area_join(&bounding, &bounding, stale_area);
+            }
+            lv_ll_clear(stale_ll);
+            stale_area = lv_ll_ins_tail(stale_ll);
+            LV_ASSERT_MALLOC(stale_area);
+            if(stale_area) *stale_area = bounding;
+        }
+    }
+}
+
+/**
+ * Remove an area from a list of areas. The areas which partially overlap with it
+ * are replaced by their non-overlapping parts.
+ * @param ll        linked list of `lv_area_t`
+ * @param area      the area to remove
+ */
+static void stale_areas_subtract(lv_ll_t * ll, const lv_area_t * area)
+{
+    lv_area_t res[4] = {0};
+    lv_area_t * stale_area = lv_ll_get_head(ll);
+    while(stale_area != NULL) {
+        lv_area_t * next_area = lv_ll_get_next(ll, stale_area);
+
+        /*Remove the intersection and get the remaining areas*/
+        int8_t res_c = lv_area_diff(res, stale_area, area);
+        if(res_c != -1) {
+            int8_t j;
+            for(j = 0; j < res_c; j++) {
+                lv_area_t * new_area = lv_ll_ins_prev(ll, stale_area);
+                LV_ASSERT_MALLOC(new_area);
+                if(new_area) *new_area = res[j];
+            }
+            lv_ll_remove(ll, stale_area);
+            lv_free(stale_area);
+        }
+
+        stale_area = next_area;
+    }
+}
+
 static void refr_invalid_areas(void)
 {
     if(disp_refr->inv_p == 0) return;
     LV_PROFILER_REFR_BEGIN;
 
+    lv_memzero(&disp_refr->overdraw_info, sizeof(disp_refr->overdraw_info));
+
     /*Notify the display driven rendering has started*/
     lv_display_send_event(disp_refr, LV_EVENT_RENDER_START, NULL);
 
@@ -908,20 +1083,29 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
 
     /*Try to divide the area to smaller tiles*/
     uint32_t tile_cnt = 1;
-    int32_t tile_h = lv_area_get_height(area_p);
-    if(LV_COLOR_FORMAT_IS_INDEXED(layer->color_format) == false) {
-        /* Assume that the buffer size (can be screen sized or smaller in case of partial mode)
-         * and max tile size are the optimal scenario. From this calculate the ideal tile size
-         * and set the tile count and tile height accordingly.
-         */
+    int32_t area_h = lv_area_get_height(area_p);
+    if(LV_COLOR_FORMAT_IS_INDEXED(layer->color_format) == false && disp_refr->tile_cnt > 1) {
         uint32_t max_tile_cnt = disp_refr->tile_cnt;
-        uint32_t total_buf_size = layer->draw_buf->data_size;
-        uint32_t ideal_tile_size = total_buf_size / max_tile_cnt;
-        uint32_t area_buf_size = lv_area_get_size(area_p) * lv_color_format_get_size(layer->color_format);
+        if(disp_refr->tile_mode == LV_DISPLAY_TILE_MODE_ALWAYS) {
+            tile_cnt = max_tile_cnt;
+        }
+        else {
+            /* Assume that the buffer size (can be screen sized or smaller in case of partial mode)
+             * and max tile size are the optimal scenario. From this calculate the ideal tile size
+             * and set the tile count accordingly.
+             */
+            uint32_t total_buf_size = layer->draw_buf->data_size;
+            uint32_t ideal_tile_size = total_buf_size / max_tile_cnt;
+            uint32_t area_buf_size = lv_area_get_size(area_p) * lv_color_format_get_size(layer->color_format);
+
+            if(ideal_tile_size > 0) tile_cnt = (area_buf_size + (ideal_tile_size - 1)) / ideal_tile_size; /*Round up*/
+            tile_cnt = LV_CLAMP(1, tile_cnt, max_tile_cnt);
+        }
 
-        tile_cnt = (area_buf_size + (ideal_tile_size - 1)) / ideal_tile_size; /*Round up*/
-        tile_h = lv_area_get_height(area_p) / tile_cnt;
+        /*Don't create too thin tiles*/
+        tile_cnt = LV_MIN(tile_cnt, (uint32_t)LV_MAX(area_h / TILE_MIN_HEIGHT, 1));
     }
+    int32_t tile_h = area_h / tile_cnt;
 
     if(tile_cnt == 1) {
         refr_configured_layer(layer);
@@ -1071,35 +1255,55 @@ static void refr_configured_layer(lv_layer_t * layer)
         top_prev_scr = lv_refr_get_top_obj(&layer->_clip_area, disp_refr->prev_scr);
     }
 
+    /*Collect the objects to refresh in drawing order*/
+    lv_obj_t * top_objs[5];
+    uint32_t top_obj_cnt = 0;
+
     /*Draw a bottom layer background if there is no top object*/
     if(top_act_scr == NULL && top_prev_scr == NULL) {
-        refr_obj_and_children(layer, lv_display_get_layer_bottom(disp_refr));
+        top_objs[top_obj_cnt++] = lv_display_get_layer_bottom(disp_refr);
     }
 
-    if(disp_refr->draw_prev_over_act) {
-        if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
-        refr_obj_and_children(layer, top_act_scr);
+    if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
+    if(disp_refr->prev_scr && top_prev_scr == NULL) top_prev_scr = disp_refr->prev_scr;
 
+    if(disp_refr->draw_prev_over_act) {
+        top_objs[top_obj_cnt++] = top_act_scr;
         /*Refresh the previous screen if any*/
-        if(disp_refr->prev_scr) {
-            if(top_prev_scr == NULL) top_prev_scr = disp_refr->prev_scr;
-            refr_obj_and_children(layer, top_prev_scr);
-        }
+        if(top_prev_scr) top_objs[top_obj_cnt++] = top_prev_scr;
     }
     else {
         /*Refresh the previous screen if any*/
-        if(disp_refr->prev_scr) {
-            if(top_prev_scr == NULL) top_prev_scr = disp_refr->prev_scr;
-            refr_obj_and_children(layer, top_prev_scr);
-        }
-
-        if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
-        refr_obj_and_children(layer, top_act_scr);
+        if(top_prev_scr) top_objs[top_obj_cnt++] = top_prev_scr;
+        top_objs[top_obj_cnt++] = top_act_scr;
     }
 
     /*Also refresh top and sys layer unconditionally*/
-    refr_obj_and_children(layer, lv_display_get_layer_top(disp_refr));
-    refr_obj_and_children(layer, lv_display_get_layer_sys(disp_refr));
+    top_objs[top_obj_cnt++] = lv_display_get_layer_top(disp_refr);
+    top_objs[top_obj_cnt++] = lv_display_get_layer_sys(disp_refr);
+
+    disp_refr->overdraw_info.refr_px += lv_area_get_size(&layer->_clip_area);
+
+    uint32_t i;
+    lv_refr_occlusion_t occ;
+    occ.layer = layer;
+#if LV_REFR_OCCLUDER_MAX > 0
+    /*Find the opaque objects from front to back. They can hide the objects drawn before them.*/
+    occ.cnt = 0;
+    for(i = top_obj_cnt; i > 0; i--) {
+        lv_obj_t * top_obj = top_objs[i - 1];
+        if(top_obj == NULL) continue;
+        occlusion_collect_younger(&occ, top_obj, &layer->_clip_area);
+        occlusion_collect(&occ, top_obj, &layer->_clip_area);
+    }
+#endif
+    disp_refr->occlusion = &occ;
+
+    for(i = 0; i < top_obj_cnt; i++) {
+        refr_obj_and_children(layer, top_objs[i]);
+    }
+
+    disp_refr->occlusion = NULL;
 
     LV_PROFILER_REFR_END;
 }
@@ -1220,6 +1424,176 @@ static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area)
     else return true;
 }
 
+/**
+ * Check if a widget is fully hidden by the opaque widgets drawn after it and
+ * update the overdraw statistics.
+ * @param layer     the layer where the widget is drawn
+ * @param obj       the widget to check
+ * @return          true: the widget (and its children) needn't be drawn
+ */
+static bool occlusion_check(lv_layer_t * layer, lv_obj_t * obj)
+{
+    if(disp_refr == NULL) return false;
+    lv_refr_occlusion_t * occ = disp_refr->occlusion;
+    if(occ == NULL || occ->layer != layer) return false;
+
+    lv_area_t obj_area;
+    lv_obj_get_coords(obj, &obj_area);
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_area, ext_draw_size, ext_draw_size);
+    if(!lv_area_intersect(&obj_area, &obj_area, &layer->_clip_area)) return false;
+
+#if LV_REFR_OCCLUDER_MAX > 0
+    /*The widget is drawn now, so it can't hide the next widgets*/
+    uint32_t i;
+    for(i = 0; i < occ->cnt; i++) {
+        if(occ->objs[i] == obj) occ->passed[i] = true;
+    }
+
+    /*The children of widgets with overflow visible and the transformed widgets
+     *can be drawn outside of the checked area*/
+    if(!lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE) &&
+       lv_obj_get_layer_type(obj) == LV_LAYER_TYPE_NONE &&
+       occlusion_is_covered(occ, &obj_area, obj)) {
+
+        /*The opaque children won't be drawn either*/
+        for(i = 0; i < occ->cnt; i++) {
+            if(obj_is_ancestor(obj, occ->objs[i])) occ->passed[i] = true;
+        }
+
+        disp_refr->overdraw_info.culled_cnt++;
+        disp_refr->overdraw_info.culled_px += lv_area_get_size(&obj_area);
+        return true;
+    }
+#endif
+
+    disp_refr->overdraw_info.drawn_px += lv_area_get_size(&obj_area);
+    return false;
+}
+
+#if LV_REFR_OCCLUDER_MAX > 0
+
+/**
+ * Collect the occluders from the widgets which are drawn after `border` by `refr_obj_and_children`.
+ * I.e. the younger siblings of `border` and its parents.
+ */
+static void occlusion_collect_younger(lv_refr_occlusion_t * occ, lv_obj_t * border, const lv_area_t * clip)
+{
+    lv_obj_t * parent = lv_obj_get_parent(border);
+    if(parent == NULL) return;
+
+    /*The younger siblings of the parents are drawn later, so they are closer to the front*/
+    occlusion_collect_younger(occ, parent, clip);
+
+    int32_t border_idx = lv_obj_get_index(border);
+    int32_t i;
+    for(i = (int32_t)lv_obj_get_child_count(parent) - 1; i > border_idx; i--) {
+        occlusion_collect(occ, parent->spec_attr->children[i], clip);
+    }
+}
+
+/**
+ * Collect the widgets which fully cover a part of `clip` from front to back.
+ * The largest `LV_REFR_OCCLUDER_MAX` widgets are kept.
+ * @param occ       store the occluders here
+ * @param obj       check this widget and its children
+ * @param clip      the area where `obj` can be visible
+ */
+static void occlusion_collect(lv_refr_occlusion_t * occ, lv_obj_t * obj, const lv_area_t * clip)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    /*Layers are blended with opacity or transformation, and opacity affects the children too.*/
+    if(lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return;
+    if(lv_obj_get_style_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return;
+
+    lv_area_t obj_area;
+    lv_obj_get_coords(obj, &obj_area);
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_area, ext_draw_size, ext_draw_size);
+
+    lv_area_t obj_clip;
+    if(!lv_area_intersect(&obj_clip, clip, &obj_area)) return;
+
+    /*Skip it if it's already hidden by a widget in front of it*/
+    bool overflow_visible = lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    if(!overflow_visible && occlusion_is_covered(occ, &obj_clip, obj)) return;
+
+    /*The children are in front of their parent. The ones with clip corner are drawn on a masked layer.*/
+    lv_area_t children_clip;
+    if(lv_area_intersect(&children_clip, clip, overflow_visible ? &obj_area : &obj->coords) &&
+       (lv_obj_get_style_clip_corner(obj, LV_PART_MAIN) == false || lv_obj_get_style_radius(obj, LV_PART_MAIN) == 0)) {
+        int32_t i;
+        for(i = (int32_t)lv_obj_get_child_count(obj) - 1; i >= 0; i--) {
+            occlusion_collect(occ, obj->spec_attr->children[i], &children_clip);
+        }
+    }
+
+    lv_area_t cover_area;
+    if(!lv_area_intersect(&cover_area, clip, &obj->coords)) return;
+    uint32_t cover_size = lv_area_get_size(&cover_area);
+    if(cover_size < LV_REFR_OCCLUDER_MIN_SIZE) return;
+
+    /*Replace the smallest occluder if there is no more space*/
+    uint32_t i;
+    uint32_t idx = occ->cnt;
+    if(occ->cnt == LV_REFR_OCCLUDER_MAX) {
+        uint32_t min_size = cover_size;
+        for(i = 0; i < occ->cnt; i++) {
+            uint32_t size = lv_area_get_size(&occ->areas[i]);
+            if(size < min_size) {
+                min_size = size;
+                idx = i;
+            }
+        }
+        if(idx == occ->cnt) return;
+    }
+
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = &cover_area;
+    lv_obj_send_event(obj, LV_EVENT_COVER_CHECK, &info);
+    if(info.res != LV_COVER_RES_COVER) return;
+
+    occ->objs[idx] = obj;
+    occ->areas[idx] = cover_area;
+    occ->passed[idx] = false;
+    if(idx == occ->cnt) occ->cnt++;
+}
+
+/**
+ * Check if an area of a widget is fully covered by an occluder which is drawn after the widget.
+ * @param occ       the collected occluders
+ * @param area      the area to check
+ * @param obj       the widget whose area is checked. Its children don't hide it, as its post draw is above them
+ * @return          true: the area is covered
+ */
+static bool occlusion_is_covered(lv_refr_occlusion_t * occ, const lv_area_t * area, lv_obj_t * obj)
+{
+    uint32_t i;
+    for(i = 0; i < occ->cnt; i++) {
+        if(occ->passed[i]) continue;
+        if(!lv_area_is_in(area, &occ->areas[i], 0)) continue;
+        if(obj_is_ancestor(obj, occ->objs[i])) continue;
+        return true;
+    }
+
+    return false;
+}
+
+static bool obj_is_ancestor(const lv_obj_t * ancestor, const lv_obj_t * obj)
+{
+    obj = lv_obj_get_parent(obj);
+    while(obj) {
+        if(obj == ancestor) return true;
+        obj = lv_obj_get_parent(obj);
+    }
+
+    return false;
+}
+
+#endif /*LV_REFR_OCCLUDER_MAX > 0*/
+
 #if LV_DRAW_TRANSFORM_USE_MATRIX
 
 static bool obj_get_matrix(lv_obj_t * obj, lv_matrix_t * matrix)
@@ -1465,8 +1839,12 @@ static void wait_for_flushing(lv_display_t * disp)
 {
     LV_PROFILER_REFR_BEGIN;
     LV_LOG_TRACE("begin");
+#if LV_USE_PROFILER_TIMELINE
+    uint64_t timeline_begin = lv_profiler_timeline_tick_get();
+#endif
 
     lv_display_send_event(disp, LV_EVENT_FLUSH_WAIT_START, NULL);
+    uint32_t wait_start = lv_tick_get();
 
     if(disp->flush_wait_cb) {
         if(disp->flushing) {
@@ -1479,12 +1857,119 @@ static void wait_for_flushing(lv_display_t * disp)
     }
     disp->flushing_last = 0;
 
+    /*Waiting for the display is not part of the render time*/
+    disp->frame_pacing.flush_wait_time += lv_tick_elaps(wait_start);
+
     lv_display_send_event(disp, LV_EVENT_FLUSH_WAIT_FINISH, NULL);
 
+#if LV_USE_PROFILER_TIMELINE
+    lv_profiler_timeline_add(LV_PROFILER_TIMELINE_EVENT_FLUSH_WAIT, NULL, 0, NULL, timeline_begin);
+#endif
+
     LV_LOG_TRACE("end");
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Decide whether the frame should be rendered now or later to be ready just in time for a vsync
+ * @param disp      the display to refresh
+ * @param tmr       the refresh timer of the display
+ * @return          true: rendering is deferred and the timer will be called again
+ */
+static bool frame_pacing_defer(lv_display_t * disp, lv_timer_t * tmr)
+{
+    lv_display_frame_pacing_t * fp = &disp->frame_pacing;
+    bool force = fp->force;
+    fp->force = 0;
+    fp->paced = 0;
+
+    if(!fp->enabled) return false;
+
+    /*Restore the period if the start of the previous frame was deferred*/
+    lv_timer_set_period(tmr, fp->refr_period);
+
+    uint32_t now = lv_tick_get();
+    fp->frame_start = now;
+    fp->flush_wait_time = 0;
+
+    if(force || disp->inv_p == 0 || !fp->vsync_valid || fp->vsync_period == 0) return false;
+
+    /*Predict the render time from the slowest recent frame. +1 for the ms resolution of the ticks.*/
+    uint32_t render_time = 0;
+    uint32_t i;
+    for(i = 0; i < LV_FRAME_PACING_HISTORY; i++) {
+        render_time = LV_MAX(render_time, fp->render_times[i]);
+    }
+    render_time++;
+    fp->info.render_time = render_time;
+
+    /*A vsync can show only one frame, so skip the vsync the previous frame is waiting for*/
+    uint32_t earliest = now;
+    if(fp->present_pending && (int32_t)(fp->info.present_time - earliest) >= 0) {
+        earliest = fp->info.present_time + 1;
+    }
+
+    /*Rather skip vsyncs on purpose than be late*/
+    uint32_t present = frame_pacing_next_vsync(fp, earliest + render_time);
+    uint32_t start = present - render_time;
+    int32_t defer = (int32_t)(start - now);
+
+    /*Normally it's less than 2 vsync periods. If it's more, the vsync timestamps are probably
+     *not in `lv_tick_get()` units. Don't wait for them until a new vsync is reported.*/
+    if(defer > (int32_t)((2 * fp->vsync_period + 999) / 1000 + 1)) {
+        LV_LOG_WARN("The reported vsync is %" LV_PRId32 " ms in the future, frame pacing is suspended",
+                    (int32_t)(fp->vsync_time - now));
+        fp->vsync_valid = 0;
+        return false;
+    }
+
+    if(defer > 0) {
+        lv_timer_set_period(tmr, defer);
+        return true;
+    }
+
+    uint32_t first = frame_pacing_next_vsync(fp, earliest);
+    fp->info.skipped_cnt += (uint32_t)(((uint64_t)(present - first) * 1000 + fp->vsync_period / 2) / fp->vsync_period);
+    fp->info.present_time = present;
+    fp->paced = 1;
+
+    return false;
+}
+
+/**
+ * Save the render time of a frame for the prediction of the next ones
+ * @param disp      the refreshed display
+ */
+static void frame_pacing_rendered(lv_display_t * disp)
+{
+    lv_display_frame_pacing_t * fp = &disp->frame_pacing;
+    if(!fp->enabled) return;
+
+    uint32_t elaps = lv_tick_elaps(fp->frame_start);
+    fp->render_times[fp->render_time_idx] = elaps > fp->flush_wait_time ? elaps - fp->flush_wait_time : 0;
+    fp->render_time_idx = (fp->render_time_idx + 1) % LV_FRAME_PACING_HISTORY;
+
+    if(fp->paced) fp->present_pending = 1;
+}
+
+/**
+ * Get the first vsync which is not earlier than a given time
+ * @param fp        the frame pacing state of the display
+ * @param tick      the time to search from
+ * @return          the tick of the vsync
+ */
+static uint32_t frame_pacing_next_vsync(const lv_display_frame_pacing_t * fp, uint32_t tick)
+{
+    int32_t elaps = (int32_t)(tick - fp->vsync_time);
+    uint64_t elaps_us = elaps > 0 ? (uint64_t)elaps * 1000 : 0;
+
+    /*The last reported vsync has already passed, so the next one is at least 1 period later*/
+    uint64_t period_cnt = (elaps_us + fp->vsync_period - 1) / fp->vsync_period;
+    if(period_cnt == 0) period_cnt = 1;
+
+    return fp->vsync_time + (uint32_t)(period_cnt * fp->vsync_period / 1000);
+}
+
 static void call_sync_cb(lv_display_t * disp, const lv_area_t * area)
 {
     LV_PROFILER_REFR_BEGIN;
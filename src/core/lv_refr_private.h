@@ -24,6 +24,17 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** The opaque widgets of a layer, collected from front to back before drawing the layer*/
+struct _lv_refr_occlusion_t {
+    lv_layer_t * layer;                         /**< The occluders hide only the widgets drawn on this layer*/
+#if LV_REFR_OCCLUDER_MAX > 0
+    uint32_t cnt;
+    lv_obj_t * objs[LV_REFR_OCCLUDER_MAX];
+    lv_area_t areas[LV_REFR_OCCLUDER_MAX];  /**< The opaque and visible area of the occluders*/
+    bool passed[LV_REFR_OCCLUDER_MAX];      /**< The widget is already drawn so it's not above the next widgets*/
+#endif
+};
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -286,6 +286,9 @@ static void perf_dump_info(lv_display_t * disp)
                                                                      info->measured.flush_in_render_elaps_sum) /
                                                                     info->measured.render_cnt) : 0;
 
+    info->calculated.dispatch_avg_time = info->measured.render_cnt ?
+                                         (info->measured.dispatch_elaps_sum / info->measured.render_cnt) : 0;
+
     info->calculated.cpu_avg_total = ((info->calculated.cpu_avg_total * (info->calculated.run_cnt - 1)) +
                                       info->calculated.cpu) / info->calculated.run_cnt;
     info->calculated.fps_avg_total = ((info->calculated.fps_avg_total * (info->calculated.run_cnt - 1)) +
@@ -322,19 +325,19 @@ static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
 #if LV_SYSMON_PROC_IDLE_AVAILABLE
     LV_LOG("sysmon: "
            "%" LV_PRIu32 " FPS (refr_cnt: %" LV_PRIu32 " | redraw_cnt: %" LV_PRIu32"), "
-           "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms), "
+           "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms | dispatch %" LV_PRIu32 "ms), "
            "CPU (total %" LV_PRIu32 "%% proc %" LV_PRIu32 "%%)\n",
            perf->calculated.fps, perf->measured.refr_cnt, perf->measured.render_cnt,
            perf->calculated.refr_avg_time, perf->calculated.render_avg_time, perf->calculated.flush_avg_time,
-           perf->calculated.cpu, perf->calculated.cpu_proc);
+           perf->calculated.dispatch_avg_time, perf->calculated.cpu, perf->calculated.cpu_proc);
 #else
     LV_LOG("sysmon: "
            "%" LV_PRIu32 " FPS (refr_cnt: %" LV_PRIu32 " | redraw_cnt: %" LV_PRIu32"), "
-           "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms), "
+           "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms | dispatch %" LV_PRIu32 "ms), "
            "CPU %" LV_PRIu32 "%%\n",
            perf->calculated.fps, perf->measured.refr_cnt, perf->measured.render_cnt,
            perf->calculated.refr_avg_time, perf->calculated.render_avg_time, perf->calculated.flush_avg_time,
-           perf->calculated.cpu);
+           perf->calculated.dispatch_avg_time, perf->calculated.cpu);
 #endif
 #else
     lv_obj_t * label = lv_observer_get_target(observer);
@@ -399,12 +402,26 @@ static void mem_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
     size_t used_kb_tenth = (used_size - (used_kb * 1024)) / 102;
     size_t max_used_kb = mon->max_used / 1024;
     size_t max_used_kb_tenth = (mon->max_used - (max_used_kb * 1024)) / 102;
+#if LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    uint32_t style_cache_used;
+    uint32_t style_cache_size;
+    lv_obj_style_get_resolved_cache_usage(&style_cache_used, &style_cache_size);
+    lv_label_set_text_fmt(label,
+                          "%zu.%zu kB (%d%%)\n"
+                          "%zu.%zu kB max, %d%% frag.\n"
+                          "style cache: %" LV_PRIu32 "/%d, %" LV_PRIu32 " kB",
+                          used_kb, used_kb_tenth, mon->used_pct,
+                          max_used_kb, max_used_kb_tenth,
+                          mon->frag_pct,
+                          style_cache_used, LV_OBJ_STYLE_RESOLVED_CACHE_CNT, style_cache_size / 1024);
+#else
     lv_label_set_text_fmt(label,
                           "%zu.%zu kB (%d%%)\n"
                           "%zu.%zu kB max, %d%% frag.",
                           used_kb, used_kb_tenth, mon->used_pct,
                           max_used_kb, max_used_kb_tenth,
                           mon->frag_pct);
+#endif
 }
 
 #endif
@@ -46,8 +46,10 @@ struct _lv_sysmon_perf_info_t {
         uint32_t flush_in_render_elaps_sum;
         uint32_t flush_not_in_render_start;
         uint32_t flush_not_in_render_elaps_sum;
+        uint32_t dispatch_elaps_sum;    /*Time spent in `lv_draw_dispatch()`*/
         uint32_t last_report_timestamp;
         uint32_t render_in_progress : 1;
+        uint32_t dispatch_in_progress : 1;
     } measured;
 
     struct {
@@ -59,6 +61,8 @@ struct _lv_sysmon_perf_info_t {
         uint32_t refr_avg_time;
         uint32_t render_avg_time;       /**< Pure rendering time without flush time*/
         uint32_t flush_avg_time;        /**< Pure flushing time without rendering time*/
+        uint32_t dispatch_avg_time;     /**< Time spent with dispatching draw tasks per frame.
+                                         *   Includes the rendering time of the draw units which don't use threads.*/
         uint32_t cpu_avg_total;
         uint32_t fps_avg_total;
         uint32_t run_cnt;
@@ -9,6 +9,7 @@
 #include "../display/lv_display_private.h"
 #include "../misc/lv_event_private.h"
 #include "../misc/lv_anim_private.h"
+#include "../misc/lv_timer_private.h"
 #include "../draw/lv_draw_private.h"
 #include "../core/lv_obj_private.h"
 #include "lv_display.h"
@@ -98,6 +99,7 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
 #else
     disp->tile_cnt = 1;
 #endif
+    disp->tile_mode = LV_DISPLAY_TILE_MODE_AUTO;
 
     disp->layer_head = lv_malloc(sizeof(lv_layer_t));
     LV_ASSERT_MALLOC(disp->layer_head);
@@ -115,6 +117,10 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->last_activity_time = lv_tick_get();
 
     lv_ll_init(&disp->sync_areas, sizeof(lv_area_t));
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_ll_init(&disp->stale_areas[i], sizeof(lv_area_t));
+    }
 
     lv_display_t * disp_def_tmp = disp_def;
     disp_def                 = disp; /*Temporarily change the default screen to create the default screens on the
@@ -236,6 +242,11 @@ void lv_display_delete(lv_display_t * disp)
     }
 
     lv_ll_clear(&disp->sync_areas);
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_ll_clear(&disp->stale_areas[i]);
+    }
+    lv_free(disp->inv_areas);   /*`inv_area_joined` is in the same allocation*/
     lv_ll_remove(disp_ll_p, disp);
     if(disp->refr_timer) lv_timer_delete(disp->refr_timer);
 
@@ -643,6 +654,101 @@ uint32_t lv_display_get_tile_cnt(lv_display_t * disp)
     return disp->tile_cnt;
 }
 
+void lv_display_set_tile_mode(lv_display_t * disp, lv_display_tile_mode_t mode)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->tile_mode = mode;
+}
+
+lv_display_tile_mode_t lv_display_get_tile_mode(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return LV_DISPLAY_TILE_MODE_AUTO;
+
+    return disp->tile_mode;
+}
+
+void lv_display_get_overdraw_info(lv_display_t * disp, lv_display_overdraw_info_t * info)
+{
+    LV_ASSERT_NULL(info);
+    lv_memzero(info, sizeof(lv_display_overdraw_info_t));
+
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    *info = disp->overdraw_info;
+}
+
+void lv_display_set_frame_pacing(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    lv_display_frame_pacing_t * fp = &disp->frame_pacing;
+    if(fp->enabled == en) return;
+
+    if(en) {
+        fp->refr_period = disp->refr_timer ? disp->refr_timer->period : LV_DEF_REFR_PERIOD;
+        lv_memzero(fp->render_times, sizeof(fp->render_times));
+        lv_memzero(&fp->info, sizeof(fp->info));
+    }
+    else if(disp->refr_timer) {
+        /*The period might be changed to defer the start of a frame*/
+        lv_timer_set_period(disp->refr_timer, fp->refr_period);
+    }
+
+    fp->enabled = en;
+    fp->paced = 0;
+    fp->present_pending = 0;
+}
+
+bool lv_display_get_frame_pacing(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->frame_pacing.enabled;
+}
+
+void lv_display_set_vsync_period(lv_display_t * disp, uint32_t period_us)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->frame_pacing.vsync_period = period_us;
+}
+
+void lv_display_report_vsync(lv_display_t * disp, uint32_t timestamp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    lv_display_frame_pacing_t * fp = &disp->frame_pacing;
+
+    /*The rendered frame is shown on the first vsync after it*/
+    if(fp->present_pending) {
+        int32_t delay = (int32_t)(timestamp - fp->info.present_time);
+        if(delay > 0 && (uint32_t)delay * 1000 > fp->vsync_period / 2) fp->info.late_cnt++;
+        fp->present_pending = 0;
+    }
+
+    fp->vsync_time = timestamp;
+    fp->vsync_valid = 1;
+}
+
+void lv_display_get_frame_pacing_info(lv_display_t * disp, lv_display_frame_pacing_info_t * info)
+{
+    LV_ASSERT_NULL(info);
+    lv_memzero(info, sizeof(lv_display_frame_pacing_info_t));
+
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    *info = disp->frame_pacing.info;
+}
+
 void lv_display_set_antialiasing(lv_display_t * disp, bool en)
 {
     LV_LOG_WARN("Disabling anti-aliasing is not supported since v9. This function will be removed.");
@@ -1412,9 +1518,12 @@ static void update_resolution(lv_display_t * disp)
     lv_area_set_height(&disp->bottom_layer->coords, ver_res);
     lv_obj_send_event(disp->bottom_layer, LV_EVENT_SIZE_CHANGED, &prev_coords);
 
-    lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
-    lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
+    if(disp->inv_p) {
+        lv_memzero(disp->inv_areas, disp->inv_p * sizeof(lv_area_t));
+        lv_memzero(disp->inv_area_joined, disp->inv_p);
+    }
     disp->inv_p = 0;
+    lv_obj_invalidation_coalescing_reset();
     lv_obj_invalidate(disp->sys_layer);
 
     lv_obj_tree_walk(NULL, invalidate_layout_cb, NULL);
@@ -59,6 +59,20 @@ typedef enum {
     LV_DISPLAY_RENDER_MODE_FULL,
 } lv_display_render_mode_t;
 
+typedef enum {
+    /**
+     * Divide an area into tiles only if it's large compared to the draw buffer.
+     * The number of tiles is proportional to the size of the area.
+     */
+    LV_DISPLAY_TILE_MODE_AUTO,
+
+    /**
+     * Always divide the areas into `tile_cnt` horizontal tiles (if they are high enough).
+     * Useful if the draw units can render in parallel and even small areas are expensive to render.
+     */
+    LV_DISPLAY_TILE_MODE_ALWAYS,
+} lv_display_tile_mode_t;
+
 typedef enum {
     LV_SCREEN_LOAD_ANIM_NONE,
     LV_SCREEN_LOAD_ANIM_OVER_LEFT,
@@ -78,6 +92,28 @@ typedef enum {
     LV_SCREEN_LOAD_ANIM_OUT_BOTTOM,
 } lv_screen_load_anim_t;
 
+/**
+ * Statistics about the widgets drawn in the last refreshed frame.
+ * `drawn_px / refr_px` tells how many times a pixel was covered by widgets on average.
+ */
+typedef struct {
+    uint32_t refr_px;       /**< Number of refreshed pixels*/
+    uint32_t drawn_px;      /**< Sum of the visible area of the widgets drawn directly on the display*/
+    uint32_t culled_px;     /**< Sum of the visible area of the widgets skipped as opaque widgets hid them*/
+    uint32_t culled_cnt;    /**< Number of widgets skipped as opaque widgets hid them*/
+} lv_display_overdraw_info_t;
+
+/**
+ * State of the frame pacing of a display.
+ * All times are in `lv_tick_get()` units (ms).
+ */
+typedef struct {
+    uint32_t render_time;   /**< Predicted time needed to render the next frame*/
+    uint32_t present_time;  /**< The vsync the last rendered frame was scheduled for*/
+    uint32_t skipped_cnt;   /**< Number of vsyncs skipped on purpose as a frame couldn't be ready in time*/
+    uint32_t late_cnt;      /**< Number of frames presented after the vsync they were scheduled for*/
+} lv_display_frame_pacing_info_t;
+
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 typedef void (*lv_display_sync_cb_t)(lv_display_t * disp, const lv_area_t * area);
@@ -376,6 +412,68 @@ void lv_display_set_tile_cnt(lv_display_t * disp, uint32_t tile_cnt);
  */
 uint32_t lv_display_get_tile_cnt(lv_display_t * disp);
 
+/**
+ * Set how the areas are divided into tiles for parallel rendering.
+ * @param disp              pointer to a display
+ * @param mode              LV_DISPLAY_TILE_MODE_AUTO or LV_DISPLAY_TILE_MODE_ALWAYS
+ */
+void lv_display_set_tile_mode(lv_display_t * disp, lv_display_tile_mode_t mode);
+
+/**
+ * Get how the areas are divided into tiles for parallel rendering.
+ * @param disp              pointer to a display
+ * @return                  the tile mode
+ */
+lv_display_tile_mode_t lv_display_get_tile_mode(lv_display_t * disp);
+
+/**
+ * Get the overdraw statistics of the last refreshed frame.
+ * Widgets fully hidden by opaque widgets above them are not drawn and counted as culled.
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @param info              store the statistics here
+ */
+void lv_display_get_overdraw_info(lv_display_t * disp, lv_display_overdraw_info_t * info);
+
+/**
+ * Enable or disable frame pacing. When enabled, the refresh timer doesn't render as soon as
+ * something is invalidated, but starts just in time to be ready before the next vsync, based on
+ * the render time of the recent frames. If a frame couldn't be ready for the next vsync it's
+ * scheduled for a later one, and the animations are updated to the time of that vsync.
+ * It takes effect only if the vsync period is set and vsyncs are reported by the driver.
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @param en                true: enable frame pacing; false: refresh as soon as possible
+ */
+void lv_display_set_frame_pacing(lv_display_t * disp, bool en);
+
+/**
+ * Get whether frame pacing is enabled
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @return                  true: frame pacing is enabled
+ */
+bool lv_display_get_frame_pacing(lv_display_t * disp);
+
+/**
+ * Set the time between two vsyncs of the display. Typically called by the display driver.
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @param period_us         the vsync period in microseconds, e.g. 16667 for 60 Hz. 0: unknown
+ */
+void lv_display_set_vsync_period(lv_display_t * disp, uint32_t period_us);
+
+/**
+ * Tell the display when a vsync happened. Typically called by the display driver,
+ * e.g. when a page flip is completed.
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @param timestamp         time of the vsync in `lv_tick_get()` units
+ */
+void lv_display_report_vsync(lv_display_t * disp, uint32_t timestamp);
+
+/**
+ * Get the state of the frame pacing
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @param info              store the state here
+ */
+void lv_display_get_frame_pacing_info(lv_display_t * disp, lv_display_frame_pacing_info_t * info);
+
 /**
  * Disabling anti-aliasing is not supported since v9. This function will be removed.
  * Enable anti-aliasing for the render engine
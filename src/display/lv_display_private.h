@@ -27,13 +27,41 @@ extern "C" {
  *      DEFINES
  *********************/
 #ifndef LV_INV_BUF_SIZE
-#define LV_INV_BUF_SIZE 32 /**< Buffer size for invalid areas */
+#define LV_INV_BUF_SIZE 32 /**< Initial buffer size for invalid areas */
+#endif
+
+#ifndef LV_INV_BUF_SIZE_MAX
+#define LV_INV_BUF_SIZE_MAX 256 /**< The buffer of invalid areas grows up to this size. Then new areas are merged into the existing ones*/
+#endif
+
+#ifndef LV_INV_AREA_COST
+#define LV_INV_AREA_COST 1024 /**< Overhead of refreshing an area (draw task creation, flush setup, etc.) in pixels*/
+#endif
+
+#ifndef LV_FRAME_PACING_HISTORY
+#define LV_FRAME_PACING_HISTORY 8 /**< Predict the render time from this many recent frames*/
 #endif
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t vsync_period;      /**< Time between two vsyncs in microseconds. 0: unknown*/
+    uint32_t vsync_time;        /**< Tick of the last reported vsync*/
+    uint32_t refr_period;       /**< Period of the refresh timer to restore after a deferred start*/
+    uint32_t frame_start;       /**< Tick when rendering of the current frame started*/
+    uint32_t flush_wait_time;   /**< Time spent waiting for flushing in the current frame*/
+    uint32_t render_times[LV_FRAME_PACING_HISTORY]; /**< Render time of the recent frames*/
+    uint32_t render_time_idx;
+    lv_display_frame_pacing_info_t info;
+    uint32_t enabled        : 1;
+    uint32_t vsync_valid    : 1; /**< 1: `vsync_time` was reported*/
+    uint32_t paced          : 1; /**< 1: the current frame was scheduled to `info.present_time`*/
+    uint32_t present_pending : 1; /**< 1: a frame was rendered but its vsync wasn't reported yet*/
+    uint32_t force          : 1; /**< 1: render the next frame immediately (set by `lv_refr_now`)*/
+} lv_display_frame_pacing_t;
+
 struct _lv_display_t {
 #if LV_USE_EXT_DATA
     lv_ext_data_t ext_data;
@@ -115,7 +143,12 @@ struct _lv_display_t {
     /** Sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
 
+    /** Areas of `buf_1`, `buf_2` and `buf_3` which were redrawn in other buffers since they were rendered.
+     * Used in double buffered direct mode. The areas of a buffer don't overlap. */
+    lv_ll_t stale_areas[3];
+
     lv_display_render_mode_t render_mode;
+    lv_display_tile_mode_t tile_mode;
     uint32_t antialiasing : 1;       /**< 1: anti-aliasing is enabled on this display.*/
     uint32_t tile_cnt     : 8;       /**< Divide the display buffer into these number of tiles */
     uint32_t stride_is_auto : 1;     /**< 1: The stride of the buffers was not set explicitly. */
@@ -126,10 +159,11 @@ struct _lv_display_t {
 
     lv_color_format_t   color_format;
 
-    /** Invalidated (marked to redraw) areas*/
-    lv_area_t inv_areas[LV_INV_BUF_SIZE];
-    uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+    /** Invalidated (marked to redraw) areas. Allocated on demand and grows if needed.*/
+    lv_area_t * inv_areas;
+    uint8_t * inv_area_joined;
     uint32_t inv_p;
+    uint32_t inv_area_cap;      /**< Number of areas `inv_areas` and `inv_area_joined` can store*/
     int32_t inv_en_cnt;
 
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
@@ -183,6 +217,11 @@ struct _lv_display_t {
     lv_area_t refreshed_area;
     uint32_t vsync_count;
 
+    /** Opaque widgets of the layer being refreshed which can hide the widgets below them*/
+    lv_refr_occlusion_t * occlusion;
+    lv_display_overdraw_info_t overdraw_info; /**< Statistics of the last refreshed frame*/
+    lv_display_frame_pacing_t frame_pacing;
+
 #if LV_USE_PERF_MONITOR
     lv_obj_t * perf_label;
     lv_sysmon_backend_data_t perf_sysmon_backend;
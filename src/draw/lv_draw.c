@@ -13,6 +13,7 @@
 #include "../misc/lv_area_private.h"
 #include "../misc/lv_assert.h"
 #include "../misc/lv_event_private.h"
+#include "../misc/lv_profiler_timeline.h"
 #include "lv_draw_private.h"
 #include "lv_draw_mask.h"
 #include "lv_draw_vector_private.h"
@@ -22,23 +23,62 @@
 #include "../core/lv_global.h"
 #include "../core/lv_refr_private.h"
 #include "../stdlib/lv_string.h"
+#include "../stdlib/lv_mem_slab.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+/*Create the spatial index of a layer only if it has at least this many draw tasks*/
+#define TASK_INDEX_TASK_CNT_MIN     32
+
+/*The cells are at least (1 << TASK_INDEX_CELL_SHIFT_MIN) pixels large*/
+#define TASK_INDEX_CELL_SHIFT_MIN   4
+
+/*Maximal number of cells in a row or column on the finest level*/
+#define TASK_INDEX_CELL_CNT_MAX     16
+
+/*Enough levels to get from TASK_INDEX_CELL_CNT_MAX cells to a single cell*/
+#define TASK_INDEX_LEVEL_MAX        5
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Loose grid of the draw tasks of a layer. The cells on each level are twice as large as
+ * on the previous level. A draw task is stored on the finest level where it's not larger than a cell,
+ * in the cell of its top left corner. This way it can reach only the next cell in each direction.
+ */
+struct _lv_draw_task_index_t {
+    lv_area_t area;                                 /**< The indexed area, i.e. `buf_area` of the layer*/
+    lv_draw_task_t ** cells[TASK_INDEX_LEVEL_MAX];  /**< Heads of the draw task lists of the cells, row by row*/
+    uint16_t col_cnt[TASK_INDEX_LEVEL_MAX];
+    uint16_t row_cnt[TASK_INDEX_LEVEL_MAX];
+    uint8_t cell_shift;                             /**< The cells are (1 << cell_shift) large on the first level*/
+    uint8_t level_cnt;
+};
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id);
+static bool is_dependent_on(const lv_draw_task_t * t, const lv_draw_task_t * t_check, uint8_t draw_unit_id);
+static void task_index_create(lv_layer_t * layer);
+static void task_index_delete(lv_layer_t * layer);
+static void task_index_insert(lv_draw_task_index_t * index, lv_draw_task_t * t);
+static void task_index_remove(lv_draw_task_t * t);
+static void task_index_get_rel_area(const lv_draw_task_index_t * index, const lv_area_t * area, lv_area_t * rel_area);
 static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
 static inline size_t get_draw_dsc_size(lv_draw_task_type_t type);
+static inline size_t get_draw_task_size(lv_draw_task_type_t type);
+static lv_draw_task_t * task_alloc(lv_draw_task_type_t type);
+static void task_free(lv_draw_task_t * t);
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer);
+static void record_task(lv_draw_record_t * rec, const lv_draw_task_t * t);
+static void copy_draw_dsc(lv_draw_task_t * t_dest, const lv_draw_task_t * t_src);
+static void free_draw_dsc_data(lv_draw_task_t * t);
 
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
@@ -64,6 +104,8 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+
+    lv_draw_arena_init();
 }
 
 void lv_draw_deinit(void)
@@ -81,6 +123,8 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+    lv_draw_arena_deinit();
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -102,7 +146,7 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     LV_PROFILER_DRAW_BEGIN;
     size_t dsc_size = get_draw_dsc_size(type);
     LV_ASSERT_FORMAT_MSG(dsc_size > 0, "Draw task size is 0 for type %d", type);
-    lv_draw_task_t * new_task = lv_malloc_zeroed(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
+    lv_draw_task_t * new_task = task_alloc(type);
     LV_ASSERT_MALLOC(new_task);
     new_task->area = *coords;
     new_task->_real_area = *coords;
@@ -115,6 +159,7 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     new_task->type = type;
     new_task->draw_dsc = (uint8_t *)new_task + LV_ALIGN_UP(sizeof(lv_draw_task_t), 8);
     new_task->state = LV_DRAW_TASK_STATE_WAITING;
+    new_task->order = _draw_info.task_order_cnt++;
 
     /*Find the tail*/
     if(layer->draw_task_head == NULL) {
@@ -139,6 +184,8 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
 
     lv_draw_global_info_t * info = &_draw_info;
 
+    if(info->record && info->task_running == false) record_task(info->record, t);
+
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
      *and not on the draw tasks added in the event.
      *Sending LV_EVENT_DRAW_TASK_ADDED events might cause recursive event sends and besides
@@ -165,6 +212,10 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             }
             u = u->next;
         }
+
+        /*The area of the task is final now so it can be indexed*/
+        if(layer->task_index) task_index_insert(layer->task_index, t);
+
         if(t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE) {
             LV_LOG_WARN("the draw task was not taken by any units");
             t->state = LV_DRAW_TASK_STATE_FINISHED;
@@ -188,6 +239,8 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             }
             u = u->next;
         }
+
+        if(layer->task_index) task_index_insert(layer->task_index, t);
     }
     LV_PROFILER_DRAW_END;
 }
@@ -217,12 +270,27 @@ void lv_draw_dispatch(void)
     bool task_dispatched = false;
     lv_display_t * disp = lv_refr_get_disp_refreshing();
     if(disp != NULL) {
+#if LV_USE_PERF_MONITOR
+        /*Measure only the outermost call as dispatching can be nested*/
+        bool measure = !disp->perf_sysmon_info.measured.dispatch_in_progress;
+        uint32_t dispatch_start = 0;
+        if(measure) {
+            disp->perf_sysmon_info.measured.dispatch_in_progress = 1;
+            dispatch_start = lv_tick_get();
+        }
+#endif
         lv_layer_t * layer = disp->layer_head;
         while(layer) {
             if(lv_draw_dispatch_layer(disp, layer))
                 task_dispatched = true;
             layer = layer->next;
         }
+#if LV_USE_PERF_MONITOR
+        if(measure) {
+            disp->perf_sysmon_info.measured.dispatch_elaps_sum += lv_tick_elaps(dispatch_start);
+            disp->perf_sysmon_info.measured.dispatch_in_progress = 0;
+        }
+#endif
     }
     if(!task_dispatched) {
         lv_draw_wait_for_finish();
@@ -242,6 +310,7 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
     while(t) {
         t_next = t->next;
         if(t->state == LV_DRAW_TASK_STATE_FINISHED) {
+            task_index_remove(t);
             cleanup_task(t, disp);
             remove_task = true;
             if(t_prev != NULL)
@@ -255,6 +324,8 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         t = t_next;
     }
 
+    if(layer->draw_task_head == NULL && layer->task_index) task_index_delete(layer);
+
     bool task_dispatched = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -348,6 +419,17 @@ lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_tas
         }
     }
 
+    /*With many draw tasks index them to avoid comparing each with all the older ones*/
+    if(layer->task_index == NULL) {
+        uint32_t task_cnt = 0;
+        lv_draw_task_t * t = layer->draw_task_head;
+        while(t && task_cnt < TASK_INDEX_TASK_CNT_MIN) {
+            task_cnt++;
+            t = t->next;
+        }
+        if(task_cnt >= TASK_INDEX_TASK_CNT_MIN) task_index_create(layer);
+    }
+
     lv_draw_task_t * t = t_prev ? t_prev->next : layer->draw_task_head;
     while(t) {
         /*Find a draw task for this draw unit which is waiting and independent?*/
@@ -386,6 +468,60 @@ uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check)
     return cnt;
 }
 
+void lv_draw_record_start(lv_draw_record_t * rec, lv_layer_t * layer)
+{
+    LV_ASSERT_NULL(rec);
+    LV_ASSERT_MSG(_draw_info.record == NULL, "Recording is already in progress");
+
+    rec->layer = layer;
+    rec->failed = 0;
+    _draw_info.record = rec;
+}
+
+void lv_draw_record_stop(lv_draw_record_t * rec)
+{
+    if(_draw_info.record == rec) _draw_info.record = NULL;
+}
+
+void lv_draw_record_replay(const lv_draw_record_t * rec, lv_layer_t * layer)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    const lv_draw_task_t * t_rec = rec->task_head;
+    while(t_rec) {
+        /*The widget might have drawn with a smaller clip area, e.g. a label clips its text*/
+        lv_area_t clip_area;
+        if(!lv_area_intersect(&clip_area, &t_rec->clip_area, &layer->_clip_area)) {
+            t_rec = t_rec->next;
+            continue;
+        }
+
+        lv_draw_task_t * t = lv_draw_add_task(layer, &t_rec->area, t_rec->type);
+        t->_real_area = t_rec->_real_area;
+        t->clip_area = clip_area;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+        t->matrix = t_rec->matrix;
+#endif
+        t->opa = t_rec->opa;
+        copy_draw_dsc(t, t_rec);
+        lv_draw_finalize_task_creation(layer, t);
+        t_rec = t_rec->next;
+    }
+    LV_PROFILER_DRAW_END;
+}
+
+void lv_draw_record_reset(lv_draw_record_t * rec)
+{
+    lv_draw_task_t * t = rec->task_head;
+    while(t) {
+        lv_draw_task_t * t_next = t->next;
+        free_draw_dsc_data(t);
+        task_free(t);
+        t = t_next;
+    }
+    rec->task_head = NULL;
+    rec->failed = 0;
+}
+
 void lv_draw_unit_send_event(const char * name, lv_event_code_t code, void * param)
 {
     LV_PROFILER_DRAW_BEGIN;
@@ -500,6 +636,10 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     }
 #endif
 
+#if LV_USE_PROFILER_TIMELINE
+    uint64_t timeline_begin = lv_profiler_timeline_tick_get();
+#endif
+
     layer->draw_buf = lv_draw_buf_create(w, h, layer->color_format, 0);
 
     if(layer->draw_buf == NULL) {
@@ -515,6 +655,11 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
         lv_draw_buf_clear(layer->draw_buf, NULL);
     }
 
+#if LV_USE_PROFILER_TIMELINE
+    lv_profiler_timeline_add(LV_PROFILER_TIMELINE_EVENT_LAYER_ALLOC, NULL, layer_size_byte, &layer->buf_area,
+                             timeline_begin);
+#endif
+
     LV_PROFILER_DRAW_END;
     return layer->draw_buf->data;
 }
@@ -588,28 +733,220 @@ void lv_draw_layer_finish_drop_shadow(lv_layer_t * drop_shadow_layer, const lv_d
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id)
 {
     LV_PROFILER_DRAW_BEGIN;
-    lv_draw_task_t * t = layer->draw_task_head;
+    lv_draw_task_index_t * index = layer->task_index;
 
-    /*If t_check is outside of the older tasks then it's independent*/
-    while(t && t != t_check) {
-        /*It's independent of finished draw tasks, and queued draw tasks of the same draw unit,
-         *so no need to check it*/
-        if(t->state == LV_DRAW_TASK_STATE_FINISHED ||
-           (t->state == LV_DRAW_TASK_STATE_QUEUED && t->preferred_draw_unit_id == draw_unit_id)) {
+    /*Without index compare with all the older tasks*/
+    if(index == NULL || t_check->index_cell == NULL) {
+        lv_draw_task_t * t = layer->draw_task_head;
+        while(t && t != t_check) {
+            if(is_dependent_on(t, t_check, draw_unit_id)) {
+                LV_PROFILER_DRAW_END;
+                return false;
+            }
             t = t->next;
-            continue;
         }
+        LV_PROFILER_DRAW_END;
+        return true;
+    }
 
-        lv_area_t a;
-        if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) {
-            LV_PROFILER_DRAW_END;
-            return false;
+    /*With index compare only with the tasks in the cells around the area of `t_check`*/
+    lv_area_t rel_area;
+    task_index_get_rel_area(index, &t_check->_real_area, &rel_area);
+
+    uint32_t level;
+    for(level = 0; level < index->level_cnt; level++) {
+        uint32_t shift = index->cell_shift + level;
+        int32_t col_cnt = index->col_cnt[level];
+        int32_t row_cnt = index->row_cnt[level];
+
+        /*The tasks in the previous column and row can also reach the area*/
+        int32_t col_start = LV_MAX((rel_area.x1 >> shift) - 1, 0);
+        int32_t col_end = LV_MIN(rel_area.x2 >> shift, col_cnt - 1);
+        int32_t row_start = LV_MAX((rel_area.y1 >> shift) - 1, 0);
+        int32_t row_end = LV_MIN(rel_area.y2 >> shift, row_cnt - 1);
+
+        int32_t row;
+        for(row = row_start; row <= row_end; row++) {
+            lv_draw_task_t ** cells = &index->cells[level][row * col_cnt];
+            int32_t col;
+            for(col = col_start; col <= col_end; col++) {
+                lv_draw_task_t * t = cells[col];
+                while(t) {
+                    /*Only the older tasks matter. (Wrap around safe comparison.)*/
+                    if((int32_t)(t->order - t_check->order) < 0 && is_dependent_on(t, t_check, draw_unit_id)) {
+                        LV_PROFILER_DRAW_END;
+                        return false;
+                    }
+                    t = t->index_next;
+                }
+            }
         }
+    }
+
+    LV_PROFILER_DRAW_END;
+    return true;
+}
+
+/**
+ * Check if an older draw task blocks `t_check`
+ * @param t             an older draw task
+ * @param t_check       the draw task to check
+ * @param draw_unit_id  draw unit ID for which the independence check is called
+ * @return              true: `t_check` needs to wait for `t`
+ */
+static bool is_dependent_on(const lv_draw_task_t * t, const lv_draw_task_t * t_check, uint8_t draw_unit_id)
+{
+    /*It's independent of finished draw tasks, and queued draw tasks of the same draw unit,
+     *so no need to check it*/
+    if(t->state == LV_DRAW_TASK_STATE_FINISHED ||
+       (t->state == LV_DRAW_TASK_STATE_QUEUED && t->preferred_draw_unit_id == draw_unit_id)) {
+        return false;
+    }
+
+    lv_area_t a;
+    return lv_area_intersect(&a, &t->_real_area, &t_check->_real_area);
+}
+
+/**
+ * Create the spatial index of a layer and add its current draw tasks
+ * @param layer     pointer to a layer
+ */
+static void task_index_create(lv_layer_t * layer)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    int32_t w = lv_area_get_width(&layer->buf_area);
+    int32_t h = lv_area_get_height(&layer->buf_area);
+    if(w <= 0 || h <= 0) {
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    /*Use the smallest cells which still result in at most TASK_INDEX_CELL_CNT_MAX columns and rows*/
+    uint32_t cell_shift = TASK_INDEX_CELL_SHIFT_MIN;
+    while((TASK_INDEX_CELL_CNT_MAX << cell_shift) < LV_MAX(w, h)) cell_shift++;
+
+    /*Add coarser levels until a single cell covers the whole layer*/
+    uint32_t col_cnt[TASK_INDEX_LEVEL_MAX];
+    uint32_t row_cnt[TASK_INDEX_LEVEL_MAX];
+    uint32_t cell_cnt = 0;
+    uint32_t level_cnt = 0;
+    while(level_cnt < TASK_INDEX_LEVEL_MAX) {
+        uint32_t shift = cell_shift + level_cnt;
+        col_cnt[level_cnt] = ((w - 1) >> shift) + 1;
+        row_cnt[level_cnt] = ((h - 1) >> shift) + 1;
+        cell_cnt += col_cnt[level_cnt] * row_cnt[level_cnt];
+        level_cnt++;
+        if(col_cnt[level_cnt - 1] == 1 && row_cnt[level_cnt - 1] == 1) break;
+    }
+
+    lv_draw_task_index_t * index = lv_malloc_zeroed(sizeof(lv_draw_task_index_t) + cell_cnt * sizeof(lv_draw_task_t *));
+    LV_ASSERT_MALLOC(index);
+    if(index == NULL) {
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    index->area = layer->buf_area;
+    index->cell_shift = (uint8_t)cell_shift;
+    index->level_cnt = (uint8_t)level_cnt;
+
+    lv_draw_task_t ** cells = (lv_draw_task_t **)(index + 1);
+    uint32_t i;
+    for(i = 0; i < level_cnt; i++) {
+        index->cells[i] = cells;
+        index->col_cnt[i] = (uint16_t)col_cnt[i];
+        index->row_cnt[i] = (uint16_t)row_cnt[i];
+        cells += col_cnt[i] * row_cnt[i];
+    }
+
+    layer->task_index = index;
+
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        task_index_insert(index, t);
         t = t->next;
     }
     LV_PROFILER_DRAW_END;
+}
 
-    return true;
+/**
+ * Delete the spatial index of a layer. The draw tasks are not freed.
+ * @param layer     pointer to a layer
+ */
+static void task_index_delete(lv_layer_t * layer)
+{
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        t->index_cell = NULL;
+        t->index_next = NULL;
+        t->index_prev = NULL;
+        t = t->next;
+    }
+
+    lv_free(layer->task_index);
+    layer->task_index = NULL;
+}
+
+/**
+ * Add a draw task to the index, or move it to the right cell if it's already added
+ * @param index     pointer to an index
+ * @param t         pointer to a draw task
+ */
+static void task_index_insert(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    task_index_remove(t);
+
+    lv_area_t rel_area;
+    task_index_get_rel_area(index, &t->_real_area, &rel_area);
+    int32_t size = LV_MAX(lv_area_get_width(&rel_area), lv_area_get_height(&rel_area));
+
+    /*Find the finest level where the task fits into a cell. The last level is a single cell.*/
+    uint32_t level = 0;
+    while(level < index->level_cnt - 1U && size > (1 << (index->cell_shift + level))) level++;
+
+    uint32_t shift = index->cell_shift + level;
+    lv_draw_task_t ** cell = &index->cells[level][(rel_area.y1 >> shift) * index->col_cnt[level] + (rel_area.x1 >> shift)];
+
+    t->index_cell = cell;
+    t->index_prev = NULL;
+    t->index_next = *cell;
+    if(*cell) (*cell)->index_prev = t;
+    *cell = t;
+}
+
+/**
+ * Remove a draw task from the index of its layer. Does nothing if the task is not indexed.
+ * @param t         pointer to a draw task
+ */
+static void task_index_remove(lv_draw_task_t * t)
+{
+    if(t->index_cell == NULL) return;
+
+    if(t->index_prev) t->index_prev->index_next = t->index_next;
+    else *t->index_cell = t->index_next;
+
+    if(t->index_next) t->index_next->index_prev = t->index_prev;
+
+    t->index_cell = NULL;
+    t->index_next = NULL;
+    t->index_prev = NULL;
+}
+
+/**
+ * Get an area relative to the indexed area and clamped to it.
+ * Clamping keeps the overlapping areas overlapping.
+ * @param index     pointer to an index
+ * @param area      an absolute area
+ * @param rel_area  store the result here
+ */
+static void task_index_get_rel_area(const lv_draw_task_index_t * index, const lv_area_t * area, lv_area_t * rel_area)
+{
+    int32_t x_max = lv_area_get_width(&index->area) - 1;
+    int32_t y_max = lv_area_get_height(&index->area) - 1;
+    rel_area->x1 = LV_CLAMP(0, area->x1 - index->area.x1, x_max);
+    rel_area->y1 = LV_CLAMP(0, area->y1 - index->area.y1, y_max);
+    rel_area->x2 = LV_CLAMP(0, area->x2 - index->area.x1, x_max);
+    rel_area->y2 = LV_CLAMP(0, area->y2 - index->area.y1, y_max);
 }
 
 /**
@@ -666,6 +1003,38 @@ static inline size_t get_draw_dsc_size(lv_draw_task_type_t type)
     return 0;
 }
 
+/**
+ * Get the size of a draw task with its draw descriptor.
+ * The draw tasks are allocated from the slabs as they are created and deleted in every refresh.
+ * @param type      type of the draw task
+ * @return          the size of the draw task in bytes
+ */
+static inline size_t get_draw_task_size(lv_draw_task_type_t type)
+{
+    return LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + get_draw_dsc_size(type);
+}
+
+/**
+ * Allocate a zeroed draw task from the frame arena while refreshing, else from the slabs
+ * @param type      type of the draw task
+ * @return          the new draw task or NULL on failure
+ */
+static lv_draw_task_t * task_alloc(lv_draw_task_type_t type)
+{
+    size_t size = get_draw_task_size(type);
+    lv_draw_task_t * t = lv_draw_arena_alloc(size);
+    if(t == NULL) return lv_malloc_slab_zeroed(size);
+
+    lv_memzero(t, size);
+    return t;
+}
+
+static void task_free(lv_draw_task_t * t)
+{
+    if(lv_draw_arena_contains(t)) lv_draw_arena_free(t);
+    else lv_free_slab(t, get_draw_task_size(t->type));
+}
+
 /**
  * Clean-up resources allocated by a finished task
  * @param t         pointer to a draw task
@@ -719,6 +1088,7 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
                 disp->layer_deinit(disp, layer_drawn);
                 LV_PROFILER_DRAW_END_TAG("layer_deinit");
             }
+            if(layer_drawn->task_index) task_index_delete(layer_drawn);
             lv_free(layer_drawn);
         }
     }
@@ -728,10 +1098,104 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t);
+    task_free(t);
     LV_PROFILER_DRAW_END;
 }
 
+static void record_task(lv_draw_record_t * rec, const lv_draw_task_t * t)
+{
+    if(rec->failed) return;
+
+    /*Only the simple draw tasks can be recorded whose descriptor doesn't reference temporary data*/
+    bool recordable = false;
+    switch(t->type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+        case LV_DRAW_TASK_TYPE_BORDER:
+        case LV_DRAW_TASK_TYPE_BOX_SHADOW:
+        case LV_DRAW_TASK_TYPE_LABEL:
+        case LV_DRAW_TASK_TYPE_IMAGE:
+        case LV_DRAW_TASK_TYPE_ARC:
+        case LV_DRAW_TASK_TYPE_LINE:
+        case LV_DRAW_TASK_TYPE_TRIANGLE:
+            recordable = true;
+            break;
+        default:
+            break;
+    }
+
+    if(!recordable || t->target_layer != rec->layer) {
+        rec->failed = 1;
+        return;
+    }
+
+    lv_draw_task_t * t_rec = lv_malloc_slab_zeroed(get_draw_task_size(t->type));
+    if(t_rec == NULL) {
+        rec->failed = 1;
+        return;
+    }
+
+    t_rec->type = t->type;
+    t_rec->area = t->area;
+    t_rec->_real_area = t->_real_area;
+    t_rec->clip_area = t->clip_area;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    t_rec->matrix = t->matrix;
+#endif
+    t_rec->opa = t->opa;
+    t_rec->draw_dsc = (uint8_t *)t_rec + LV_ALIGN_UP(sizeof(lv_draw_task_t), 8);
+    copy_draw_dsc(t_rec, t);
+
+    /*Keep the order of the draw tasks*/
+    lv_draw_task_t ** tail = &rec->task_head;
+    while(*tail) tail = &(*tail)->next;
+    *tail = t_rec;
+}
+
+/**
+ * Copy the draw descriptor of a draw task to an other draw task of the same type.
+ * The data owned by the descriptor (local text, line points) is duplicated.
+ */
+static void copy_draw_dsc(lv_draw_task_t * t_dest, const lv_draw_task_t * t_src)
+{
+    lv_memcpy(t_dest->draw_dsc, t_src->draw_dsc, get_draw_dsc_size(t_src->type));
+
+    if(t_src->type == LV_DRAW_TASK_TYPE_LABEL) {
+        lv_draw_label_dsc_t * label_dsc = t_dest->draw_dsc;
+        if(label_dsc->text_local && label_dsc->text) {
+            size_t len = lv_strlen(label_dsc->text) + 1;
+            char * text = lv_malloc(len);
+            LV_ASSERT_MALLOC(text);
+            if(text) lv_memcpy(text, label_dsc->text, len);
+            label_dsc->text = text;
+        }
+    }
+    else if(t_src->type == LV_DRAW_TASK_TYPE_LINE) {
+        lv_draw_line_dsc_t * line_dsc = t_dest->draw_dsc;
+        if(line_dsc->points) {
+            size_t size = line_dsc->point_cnt * sizeof(lv_point_precise_t);
+            lv_point_precise_t * points = lv_malloc(size);
+            LV_ASSERT_MALLOC(points);
+            if(points) lv_memcpy(points, line_dsc->points, size);
+            line_dsc->points = points;
+        }
+    }
+}
+
+/**
+ * Free the data owned by the draw descriptor of a recorded draw task
+ */
+static void free_draw_dsc_data(lv_draw_task_t * t)
+{
+    if(t->type == LV_DRAW_TASK_TYPE_LABEL) {
+        lv_draw_label_dsc_t * label_dsc = t->draw_dsc;
+        if(label_dsc->text_local) lv_free((void *)label_dsc->text);
+    }
+    else if(t->type == LV_DRAW_TASK_TYPE_LINE) {
+        lv_draw_line_dsc_t * line_dsc = t->draw_dsc;
+        lv_free(line_dsc->points);
+    }
+}
+
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
 {
     LV_PROFILER_DRAW_BEGIN;
@@ -27,6 +27,7 @@ extern "C" {
 #include "../misc/lv_event.h"
 #include "lv_image_decoder.h"
 #include "lv_draw_buf.h"
+#include "lv_draw_arena.h"
 
 /*********************
  *      DEFINES
@@ -100,6 +101,9 @@ struct _lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+    /** Spatial index of the draw tasks to find the overlapping ones quickly. Created on demand.*/
+    lv_draw_task_index_t * task_index;
+
     /** Parent layer */
     lv_layer_t * parent;
 
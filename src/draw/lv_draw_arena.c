@@ -0,0 +1,238 @@
+/**
+ * @file lv_draw_arena.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_arena_private.h"
+#include "lv_draw_private.h"
+#include "../core/lv_global.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_log.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+#include "../stdlib/lv_sprintf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define arena LV_GLOBAL_DEFAULT()->draw_info.arena
+
+/*Keep the allocations aligned for any member type*/
+#define HEADER_SIZE LV_ALIGN_UP(sizeof(arena_header_t), 8)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Stored in front of every allocation*/
+typedef struct {
+    void * prev;        /*Header of the previous allocation*/
+    bool freed;
+} arena_header_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_DRAW_ARENA_SIZE
+    static void arena_lock(void);
+    static void arena_unlock(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_arena_init(void)
+{
+#if LV_DRAW_ARENA_SIZE
+    lv_memzero(&arena, sizeof(lv_draw_arena_t));
+    arena.buf = lv_malloc(LV_DRAW_ARENA_SIZE);
+    LV_ASSERT_MALLOC(arena.buf);
+
+#if LV_USE_OS
+    lv_mutex_init(&arena.mutex);
+#endif
+#endif
+}
+
+void lv_draw_arena_deinit(void)
+{
+#if LV_DRAW_ARENA_SIZE
+    if(arena.alloc_cnt) LV_LOG_WARN("%" LV_PRIu32 " allocations are still in the frame arena", arena.alloc_cnt);
+
+    lv_free(arena.buf);
+    arena.buf = NULL;
+
+#if LV_USE_OS
+    lv_mutex_delete(&arena.mutex);
+#endif
+#endif
+}
+
+void lv_draw_arena_refr_begin(void)
+{
+#if LV_DRAW_ARENA_SIZE
+    arena_lock();
+    arena.refr_depth++;
+    arena_unlock();
+#endif
+}
+
+void lv_draw_arena_refr_end(void)
+{
+#if LV_DRAW_ARENA_SIZE
+    arena_lock();
+    LV_ASSERT(arena.refr_depth > 0);
+    arena.refr_depth--;
+    if(arena.refr_depth == 0) {
+        /*Normally everything is freed by now and `used` is already 0.
+         *If something is kept the arena can't be reset; the new allocations will use the rest of it.*/
+        if(arena.alloc_cnt == 0) {
+            arena.used = 0;
+            arena.last = NULL;
+        }
+        else {
+            LV_LOG_WARN("%" LV_PRIu32 " allocations are kept in the frame arena after the refresh", arena.alloc_cnt);
+        }
+
+        if(arena.overflow_size > arena.overflow_size_max) arena.overflow_size_max = arena.overflow_size;
+        arena.overflow_size = 0;
+    }
+    arena_unlock();
+#endif
+}
+
+void * lv_draw_arena_alloc(size_t size)
+{
+#if LV_DRAW_ARENA_SIZE
+    if(arena.buf == NULL) return NULL;
+
+    arena_lock();
+    if(arena.refr_depth == 0) {
+        arena_unlock();
+        return NULL;
+    }
+
+    if(size > LV_DRAW_ARENA_SIZE || arena.used + HEADER_SIZE + LV_ALIGN_UP(size, 8) > LV_DRAW_ARENA_SIZE) {
+        arena.overflow_cnt++;
+        arena.overflow_size += size;
+        arena_unlock();
+        return NULL;
+    }
+
+    arena_header_t * header = (arena_header_t *)(arena.buf + arena.used);
+    header->prev = arena.last;
+    header->freed = false;
+    arena.last = header;
+    arena.used += HEADER_SIZE + LV_ALIGN_UP(size, 8);
+    arena.alloc_cnt++;
+    if(arena.used > arena.used_max) arena.used_max = arena.used;
+    arena_unlock();
+
+    return (uint8_t *)header + HEADER_SIZE;
+#else
+    LV_UNUSED(size);
+    return NULL;
+#endif
+}
+
+bool lv_draw_arena_contains(const void * p)
+{
+#if LV_DRAW_ARENA_SIZE
+    const uint8_t * p8 = p;
+    return arena.buf && p8 >= arena.buf && p8 < arena.buf + LV_DRAW_ARENA_SIZE;
+#else
+    LV_UNUSED(p);
+    return false;
+#endif
+}
+
+void * lv_draw_arena_malloc(size_t size)
+{
+    void * p = lv_draw_arena_alloc(size);
+    if(p) return p;
+
+    return lv_malloc(size);
+}
+
+void lv_draw_arena_free(void * p)
+{
+    if(p == NULL) return;
+
+#if LV_DRAW_ARENA_SIZE
+    if(lv_draw_arena_contains(p)) {
+        arena_lock();
+        arena_header_t * header = (arena_header_t *)((uint8_t *)p - HEADER_SIZE);
+        LV_ASSERT(header->freed == false);
+        header->freed = true;
+        arena.alloc_cnt--;
+
+        /*Give back the freed allocations from the end of the arena*/
+        while(arena.last && ((arena_header_t *)arena.last)->freed) {
+            header = arena.last;
+            arena.used = (uint8_t *)header - arena.buf;
+            arena.last = header->prev;
+        }
+        arena_unlock();
+        return;
+    }
+#endif
+
+    lv_free(p);
+}
+
+void lv_draw_arena_get_stat(lv_draw_arena_stat_t * stat)
+{
+    lv_memzero(stat, sizeof(lv_draw_arena_stat_t));
+#if LV_DRAW_ARENA_SIZE
+    arena_lock();
+    stat->size = LV_DRAW_ARENA_SIZE;
+    stat->used_max = arena.used_max;
+    stat->overflow_cnt = arena.overflow_cnt;
+    stat->overflow_size_max = LV_MAX(arena.overflow_size_max, arena.overflow_size);
+    arena_unlock();
+#endif
+}
+
+void lv_draw_arena_reset_stat(void)
+{
+#if LV_DRAW_ARENA_SIZE
+    arena_lock();
+    arena.used_max = arena.used;
+    arena.overflow_cnt = 0;
+    arena.overflow_size = 0;
+    arena.overflow_size_max = 0;
+    arena_unlock();
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_DRAW_ARENA_SIZE
+static void arena_lock(void)
+{
+#if LV_USE_OS
+    lv_mutex_lock(&arena.mutex);
+#endif
+}
+
+static void arena_unlock(void)
+{
+#if LV_USE_OS
+    lv_mutex_unlock(&arena.mutex);
+#endif
+}
+#endif
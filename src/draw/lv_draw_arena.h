@@ -0,0 +1,76 @@
+/**
+ * @file lv_draw_arena.h
+ *
+ */
+
+#ifndef LV_DRAW_ARENA_H
+#define LV_DRAW_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include "../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Usage of the frame arena. See `LV_DRAW_ARENA_SIZE`.*/
+typedef struct {
+    uint32_t size;                  /**< Size of the arena in bytes*/
+    uint32_t used_max;              /**< The most bytes used from the arena at once (high-water mark)*/
+    uint32_t overflow_cnt;          /**< Number of allocations which didn't fit and used `lv_malloc()`*/
+    uint32_t overflow_size_max;     /**< The most bytes allocated with `lv_malloc()` in a refresh
+                                     *   because the arena was full. Add it to `used_max` to size the arena.*/
+} lv_draw_arena_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Allocate a temporary buffer for drawing. While a display is being refreshed it's
+ * taken from the frame arena, else (or if the arena is full) `lv_malloc()` is used.
+ * Free it with `lv_draw_arena_free()` as soon as possible; freeing the buffers
+ * in the reverse order of the allocations gives back the memory to the arena immediately.
+ * @param size      requested size in bytes
+ * @return          pointer to the allocated uninitialized memory, or NULL on failure
+ */
+void * lv_draw_arena_malloc(size_t size);
+
+/**
+ * Free a buffer allocated by `lv_draw_arena_malloc()`
+ * @param p         pointer to the buffer. Can be NULL.
+ */
+void lv_draw_arena_free(void * p);
+
+/**
+ * Get the usage of the frame arena. All fields are 0 if `LV_DRAW_ARENA_SIZE` is 0.
+ * @param stat      store the usage here
+ */
+void lv_draw_arena_get_stat(lv_draw_arena_stat_t * stat);
+
+/**
+ * Reset the high-water mark and the overflow counters of the frame arena
+ */
+void lv_draw_arena_reset_stat(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_ARENA_H*/
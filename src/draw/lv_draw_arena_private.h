@@ -0,0 +1,91 @@
+/**
+ * @file lv_draw_arena_private.h
+ *
+ */
+
+#ifndef LV_DRAW_ARENA_PRIVATE_H
+#define LV_DRAW_ARENA_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_draw_arena.h"
+#include "../osal/lv_os_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_draw_arena_t {
+    uint8_t * buf;
+    uint32_t used;                  /**< Offset of the first free byte*/
+    void * last;                    /**< Header of the last allocation which is still in the arena*/
+    uint32_t alloc_cnt;             /**< Number of allocations not freed yet*/
+    uint32_t refr_depth;            /**< >0: a display is being refreshed and the arena can be used*/
+    uint32_t used_max;
+    uint32_t overflow_cnt;
+    uint32_t overflow_size;         /**< Bytes allocated with `lv_malloc()` in the current refresh*/
+    uint32_t overflow_size_max;
+#if LV_USE_OS
+    lv_mutex_t mutex;
+#endif
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Allocate the buffer of the frame arena. Called in `lv_draw_init()`.
+ */
+void lv_draw_arena_init(void);
+
+/**
+ * Free the buffer of the frame arena. Called in `lv_draw_deinit()`.
+ */
+void lv_draw_arena_deinit(void);
+
+/**
+ * Start using the frame arena. Called when the refresh of a display starts.
+ */
+void lv_draw_arena_refr_begin(void);
+
+/**
+ * Stop using the frame arena and reset it if nothing is allocated from it anymore.
+ * Called when the refresh of a display is ready.
+ */
+void lv_draw_arena_refr_end(void);
+
+/**
+ * Allocate from the frame arena only.
+ * @param size      requested size in bytes
+ * @return          pointer to the allocated uninitialized memory,
+ *                  or NULL if no display is being refreshed or the arena is full
+ */
+void * lv_draw_arena_alloc(size_t size);
+
+/**
+ * Check if a memory is allocated from the frame arena.
+ * @param p         pointer to a memory
+ * @return          true: `p` is in the frame arena
+ */
+bool lv_draw_arena_contains(const void * p);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_ARENA_PRIVATE_H*/
@@ -19,6 +19,7 @@ extern "C" {
  *********************/
 
 #include "lv_draw.h"
+#include "lv_draw_arena_private.h"
 #include "../osal/lv_os_private.h"
 #include "../misc/cache/lv_cache.h"
 
@@ -84,6 +85,14 @@ struct _lv_draw_task_t {
      */
     uint8_t preference_score;
 
+    /** Creation order of the draw task. Used to tell which draw tasks are older in `task_index` of the layer*/
+    uint32_t order;
+
+    /** Links of the draw task in `task_index` of the layer. `index_cell == NULL` means it's not indexed yet*/
+    lv_draw_task_t * index_next;
+    lv_draw_task_t * index_prev;
+    lv_draw_task_t ** index_cell;
+
 };
 
 struct _lv_draw_mask_t {
@@ -192,13 +201,55 @@ typedef struct {
     volatile int dispatch_req;
 #endif
     lv_mutex_t circle_cache_mutex;
+    uint32_t task_order_cnt;
     bool task_running;
+    lv_draw_record_t * record;      /**< Copy the new draw tasks here*/
+#if LV_DRAW_ARENA_SIZE
+    lv_draw_arena_t arena;
+#endif
 } lv_draw_global_info_t;
 
+/** Copy of draw tasks which can be added again later*/
+struct _lv_draw_record_t {
+    lv_layer_t * layer;             /**< Only the draw tasks of this layer are recorded*/
+    lv_draw_task_t * task_head;     /**< The copied draw tasks. Only their type, areas, matrix, opacity and
+                                     *   descriptor are used.*/
+    uint32_t failed : 1;            /**< 1: a draw task was added which can't be recorded*/
+};
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Start copying the draw tasks added to a layer.
+ * The draw tasks of other layers and the types which reference temporary data (e.g. layers)
+ * can't be recorded, and they set `rec->failed`.
+ * @param rec       pointer to an empty or reset record
+ * @param layer     record the draw tasks of this layer
+ */
+void lv_draw_record_start(lv_draw_record_t * rec, lv_layer_t * layer);
+
+/**
+ * Stop recording.
+ * @param rec       pointer to the record started by `lv_draw_record_start`
+ */
+void lv_draw_record_stop(lv_draw_record_t * rec);
+
+/**
+ * Add the recorded draw tasks to a layer again with their recorded matrix and opacity.
+ * Their recorded clip area is clipped to the current clip area of the layer.
+ * @param rec       pointer to a record
+ * @param layer     add the draw tasks to this layer
+ */
+void lv_draw_record_replay(const lv_draw_record_t * rec, lv_layer_t * layer);
+
+/**
+ * Free the recorded draw tasks
+ * @param rec       pointer to a record
+ */
+void lv_draw_record_reset(lv_draw_record_t * rec);
+
 /**********************
  *      MACROS
  **********************/
@@ -43,6 +43,9 @@
  *      DEFINES
  *********************/
 
+/*Shorter fully transparent or fully covered spans are blended together with the partial spans around them*/
+#define BLEND_SPAN_MIN_LEN  16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -54,6 +57,13 @@
 static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_color(lv_color_format_t layer_cf,
                                                                       lv_draw_sw_blend_fill_dsc_t * fill_dsc);
 
+static void /* LV_ATTRIBUTE_FAST_MEM */ blend_color_spans(lv_color_format_t layer_cf,
+                                                         lv_draw_sw_blend_fill_dsc_t * fill_dsc);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ blend_color_span(lv_color_format_t layer_cf,
+                                                        const lv_draw_sw_blend_fill_dsc_t * fill_dsc,
+                                                        int32_t x_start, int32_t x_end, bool masked);
+
 static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_image(lv_color_format_t layer_cf,
                                                                       lv_draw_sw_blend_image_dsc_t * image_dsc);
 
@@ -114,7 +124,8 @@ void lv_draw_sw_blend(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_d
                                  (blend_area.x1 - blend_dsc->mask_area->x1);
         }
 
-        lv_draw_sw_blend_color(layer->color_format, &fill_dsc);
+        if(fill_dsc.mask_buf && fill_dsc.dest_h == 1) blend_color_spans(layer->color_format, &fill_dsc);
+        else lv_draw_sw_blend_color(layer->color_format, &fill_dsc);
     }
     else {
         if(!lv_area_intersect(&blend_area, &blend_area, blend_dsc->src_area)) {
@@ -233,6 +244,106 @@ static inline void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color(lv_color_format_
     }
 }
 
+/**
+ * Blend a color with a one line high mask.
+ * The line is split to fully transparent, fully covered and partially covered spans.
+ * The transparent spans are skipped, the covered spans are filled without mask
+ * and only the partial spans are blended with the mask.
+ * @param layer_cf  color format of the layer
+ * @param fill_dsc  the fill descriptor with a mask and `dest_h == 1`
+ */
+static void LV_ATTRIBUTE_FAST_MEM blend_color_spans(lv_color_format_t layer_cf, lv_draw_sw_blend_fill_dsc_t * fill_dsc)
+{
+    /*Use the spans only if the result is the same as blending with the mask.
+     *With opacity the covered pixels are blended with `LV_OPA_MIX2(255, opa)` which is not `opa`.
+     *On ARGB8888 and AL88 the zero mask still sets the color of the transparent pixels.
+     *On XRGB8888 the covered spans set the unused X byte to 0xFF too, as any other fill.*/
+    bool skip_transp = false;
+    bool fill_cover = false;
+    switch(layer_cf) {
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB565_SWAPPED:
+        case LV_COLOR_FORMAT_RGB888:
+        case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_L8:
+        case LV_COLOR_FORMAT_A8:
+            skip_transp = true;
+            fill_cover = fill_dsc->opa >= LV_OPA_MAX;
+            break;
+        case LV_COLOR_FORMAT_ARGB8888:
+        case LV_COLOR_FORMAT_AL88:
+            fill_cover = fill_dsc->opa >= LV_OPA_MAX;
+            break;
+        default:
+            break;
+    }
+
+    if(!skip_transp && !fill_cover) {
+        lv_draw_sw_blend_color(layer_cf, fill_dsc);
+        return;
+    }
+
+    /*A span of at least `BLEND_SPAN_MIN_LEN` contains at least one aligned word of 0x00 or 0xFF bytes.
+     *So look for these words and extend them to both directions to find the spans.*/
+    const lv_opa_t * mask = fill_dsc->mask_buf;
+    int32_t w = fill_dsc->dest_w;
+    int32_t partial_start = 0;
+    int32_t x = 0;
+    while(x < w) {
+        if(((lv_uintptr_t)&mask[x] & 0x3) || x + 4 > w) {
+            x++;
+            continue;
+        }
+
+        uint32_t mask32 = *((const uint32_t *)&mask[x]);
+        if((mask32 == 0x00000000 && skip_transp) || (mask32 == 0xFFFFFFFF && fill_cover)) {
+            lv_opa_t mask_act = mask[x];
+            int32_t span_start = x;
+            while(span_start > partial_start && mask[span_start - 1] == mask_act) span_start--;
+
+            int32_t span_end = x + 4;
+            while(span_end + 4 <= w && *((const uint32_t *)&mask[span_end]) == mask32) span_end += 4;
+            while(span_end < w && mask[span_end] == mask_act) span_end++;
+
+            if(span_end - span_start >= BLEND_SPAN_MIN_LEN) {
+                blend_color_span(layer_cf, fill_dsc, partial_start, span_start, true);
+                if(mask_act == LV_OPA_COVER) blend_color_span(layer_cf, fill_dsc, span_start, span_end, false);
+                partial_start = span_end;
+            }
+            x = span_end;
+        }
+        else {
+            x += 4;
+        }
+    }
+
+    blend_color_span(layer_cf, fill_dsc, partial_start, w, true);
+}
+
+/**
+ * Blend the `[x_start, x_end)` part of a one line high fill.
+ * @param layer_cf  color format of the layer
+ * @param fill_dsc  the fill descriptor of the whole line
+ * @param x_start   first pixel of the span relative to the start of the line
+ * @param x_end     the pixel after the last pixel of the span
+ * @param masked    true: blend with the mask; false: fill without mask
+ */
+static void LV_ATTRIBUTE_FAST_MEM blend_color_span(lv_color_format_t layer_cf,
+                                                  const lv_draw_sw_blend_fill_dsc_t * fill_dsc,
+                                                  int32_t x_start, int32_t x_end, bool masked)
+{
+    if(x_start >= x_end) return;
+
+    lv_draw_sw_blend_fill_dsc_t span_dsc = *fill_dsc;
+    span_dsc.dest_w = x_end - x_start;
+    span_dsc.dest_buf = (uint8_t *)fill_dsc->dest_buf + x_start * lv_color_format_get_size(layer_cf);
+    span_dsc.mask_buf = masked ? fill_dsc->mask_buf + x_start : NULL;
+    span_dsc.relative_area.x1 += x_start;
+    span_dsc.relative_area.x2 = span_dsc.relative_area.x1 + span_dsc.dest_w - 1;
+
+    lv_draw_sw_blend_color(layer_cf, &span_dsc);
+}
+
 static inline void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image(lv_color_format_t layer_cf,
                                                                 lv_draw_sw_blend_image_dsc_t * image_dsc)
 {
@@ -16,12 +16,15 @@
 #include "../../../display/lv_display.h"
 #include "../../../core/lv_refr.h"
 #include "../../../misc/lv_color.h"
+#include "../../../misc/lv_color_op_private.h"
 #include "../../../stdlib/lv_string.h"
 
 #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_NEON
     #include "neon/lv_blend_neon.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "helium/lv_blend_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    #include "x86/lv_blend_x86.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
@@ -1269,7 +1272,7 @@ static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM lv_color_32_32_mix(lv_color32_t
     }
     /*Opaque background: use simple mix*/
     else if(bg.alpha == 255) {
-        return lv_color_mix32(fg, bg);
+        return lv_color_mix32_inline(fg, bg);
     }
     /*Both colors have alpha. Expensive calculation need to be applied*/
     else {
@@ -1284,11 +1287,11 @@ static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM lv_color_32_32_mix(lv_color32_t
             cache->ratio_saved = (uint32_t)((uint32_t)fg.alpha * 255) / cache->res_alpha_saved;
         }
 
-        if(!lv_color32_eq(bg, cache->bg_saved) || !lv_color32_eq(fg, cache->fg_saved)) {
+        if(!lv_color32_eq_inline(bg, cache->bg_saved) || !lv_color32_eq_inline(fg, cache->fg_saved)) {
             cache->fg_saved = fg;
             cache->bg_saved = bg;
             fg.alpha = cache->ratio_saved;
-            cache->res_saved = lv_color_mix32(fg, bg);
+            cache->res_saved = lv_color_mix32_inline(fg, bg);
             cache->res_saved.alpha = cache->res_alpha_saved;
         }
 
@@ -16,6 +16,7 @@
 #include "../../../display/lv_display.h"
 #include "../../../core/lv_refr.h"
 #include "../../../misc/lv_color.h"
+#include "../../../misc/lv_color_op_private.h"
 
 /*********************
  *      DEFINES
@@ -758,7 +759,7 @@ static inline lv_color32_t lv_color_32_32_mix_premul(lv_color32_t fg, lv_color32
         }
 
         /* Check if color blending is already cached */
-        if(!lv_color32_eq(bg, cache->bg_saved) || !lv_color32_eq(fg, cache->fg_saved)) {
+        if(!lv_color32_eq_inline(bg, cache->bg_saved) || !lv_color32_eq_inline(fg, cache->fg_saved)) {
             cache->fg_saved = fg;
             cache->bg_saved = bg;
 
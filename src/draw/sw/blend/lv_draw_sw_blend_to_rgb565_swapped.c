@@ -16,6 +16,7 @@
 #include "../../../display/lv_display.h"
 #include "../../../core/lv_refr.h"
 #include "../../../misc/lv_color.h"
+#include "../../../misc/lv_color_op_private.h"
 #include "../../../stdlib/lv_string.h"
 
 #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_NEON
@@ -324,7 +325,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565_swapped(lv_draw_sw_b
                 for(x = 0; x < w; x++) {
                     if(last_dest_color != dest_buf_u16[x]) {
                         uint16_t px = lv_color_swap_16(dest_buf_u16[x]); /* Swap destination so it becomes unswapped now */
-                        last_res_color = lv_color_16_16_mix(color16, px, opa); /* Color mix of unswapped colors */
+                        last_res_color = lv_color_16_16_mix_inline(color16, px, opa); /* Color mix of unswapped colors */
                         last_res_color = lv_color_swap_16(last_res_color);
                         last_dest_color = dest_buf_u16[x];
                     }
@@ -343,7 +344,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565_swapped(lv_draw_sw_b
                 if((lv_uintptr_t)(mask) & 0x1) {
                     uint16_t px = dest_buf_u16[x];
                     px = lv_color_swap_16(px); /* Swap destination */
-                    px = lv_color_16_16_mix(color16, px, mask[x]); /* Color mix */
+                    px = lv_color_16_16_mix_inline(color16, px, mask[x]); /* Color mix */
                     dest_buf_u16[x] = lv_color_swap_16(px); /* Write back swapped */
                     x++;
                 }
@@ -358,8 +359,8 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565_swapped(lv_draw_sw_b
                         uint16_t px0 = lv_color_swap_16(dest_buf_u16[x + 0]); /* Swap destination */
                         uint16_t px1 = lv_color_swap_16(dest_buf_u16[x + 1]); /* Swap destination */
 
-                        px0 = lv_color_16_16_mix(color16, px0, mask[x + 0]); /* Color mix */
-                        px1 = lv_color_16_16_mix(color16, px1, mask[x + 1]); /* Color mix */
+                        px0 = lv_color_16_16_mix_inline(color16, px0, mask[x + 0]); /* Color mix */
+                        px1 = lv_color_16_16_mix_inline(color16, px1, mask[x + 1]); /* Color mix */
 
                         dest_buf_u16[x + 0] = lv_color_swap_16(px0); /* Write back swapped */
                         dest_buf_u16[x + 1] = lv_color_swap_16(px1); /* Write back swapped */
@@ -370,7 +371,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565_swapped(lv_draw_sw_b
                 for(; x < w ; x++) {
                     uint16_t px = dest_buf_u16[x];
                     px = lv_color_swap_16(px); /* Swap destination */
-                    px = lv_color_16_16_mix(color16, px, mask[x]); /* Color mix */
+                    px = lv_color_16_16_mix_inline(color16, px, mask[x]); /* Color mix */
                     dest_buf_u16[x] = lv_color_swap_16(px); /* Write back swapped */
 
                 }
@@ -388,7 +389,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565_swapped(lv_draw_sw_b
                     px = lv_color_swap_16(px); /* Swap destination */
 
                     uint8_t mix_opa = LV_OPA_MIX2(mask[x], opa);
-                    px = lv_color_16_16_mix(color16, px, mix_opa); /* Color mix */
+                    px = lv_color_16_16_mix_inline(color16, px, mix_opa); /* Color mix */
 
                     dest_buf_u16[x] = lv_color_swap_16(px); /* Write back swapped */
                 }
@@ -555,14 +556,14 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
                     dest_buf_u16[dest_x] = lv_color_swap_16(res);
                 }
                 else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, lv_color_swap_16(dest_buf_u16[dest_x]), opa));
+                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, lv_color_swap_16(dest_buf_u16[dest_x]), opa));
                 }
                 else {
                     if(opa >= LV_OPA_MAX)
-                        dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, lv_color_swap_16(dest_buf_u16[dest_x]),
+                        dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, lv_color_swap_16(dest_buf_u16[dest_x]),
                                                                                    mask_buf[dest_x]));
                     else
-                        dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, lv_color_swap_16(dest_buf_u16[dest_x]),
+                        dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, lv_color_swap_16(dest_buf_u16[dest_x]),
                                                                                    LV_OPA_MIX2(mask_buf[dest_x], opa)));
                 }
             }
@@ -681,16 +682,16 @@ static void LV_ATTRIBUTE_FAST_MEM al88_image_blend(lv_draw_sw_blend_image_dsc_t
                         return;
                 }
                 if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], src_buf_al88[src_x].alpha));
+                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], src_buf_al88[src_x].alpha));
                 }
                 else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(opa,
+                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], LV_OPA_MIX2(opa,
                                                                                                                       src_buf_al88[src_x].alpha)));
                 }
                 else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x],
+                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x],
                                                                                                          mask_buf[dest_x]));
-                    else dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX3(mask_buf[dest_x],
+                    else dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], LV_OPA_MIX3(mask_buf[dest_x],
                                                                                                                                opa,
                                                                                                                                src_buf_al88[src_x].alpha)));
                 }
@@ -812,12 +813,12 @@ static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(lv_draw_sw_blend_image_dsc_t *
                     dest_buf_u16[dest_x] = res;
                 }
                 else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], opa));
+                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], opa));
                 }
                 else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x],
+                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x],
                                                                                                          mask_buf[dest_x]));
-                    else dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x],
+                    else dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x],
                                                                                                                                opa)));
                 }
             }
@@ -863,7 +864,7 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_SWAPPED_WITH_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
                     for(x = 0; x < w; x++) {
-                        dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix(src_buf_u16[x], lv_color_swap_16(dest_buf_u16[x]), opa));
+                        dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix_inline(src_buf_u16[x], lv_color_swap_16(dest_buf_u16[x]), opa));
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
                     src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
@@ -874,7 +875,7 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_SWAPPED_WITH_MASK(dsc)) {
                 for(y = 0; y < h; y++) {
                     for(x = 0; x < w; x++) {
-                        dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix(src_buf_u16[x], lv_color_swap_16(dest_buf_u16[x]), mask_buf[x]));
+                        dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix_inline(src_buf_u16[x], lv_color_swap_16(dest_buf_u16[x]), mask_buf[x]));
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
                     src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
@@ -886,7 +887,7 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_SWAPPED_MIX_MASK_OPA(dsc)) {
                 for(y = 0; y < h; y++) {
                     for(x = 0; x < w; x++) {
-                        dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix(src_buf_u16[x], lv_color_swap_16(dest_buf_u16[x]),
+                        dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix_inline(src_buf_u16[x], lv_color_swap_16(dest_buf_u16[x]),
                                                                               LV_OPA_MIX2(mask_buf[x], opa)));
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -936,11 +937,11 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
                 }
 
                 if(mask_buf == NULL) {
-                    dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[x], opa));
+                    dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[x], opa));
                 }
                 else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[x], mask_buf[x]));
-                    else dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa)));
+                    if(opa >= LV_OPA_MAX) dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[x], mask_buf[x]));
+                    else dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa)));
                 }
             }
 
@@ -983,7 +984,7 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_swapped_image_blend(lv_draw_sw_blend_im
                 for(y = 0; y < h; y++) {
                     for(x = 0; x < w; x++) {
                         uint16_t px = lv_color_swap_16(dest_buf_u16[x]);
-                        px = lv_color_16_16_mix(lv_color_swap_16(src_buf_u16[x]), px, opa);
+                        px = lv_color_16_16_mix_inline(lv_color_swap_16(src_buf_u16[x]), px, opa);
                         dest_buf_u16[x] = lv_color_swap_16(px);
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -996,7 +997,7 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_swapped_image_blend(lv_draw_sw_blend_im
                 for(y = 0; y < h; y++) {
                     for(x = 0; x < w; x++) {
                         uint16_t px = lv_color_swap_16(dest_buf_u16[x]);
-                        px = lv_color_16_16_mix(lv_color_swap_16(src_buf_u16[x]), px, mask_buf[x]);
+                        px = lv_color_16_16_mix_inline(lv_color_swap_16(src_buf_u16[x]), px, mask_buf[x]);
                         dest_buf_u16[x] = lv_color_swap_16(px);
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -1010,7 +1011,7 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_swapped_image_blend(lv_draw_sw_blend_im
                 for(y = 0; y < h; y++) {
                     for(x = 0; x < w; x++) {
                         uint16_t px = lv_color_swap_16(dest_buf_u16[x]);
-                        px = lv_color_16_16_mix(lv_color_swap_16(src_buf_u16[x]), px, LV_OPA_MIX2(mask_buf[x], opa));
+                        px = lv_color_16_16_mix_inline(lv_color_swap_16(src_buf_u16[x]), px, LV_OPA_MIX2(mask_buf[x], opa));
                         dest_buf_u16[x] = lv_color_swap_16(px);
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -1063,11 +1064,11 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_swapped_image_blend(lv_draw_sw_blend_im
                 }
 
                 if(mask_buf == NULL) {
-                    dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[x], opa));
+                    dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[x], opa));
                 }
                 else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[x], mask_buf[x]));
-                    else dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa)));
+                    if(opa >= LV_OPA_MAX) dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[x], mask_buf[x]));
+                    else dest_buf_u16[x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa)));
                 }
             }
 
@@ -1182,12 +1183,12 @@ static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_
                 }
 
                 if(mask_buf == NULL) {
-                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], opa));
+                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], opa));
                 }
                 else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x],
+                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x],
                                                                                                          mask_buf[dest_x]));
-                    else dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x],
+                    else dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x],
                                                                                                                                opa)));
                 }
             }
@@ -1305,16 +1306,16 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
                 }
 
                 if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], src_buf_u8[src_x + 3]));
+                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], src_buf_u8[src_x + 3]));
                 }
                 else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(opa,
+                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], LV_OPA_MIX2(opa,
                                                                                                                       src_buf_u8[src_x + 3])));
                 }
                 else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x],
+                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x],
                                                                                                          mask_buf[dest_x]));
-                    else dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX3(mask_buf[dest_x],
+                    else dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], LV_OPA_MIX3(mask_buf[dest_x],
                                                                                                                                opa,
                                                                                                                                src_buf_u8[src_x + 3])));
                 }
@@ -1476,18 +1477,18 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_premultiplied_image_blend(lv_draw_sw_
 
                 if(mask_buf == NULL && opa >= LV_OPA_MAX) {
                     /* Blending premultiplied ARGB8888 to RGB565 with no mask and full opacity */
-                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], src_buf_u8[src_x + 3]));
+                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], src_buf_u8[src_x + 3]));
                 }
                 else if(mask_buf == NULL && opa < LV_OPA_MAX) {
                     /* Blending premultiplied ARGB8888 to RGB565 with no mask and partial opacity */
-                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(opa,
+                    dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], LV_OPA_MIX2(opa,
                                                                                                                       src_buf_u8[src_x + 3])));
                 }
                 else {
                     if(opa >= LV_OPA_MAX)
-                        dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], mask_buf[dest_x]));
+                        dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], mask_buf[dest_x]));
                     else
-                        dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX3(mask_buf[dest_x], opa,
+                        dest_buf_u16[dest_x] = lv_color_swap_16(lv_color_16_16_mix_inline(res, dest_buf_u16[dest_x], LV_OPA_MIX3(mask_buf[dest_x], opa,
                                                                                                                           src_buf_u8[src_x + 3])));
                 }
             }
@@ -10,6 +10,7 @@
 #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_NEON
 
 #include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_color_op_private.h"
 #include "../../../../misc/lv_types.h"
 #include "../lv_draw_sw_blend_private.h"
 #include <arm_neon.h>
@@ -226,7 +227,7 @@ lv_result_t lv_draw_sw_blend_neon_color_to_rgb565_with_opa(lv_draw_sw_blend_fill
             int32_t pixel_alignment = (16 - offset) >> 1;
             pixel_alignment         = (pixel_alignment > w) ? w : pixel_alignment;
             for(; x < pixel_alignment; x++) {
-                row_ptr[x] = lv_color_16_16_mix(color16, row_ptr[x], opa);
+                row_ptr[x] = lv_color_16_16_mix_inline(color16, row_ptr[x], opa);
             }
         }
         for(; x < w - 7; x += 8) {
@@ -241,7 +242,7 @@ lv_result_t lv_draw_sw_blend_neon_color_to_rgb565_with_opa(lv_draw_sw_blend_fill
             *(uint32_t *)&row_ptr[x] = lv_color_16_16_mix_2_with_opa((const uint16_t *)&color32, &row_ptr[x], opa);
         }
         for(; x < w; x++) {
-            row_ptr[x] = lv_color_16_16_mix(color16, row_ptr[x], opa);
+            row_ptr[x] = lv_color_16_16_mix_inline(color16, row_ptr[x], opa);
         }
 
         dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -274,7 +275,7 @@ lv_result_t lv_draw_sw_blend_neon_color_to_rgb565_with_mask(lv_draw_sw_blend_fil
             int32_t pixel_alignment = (16 - offset) >> 1;
             pixel_alignment         = (pixel_alignment > w) ? w : pixel_alignment;
             for(; x < pixel_alignment; x++) {
-                row_ptr[x] = lv_color_16_16_mix(color16, row_ptr[x], mask_row[x]);
+                row_ptr[x] = lv_color_16_16_mix_inline(color16, row_ptr[x], mask_row[x]);
             }
         }
         for(; x < w - 7; x += 8) {
@@ -292,7 +293,7 @@ lv_result_t lv_draw_sw_blend_neon_color_to_rgb565_with_mask(lv_draw_sw_blend_fil
                 lv_color_16_16_mix_2_with_mask((const uint16_t *)&color32, &row_ptr[x], &mask_row[x]);
         }
         for(; x < w; x++) {
-            row_ptr[x] = lv_color_16_16_mix(color16, row_ptr[x], mask_row[x]);
+            row_ptr[x] = lv_color_16_16_mix_inline(color16, row_ptr[x], mask_row[x]);
         }
 
         dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -331,7 +332,7 @@ lv_result_t lv_draw_sw_blend_neon_color_to_rgb565_with_opa_mask(lv_draw_sw_blend
             int32_t pixel_alignment = (16 - offset) >> 1;
             pixel_alignment         = (pixel_alignment > w) ? w : pixel_alignment;
             for(; x < pixel_alignment; x++) {
-                row_ptr[x] = lv_color_16_16_mix(color16, row_ptr[x], LV_OPA_MIX2(opa, mask_row[x]));
+                row_ptr[x] = lv_color_16_16_mix_inline(color16, row_ptr[x], LV_OPA_MIX2(opa, mask_row[x]));
             }
         }
         for(; x < w - 7; x += 8) {
@@ -349,7 +350,7 @@ lv_result_t lv_draw_sw_blend_neon_color_to_rgb565_with_opa_mask(lv_draw_sw_blend
                 lv_color_16_16_mix_2_with_opa_mask((const uint16_t *)&color32, &row_ptr[x], opa, &mask_row[x]);
         }
         for(; x < w; x++) {
-            row_ptr[x] = lv_color_16_16_mix(color16, row_ptr[x], LV_OPA_MIX2(opa, mask_row[x]));
+            row_ptr[x] = lv_color_16_16_mix_inline(color16, row_ptr[x], LV_OPA_MIX2(opa, mask_row[x]));
         }
 
         dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -610,7 +611,7 @@ lv_result_t lv_draw_sw_blend_neon_rgb565_to_rgb565_with_opa(lv_draw_sw_blend_ima
             *(uint32_t *)&dest_row[x] = lv_color_16_16_mix_2_with_opa(&src_row[x], &dest_row[x], opa);
         }
         for(; x < w - 0; x += 1) {
-            dest_row[x] = lv_color_16_16_mix(src_row[x], dest_row[x], opa);
+            dest_row[x] = lv_color_16_16_mix_inline(src_row[x], dest_row[x], opa);
         }
         dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
         src_buf_u16  = drawbuf_next_row(src_buf_u16, src_stride);
@@ -646,7 +647,7 @@ lv_result_t lv_draw_sw_blend_neon_rgb565_to_rgb565_with_mask(lv_draw_sw_blend_im
             *(uint32_t *)&dest_row[x] = lv_color_16_16_mix_2_with_mask(&src_row[x], &dest_row[x], &mask_row[x]);
         }
         for(; x < w - 0; x += 1) {
-            dest_row[x] = lv_color_16_16_mix(src_row[x], dest_row[x], mask_row[x]);
+            dest_row[x] = lv_color_16_16_mix_inline(src_row[x], dest_row[x], mask_row[x]);
         }
         dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
         src_buf_u16  = drawbuf_next_row(src_buf_u16, src_stride);
@@ -685,7 +686,7 @@ lv_result_t lv_draw_sw_blend_neon_rgb565_to_rgb565_with_opa_mask(lv_draw_sw_blen
                 lv_color_16_16_mix_2_with_opa_mask(&src_row[x], &dest_row[x], opa, &mask_row[x]);
         }
         for(; x < w - 0; x += 1) {
-            dest_row[x] = lv_color_16_16_mix(src_row[x], dest_row[x], LV_OPA_MIX2(mask_row[x], opa));
+            dest_row[x] = lv_color_16_16_mix_inline(src_row[x], dest_row[x], LV_OPA_MIX2(mask_row[x], opa));
         }
         dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
         src_buf_u16  = drawbuf_next_row(src_buf_u16, src_stride);
@@ -2072,18 +2073,18 @@ static inline uint16x4_t lv_color_16_16_mix_4_internal(uint16x4_t c1_vec, uint16
 
 static inline uint32_t lv_color_16_16_mix_2_with_opa(const uint16_t * c1, const uint16_t * c2, uint8_t opa)
 {
-    return lv_color_16_16_mix(c1[1], c2[1], opa) << 16 | lv_color_16_16_mix(*c1, *c2, opa);
+    return lv_color_16_16_mix_inline(c1[1], c2[1], opa) << 16 | lv_color_16_16_mix_inline(*c1, *c2, opa);
 }
 static inline uint32_t lv_color_16_16_mix_2_with_mask(const uint16_t * c1, const uint16_t * c2, const uint8_t * mask)
 {
-    return lv_color_16_16_mix(c1[1], c2[1], mask[1]) << 16 | lv_color_16_16_mix(*c1, *c2, *mask);
+    return lv_color_16_16_mix_inline(c1[1], c2[1], mask[1]) << 16 | lv_color_16_16_mix_inline(*c1, *c2, *mask);
 }
 static inline uint32_t lv_color_16_16_mix_2_with_opa_mask(const uint16_t * c1, const uint16_t * c2, uint8_t opa,
                                                           const uint8_t * mask)
 {
 
-    return lv_color_16_16_mix(c1[1], c2[1], LV_OPA_MIX2(opa, mask[1])) << 16 |
-           lv_color_16_16_mix(*c1, *c2, LV_OPA_MIX2(*mask, opa));
+    return lv_color_16_16_mix_inline(c1[1], c2[1], LV_OPA_MIX2(opa, mask[1])) << 16 |
+           lv_color_16_16_mix_inline(*c1, *c2, LV_OPA_MIX2(*mask, opa));
 }
 
 static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
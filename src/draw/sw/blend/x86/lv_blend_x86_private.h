@@ -0,0 +1,348 @@
+/**
+ * @file lv_blend_x86_private.h
+ * Common helpers for the SSE2/AVX2 blend routines
+ *
+ * The kernels are compiled with per-function target attributes so the library
+ * itself can be built for a baseline x86 CPU. The instruction set actually used
+ * is picked at runtime with CPUID (see `lv_draw_sw_blend_x86_get_features()`).
+ *
+ * All helpers are bit-exact with the scalar mixing functions of
+ * `lv_draw_sw_blend_to_*.c` so the rendered output doesn't depend on the CPU.
+ */
+
+#ifndef LV_BLEND_X86_PRIVATE_H
+#define LV_BLEND_X86_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#if !(defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#error "LV_DRAW_SW_ASM_X86 requires an x86 or x86-64 target"
+#endif
+
+#include "../../../../misc/lv_types.h"
+#include "../../../../misc/lv_color.h"
+#include "../../../../stdlib/lv_string.h"
+#include <immintrin.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LV_DRAW_SW_X86_FEATURE_SSE2     (1 << 0)
+#define LV_DRAW_SW_X86_FEATURE_AVX2     (1 << 1)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LV_X86_TARGET_SSE2 __attribute__((target("sse2")))
+#define LV_X86_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+/*MSVC can emit any intrinsic without enabling it for the whole file*/
+#define LV_X86_TARGET_SSE2
+#define LV_X86_TARGET_AVX2
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Describes how the pixels of a line are mixed. The mix value of a pixel is calculated
+ * the same way as in the generic code from the opacity, the mask and the source alpha.
+ */
+typedef struct {
+    const uint8_t * src;        /**< NULL: fill with `color32`*/
+    uint32_t src_px_size;
+    uint32_t color32;
+    const lv_opa_t * mask;      /**< NULL: no mask*/
+    lv_opa_t opa;               /**< Not applied if >= LV_OPA_MAX*/
+    bool src_has_alpha;         /**< `src` is ARGB8888*/
+} lv_x86_row_dsc_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the SIMD extensions supported by the CPU and the OS.
+ * The CPUID query runs only once, later calls return the cached result.
+ * @return      OR-ed `LV_DRAW_SW_X86_FEATURE_...` flags
+ */
+uint32_t lv_draw_sw_blend_x86_get_features(void);
+
+/**
+ * Fill a line with a 32 bit value
+ * @param dest      pointer to the first pixel
+ * @param value     the value to write
+ * @param w         number of pixels
+ */
+void lv_draw_sw_blend_x86_fill_u32_sse2(uint32_t * dest, uint32_t value, int32_t w);
+
+/**
+ * Same as `lv_draw_sw_blend_x86_fill_u32_sse2()` but with AVX2. Call it only if AVX2 is supported.
+ */
+void lv_draw_sw_blend_x86_fill_u32_avx2(uint32_t * dest, uint32_t value, int32_t w);
+
+/**
+ * Fill a line with a 16 bit value
+ * @param dest      pointer to the first pixel
+ * @param value     the value to write
+ * @param w         number of pixels
+ */
+void lv_draw_sw_blend_x86_fill_u16_sse2(uint16_t * dest, uint16_t value, int32_t w);
+
+/**
+ * Same as `lv_draw_sw_blend_x86_fill_u16_sse2()` but with AVX2. Call it only if AVX2 is supported.
+ */
+void lv_draw_sw_blend_x86_fill_u16_avx2(uint16_t * dest, uint16_t value, int32_t w);
+
+/**
+ * Fill an area of 3 byte pixels with a 48 byte (16 pixel) repeating pattern
+ * @param dest      pointer to the first pixel
+ * @param pattern   48 bytes to repeat, the first 3 bytes are used for the last pixels too
+ * @param w         width of the area in pixels
+ * @param h         height of the area
+ * @param stride    stride of `dest` in bytes
+ */
+void lv_draw_sw_blend_x86_fill_pattern48_sse2(uint8_t * dest, const uint8_t * pattern, int32_t w, int32_t h,
+                                              int32_t stride);
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+static inline bool lv_x86_has_sse2(void)
+{
+    return (lv_draw_sw_blend_x86_get_features() & LV_DRAW_SW_X86_FEATURE_SSE2) != 0;
+}
+
+static inline bool lv_x86_has_avx2(void)
+{
+    return (lv_draw_sw_blend_x86_get_features() & LV_DRAW_SW_X86_FEATURE_AVX2) != 0;
+}
+
+/**
+ * Select `a` where `sel` is all 1s and `b` elsewhere
+ */
+static inline __m128i LV_X86_TARGET_SSE2 lv_x86_select_sse2(__m128i sel, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(sel, a), _mm_andnot_si128(sel, b));
+}
+
+/**
+ * Same as `lv_color_24_24_mix()` on every byte:
+ * `m == 0`: keep `d`, `m >= LV_OPA_MAX`: take `s`, else `(s * m + d * (255 - m)) >> 8`
+ * @param s     16 source bytes
+ * @param d     16 destination bytes
+ * @param m     16 mix values, one for each byte
+ * @return      the mixed bytes
+ */
+static inline __m128i LV_X86_TARGET_SSE2 lv_x86_mix_u8_sse2(__m128i s, __m128i d, __m128i m)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v255 = _mm_set1_epi16(255);
+
+    __m128i m_lo = _mm_unpacklo_epi8(m, zero);
+    __m128i m_hi = _mm_unpackhi_epi8(m, zero);
+    __m128i r_lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), m_lo),
+                                 _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_sub_epi16(v255, m_lo)));
+    __m128i r_hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), m_hi),
+                                 _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_sub_epi16(v255, m_hi)));
+    __m128i res = _mm_packus_epi16(_mm_srli_epi16(r_lo, 8), _mm_srli_epi16(r_hi, 8));
+
+    /*m >= LV_OPA_MAX where max(m, LV_OPA_MAX) == m*/
+    __m128i full = _mm_cmpeq_epi8(_mm_max_epu8(m, _mm_set1_epi8((char)LV_OPA_MAX)), m);
+    __m128i none = _mm_cmpeq_epi8(m, zero);
+    res = lv_x86_select_sse2(full, s, res);
+    res = lv_x86_select_sse2(none, d, res);
+    return res;
+}
+
+static inline __m256i LV_X86_TARGET_AVX2 lv_x86_mix_u8_avx2(__m256i s, __m256i d, __m256i m)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i v255 = _mm256_set1_epi16(255);
+
+    /*Unpack and pack work in 128 bit lanes so the byte order is preserved*/
+    __m256i m_lo = _mm256_unpacklo_epi8(m, zero);
+    __m256i m_hi = _mm256_unpackhi_epi8(m, zero);
+    __m256i r_lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), m_lo),
+                                    _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), _mm256_sub_epi16(v255, m_lo)));
+    __m256i r_hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), m_hi),
+                                    _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), _mm256_sub_epi16(v255, m_hi)));
+    __m256i res = _mm256_packus_epi16(_mm256_srli_epi16(r_lo, 8), _mm256_srli_epi16(r_hi, 8));
+
+    __m256i full = _mm256_cmpeq_epi8(_mm256_max_epu8(m, _mm256_set1_epi8((char)LV_OPA_MAX)), m);
+    __m256i none = _mm256_cmpeq_epi8(m, zero);
+    res = _mm256_blendv_epi8(res, s, full);
+    res = _mm256_blendv_epi8(res, d, none);
+    return res;
+}
+
+/**
+ * Spread one mix value per 32 bit pixel to its B, G and R bytes. The X/A byte gets 0
+ * so `lv_x86_mix_u8_...()` leaves it untouched.
+ * @param m32   4 mix values in 32 bit lanes (0..255)
+ * @return      the per-byte mix values
+ */
+static inline __m128i LV_X86_TARGET_SSE2 lv_x86_spread_mix_rgb_sse2(__m128i m32)
+{
+    return _mm_or_si128(m32, _mm_or_si128(_mm_slli_epi32(m32, 8), _mm_slli_epi32(m32, 16)));
+}
+
+static inline __m256i LV_X86_TARGET_AVX2 lv_x86_spread_mix_rgb_avx2(__m256i m32)
+{
+    return _mm256_mullo_epi32(m32, _mm256_set1_epi32(0x00010101));
+}
+
+/**
+ * Load 4 mask values and zero extend them to 32 bit lanes
+ */
+static inline __m128i LV_X86_TARGET_SSE2 lv_x86_load_mask4_sse2(const lv_opa_t * mask)
+{
+    int32_t m;
+    lv_memcpy(&m, mask, sizeof(m));
+    const __m128i zero = _mm_setzero_si128();
+    __m128i m8 = _mm_cvtsi32_si128(m);
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(m8, zero), zero);
+}
+
+static inline __m256i LV_X86_TARGET_AVX2 lv_x86_load_mask8_avx2(const lv_opa_t * mask)
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)mask));
+}
+
+/**
+ * `LV_OPA_MIX2()` on 16 or 32 bit lanes holding values in 0..255
+ */
+static inline __m128i LV_X86_TARGET_SSE2 lv_x86_opa_mix2_sse2(__m128i a, __m128i b)
+{
+    return _mm_srli_epi16(_mm_mullo_epi16(a, b), 8);
+}
+
+static inline __m256i LV_X86_TARGET_AVX2 lv_x86_opa_mix2_avx2(__m256i a, __m256i b)
+{
+    return _mm256_srli_epi16(_mm256_mullo_epi16(a, b), 8);
+}
+
+/**
+ * `LV_OPA_MIX3()` on 16 or 32 bit lanes holding values in 0..255
+ */
+static inline __m128i LV_X86_TARGET_SSE2 lv_x86_opa_mix3_sse2(__m128i a, __m128i b, __m128i c)
+{
+    /*a * b fits into 16 bits and the high half of (a * b) * c is the >> 16*/
+    return _mm_mulhi_epu16(_mm_mullo_epi16(a, b), c);
+}
+
+static inline __m256i LV_X86_TARGET_AVX2 lv_x86_opa_mix3_avx2(__m256i a, __m256i b, __m256i c)
+{
+    return _mm256_mulhi_epu16(_mm256_mullo_epi16(a, b), c);
+}
+
+/**
+ * Low 32 bits of a 32 x 32 bit multiplication. SSE2 has only `_mm_mul_epu32()`.
+ */
+static inline __m128i LV_X86_TARGET_SSE2 lv_x86_mullo_epi32_sse2(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+/**
+ * Get the mix value of a pixel the same way as the generic code
+ */
+static inline uint8_t lv_x86_get_mix(const lv_x86_row_dsc_t * row, const uint8_t * src_px, int32_t x)
+{
+    if(row->src_has_alpha) {
+        uint8_t a = src_px[3];
+        if(row->mask && row->opa < LV_OPA_MAX) return LV_OPA_MIX3(a, row->mask[x], row->opa);
+        if(row->mask) return LV_OPA_MIX2(a, row->mask[x]);
+        if(row->opa < LV_OPA_MAX) return LV_OPA_MIX2(a, row->opa);
+        return a;
+    }
+
+    if(row->mask && row->opa < LV_OPA_MAX) return LV_OPA_MIX2(row->opa, row->mask[x]);
+    if(row->mask) return row->mask[x];
+    return row->opa;
+}
+
+/**
+ * Mix values of 4 pixels in 32 bit lanes
+ */
+static inline __m128i LV_X86_TARGET_SSE2 lv_x86_get_mix4_sse2(const lv_x86_row_dsc_t * row, __m128i src, int32_t x)
+{
+    const __m128i opa_v = _mm_set1_epi32(row->opa);
+    bool use_opa = row->opa < LV_OPA_MAX;
+
+    if(row->src_has_alpha) {
+        __m128i a = _mm_srli_epi32(src, 24);
+        if(row->mask && use_opa) return lv_x86_opa_mix3_sse2(a, lv_x86_load_mask4_sse2(&row->mask[x]), opa_v);
+        if(row->mask) return lv_x86_opa_mix2_sse2(a, lv_x86_load_mask4_sse2(&row->mask[x]));
+        if(use_opa) return lv_x86_opa_mix2_sse2(a, opa_v);
+        return a;
+    }
+
+    if(row->mask && use_opa) return lv_x86_opa_mix2_sse2(lv_x86_load_mask4_sse2(&row->mask[x]), opa_v);
+    if(row->mask) return lv_x86_load_mask4_sse2(&row->mask[x]);
+    return opa_v;
+}
+
+static inline __m256i LV_X86_TARGET_AVX2 lv_x86_get_mix8_avx2(const lv_x86_row_dsc_t * row, __m256i src, int32_t x)
+{
+    const __m256i opa_v = _mm256_set1_epi32(row->opa);
+    bool use_opa = row->opa < LV_OPA_MAX;
+
+    if(row->src_has_alpha) {
+        __m256i a = _mm256_srli_epi32(src, 24);
+        if(row->mask && use_opa) return lv_x86_opa_mix3_avx2(a, lv_x86_load_mask8_avx2(&row->mask[x]), opa_v);
+        if(row->mask) return lv_x86_opa_mix2_avx2(a, lv_x86_load_mask8_avx2(&row->mask[x]));
+        if(use_opa) return lv_x86_opa_mix2_avx2(a, opa_v);
+        return a;
+    }
+
+    if(row->mask && use_opa) return lv_x86_opa_mix2_avx2(lv_x86_load_mask8_avx2(&row->mask[x]), opa_v);
+    if(row->mask) return lv_x86_load_mask8_avx2(&row->mask[x]);
+    return opa_v;
+}
+
+/**
+ * Same as `lv_color_24_24_mix()` for a single pixel. Used for the last few pixels of a line.
+ */
+static inline void LV_ATTRIBUTE_FAST_MEM lv_x86_mix_24_24(const uint8_t * src, uint8_t * dest, uint8_t mix)
+{
+    if(mix == 0) return;
+
+    if(mix >= LV_OPA_MAX) {
+        dest[0] = src[0];
+        dest[1] = src[1];
+        dest[2] = src[2];
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+        dest[0] = (uint32_t)((uint32_t)src[0] * mix + dest[0] * mix_inv) >> 8;
+        dest[1] = (uint32_t)((uint32_t)src[1] * mix + dest[1] * mix_inv) >> 8;
+        dest[2] = (uint32_t)((uint32_t)src[2] * mix + dest[2] * mix_inv) >> 8;
+    }
+}
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_X86_PRIVATE_H*/
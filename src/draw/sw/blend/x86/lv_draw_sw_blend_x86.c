@@ -0,0 +1,231 @@
+/**
+ * @file lv_draw_sw_blend_x86.c
+ * Runtime detection of the SIMD extensions used by the x86 blend routines
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_blend_x86_private.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../../../../misc/lv_log.h"
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#else
+    #include <cpuid.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Not detected yet. Real results always have at least this bit cleared.*/
+#define FEATURES_UNKNOWN    0x80000000
+
+#define CPUID1_EDX_SSE2     (1 << 26)
+#define CPUID1_ECX_OSXSAVE  (1 << 27)
+#define CPUID1_ECX_AVX      (1 << 28)
+#define CPUID7_EBX_AVX2     (1 << 5)
+
+/*XMM and YMM state enabled by the OS in XCR0*/
+#define XCR0_SSE_AVX        0x6
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]);
+static uint32_t read_xcr0(void);
+static uint32_t detect_features(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/*Written only with the same value, so racing draw threads can't corrupt it*/
+static volatile uint32_t features = FEATURES_UNKNOWN;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t lv_draw_sw_blend_x86_get_features(void)
+{
+    uint32_t f = features;
+    if(f == FEATURES_UNKNOWN) {
+        f = detect_features();
+        features = f;
+    }
+
+    return f;
+}
+
+void LV_X86_TARGET_SSE2 lv_draw_sw_blend_x86_fill_u32_sse2(uint32_t * dest, uint32_t value, int32_t w)
+{
+    const __m128i v = _mm_set1_epi32((int32_t)value);
+    int32_t x;
+    for(x = 0; x <= w - 16; x += 16) {
+        _mm_storeu_si128((__m128i *)&dest[x + 0], v);
+        _mm_storeu_si128((__m128i *)&dest[x + 4], v);
+        _mm_storeu_si128((__m128i *)&dest[x + 8], v);
+        _mm_storeu_si128((__m128i *)&dest[x + 12], v);
+    }
+    for(; x <= w - 4; x += 4) {
+        _mm_storeu_si128((__m128i *)&dest[x], v);
+    }
+    for(; x < w; x++) {
+        dest[x] = value;
+    }
+}
+
+void LV_X86_TARGET_AVX2 lv_draw_sw_blend_x86_fill_u32_avx2(uint32_t * dest, uint32_t value, int32_t w)
+{
+    const __m256i v = _mm256_set1_epi32((int32_t)value);
+    int32_t x;
+    for(x = 0; x <= w - 32; x += 32) {
+        _mm256_storeu_si256((__m256i *)&dest[x + 0], v);
+        _mm256_storeu_si256((__m256i *)&dest[x + 8], v);
+        _mm256_storeu_si256((__m256i *)&dest[x + 16], v);
+        _mm256_storeu_si256((__m256i *)&dest[x + 24], v);
+    }
+    for(; x <= w - 8; x += 8) {
+        _mm256_storeu_si256((__m256i *)&dest[x], v);
+    }
+    for(; x < w; x++) {
+        dest[x] = value;
+    }
+}
+
+void LV_X86_TARGET_SSE2 lv_draw_sw_blend_x86_fill_u16_sse2(uint16_t * dest, uint16_t value, int32_t w)
+{
+    const __m128i v = _mm_set1_epi16((int16_t)value);
+    int32_t x;
+    for(x = 0; x <= w - 32; x += 32) {
+        _mm_storeu_si128((__m128i *)&dest[x + 0], v);
+        _mm_storeu_si128((__m128i *)&dest[x + 8], v);
+        _mm_storeu_si128((__m128i *)&dest[x + 16], v);
+        _mm_storeu_si128((__m128i *)&dest[x + 24], v);
+    }
+    for(; x <= w - 8; x += 8) {
+        _mm_storeu_si128((__m128i *)&dest[x], v);
+    }
+    for(; x < w; x++) {
+        dest[x] = value;
+    }
+}
+
+void LV_X86_TARGET_AVX2 lv_draw_sw_blend_x86_fill_u16_avx2(uint16_t * dest, uint16_t value, int32_t w)
+{
+    const __m256i v = _mm256_set1_epi16((int16_t)value);
+    int32_t x;
+    for(x = 0; x <= w - 64; x += 64) {
+        _mm256_storeu_si256((__m256i *)&dest[x + 0], v);
+        _mm256_storeu_si256((__m256i *)&dest[x + 16], v);
+        _mm256_storeu_si256((__m256i *)&dest[x + 32], v);
+        _mm256_storeu_si256((__m256i *)&dest[x + 48], v);
+    }
+    for(; x <= w - 16; x += 16) {
+        _mm256_storeu_si256((__m256i *)&dest[x], v);
+    }
+    for(; x < w; x++) {
+        dest[x] = value;
+    }
+}
+
+void LV_X86_TARGET_SSE2 lv_draw_sw_blend_x86_fill_pattern48_sse2(uint8_t * dest, const uint8_t * pattern, int32_t w,
+                                                                 int32_t h, int32_t stride)
+{
+    const __m128i p0 = _mm_loadu_si128((const __m128i *)&pattern[0]);
+    const __m128i p1 = _mm_loadu_si128((const __m128i *)&pattern[16]);
+    const __m128i p2 = _mm_loadu_si128((const __m128i *)&pattern[32]);
+    int32_t w_bytes = w * 3;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x;
+        for(x = 0; x <= w_bytes - 48; x += 48) {
+            _mm_storeu_si128((__m128i *)&dest[x + 0], p0);
+            _mm_storeu_si128((__m128i *)&dest[x + 16], p1);
+            _mm_storeu_si128((__m128i *)&dest[x + 32], p2);
+        }
+        for(; x < w_bytes; x += 3) {
+            dest[x + 0] = pattern[0];
+            dest[x + 1] = pattern[1];
+            dest[x + 2] = pattern[2];
+        }
+        dest += stride;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t detect_features(void)
+{
+    uint32_t f = 0;
+    uint32_t regs[4]; /*EAX, EBX, ECX, EDX*/
+
+    if(!cpuid(0, 0, regs)) return 0;
+    uint32_t max_leaf = regs[0];
+
+    if(max_leaf < 1 || !cpuid(1, 0, regs)) return 0;
+    if(regs[3] & CPUID1_EDX_SSE2) f |= LV_DRAW_SW_X86_FEATURE_SSE2;
+
+    /*AVX2 needs the CPU support and the OS saving the YMM registers on context switches*/
+    bool avx_os = (regs[2] & CPUID1_ECX_OSXSAVE) && (regs[2] & CPUID1_ECX_AVX) &&
+                  (read_xcr0() & XCR0_SSE_AVX) == XCR0_SSE_AVX;
+    if(avx_os && max_leaf >= 7 && cpuid(7, 0, regs)) {
+        if(regs[1] & CPUID7_EBX_AVX2) f |= LV_DRAW_SW_X86_FEATURE_AVX2;
+    }
+
+    LV_LOG_INFO("x86 blend features: SSE2: %d, AVX2: %d",
+                (f & LV_DRAW_SW_X86_FEATURE_SSE2) ? 1 : 0, (f & LV_DRAW_SW_X86_FEATURE_AVX2) ? 1 : 0);
+
+    return f;
+}
+
+static bool cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+#if defined(_MSC_VER)
+    int r[4];
+    __cpuidex(r, (int)leaf, (int)subleaf);
+    regs[0] = (uint32_t)r[0];
+    regs[1] = (uint32_t)r[1];
+    regs[2] = (uint32_t)r[2];
+    regs[3] = (uint32_t)r[3];
+    return true;
+#else
+    unsigned int a, b, c, d;
+    if(__get_cpuid_count(leaf, subleaf, &a, &b, &c, &d) == 0) return false;
+    regs[0] = a;
+    regs[1] = b;
+    regs[2] = c;
+    regs[3] = d;
+    return true;
+#endif
+}
+
+static uint32_t read_xcr0(void)
+{
+#if defined(_MSC_VER)
+    return (uint32_t)_xgetbv(0);
+#else
+    /*Encoded manually to not require -mxsave*/
+    uint32_t eax, edx;
+    __asm__ volatile(".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0));
+    LV_UNUSED(edx);
+    return eax;
+#endif
+}
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 */
@@ -0,0 +1,352 @@
+/**
+ * @file lv_draw_sw_blend_x86_to_argb8888.c
+ * ARGB8888 blend implementation with SSE2 and AVX2
+ *
+ * Pixels are mixed as if the destination were opaque. Lanes where the destination has
+ * alpha (and both colors are visible) are rare and recalculated with the scalar formula.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_to_argb8888.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../lv_draw_sw_blend_private.h"
+#include "../../../../misc/lv_color_op_private.h"
+#include "lv_blend_x86_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_result_t blend_area(lv_color32_t * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                              lv_x86_row_dsc_t * row, int32_t src_stride, int32_t mask_stride);
+static void blend_row_sse2(lv_color32_t * dest, const lv_x86_row_dsc_t * row, int32_t w);
+static void blend_row_avx2(lv_color32_t * dest, const lv_x86_row_dsc_t * row, int32_t w);
+static void blend_px(lv_color32_t * dest, const lv_x86_row_dsc_t * row, int32_t x, lv_color32_t bg);
+static inline lv_color32_t lv_color_32_32_mix(lv_color32_t fg, lv_color32_t bg);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    if(!lv_x86_has_sse2()) return LV_RESULT_INVALID;
+
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    uint8_t * dest_buf = dsc->dest_buf;
+    bool avx2 = lv_x86_has_avx2();
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        if(avx2) lv_draw_sw_blend_x86_fill_u32_avx2((uint32_t *)dest_buf, color32, dsc->dest_w);
+        else lv_draw_sw_blend_x86_fill_u32_sse2((uint32_t *)dest_buf, color32, dsc->dest_w);
+        dest_buf = drawbuf_next_row(dest_buf, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.color32 = lv_color_to_u32(dsc->color);
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, 0, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.color32 = lv_color_to_u32(dsc->color);
+    row.mask = dsc->mask_buf;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, 0, dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.color32 = lv_color_to_u32(dsc->color);
+    row.mask = dsc->mask_buf;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, 0, dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_argb8888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                             uint32_t src_px_size)
+{
+    /*Expanding 3 byte pixels is left to the generic code*/
+    if(src_px_size != 4) return LV_RESULT_INVALID;
+
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_argb8888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                              uint32_t src_px_size)
+{
+    if(src_px_size != 4) return LV_RESULT_INVALID;
+
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.mask = dsc->mask_buf;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride,
+                      dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_argb8888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                  uint32_t src_px_size)
+{
+    if(src_px_size != 4) return LV_RESULT_INVALID;
+
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.mask = dsc->mask_buf;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride,
+                      dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.mask = dsc->mask_buf;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride,
+                      dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.mask = dsc->mask_buf;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride,
+                      dsc->mask_stride);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t blend_area(lv_color32_t * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                              lv_x86_row_dsc_t * row, int32_t src_stride, int32_t mask_stride)
+{
+    if(!lv_x86_has_sse2()) return LV_RESULT_INVALID;
+
+    bool avx2 = lv_x86_has_avx2();
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        if(avx2) blend_row_avx2(dest_buf, row, w);
+        else blend_row_sse2(dest_buf, row, w);
+
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        if(row->src) row->src += src_stride;
+        if(row->mask) row->mask += mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Mix 4 pixels like `lv_color_32_32_mix()` assuming the background is opaque where both
+ * colors are visible.
+ * @param fg        4 foreground colors, their alpha byte is ignored
+ * @param fa        alpha of the foreground colors in 32 bit lanes
+ * @param bg        4 background colors
+ * @param slow      store a bit for each pixel which needs to be recalculated
+ * @return          the mixed pixels
+ */
+static inline __m128i LV_X86_TARGET_SSE2 mix_argb_sse2(__m128i fg, __m128i fa, __m128i bg, int * slow)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v255 = _mm_set1_epi16(255);
+    const __m128i alpha_mask = _mm_set1_epi32((int32_t)0xff000000);
+
+    __m128i ba = _mm_srli_epi32(bg, 24);
+    __m128i sel_fg = _mm_or_si128(_mm_cmpgt_epi32(fa, _mm_set1_epi32(LV_OPA_MAX - 1)),
+                                  _mm_cmplt_epi32(ba, _mm_set1_epi32(LV_OPA_MIN + 1)));
+    __m128i sel_bg = _mm_cmplt_epi32(fa, _mm_set1_epi32(LV_OPA_MIN + 1));
+    __m128i bg_opaque = _mm_cmpeq_epi32(ba, _mm_set1_epi32(255));
+    __m128i fast = _mm_or_si128(_mm_or_si128(sel_fg, sel_bg), bg_opaque);
+    *slow = _mm_movemask_ps(_mm_castsi128_ps(fast)) ^ 0xf;
+
+    /*LV_UDIV255(fg * fa + bg * (255 - fa)) on every channel*/
+    __m128i fa8 = lv_x86_spread_mix_rgb_sse2(fa);
+    __m128i fa_lo = _mm_unpacklo_epi8(fa8, zero);
+    __m128i fa_hi = _mm_unpackhi_epi8(fa8, zero);
+    __m128i r_lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(fg, zero), fa_lo),
+                                 _mm_mullo_epi16(_mm_unpacklo_epi8(bg, zero), _mm_sub_epi16(v255, fa_lo)));
+    __m128i r_hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(fg, zero), fa_hi),
+                                 _mm_mullo_epi16(_mm_unpackhi_epi8(bg, zero), _mm_sub_epi16(v255, fa_hi)));
+    const __m128i udiv255 = _mm_set1_epi16((int16_t)0x8081);
+    r_lo = _mm_srli_epi16(_mm_mulhi_epu16(r_lo, udiv255), 7);
+    r_hi = _mm_srli_epi16(_mm_mulhi_epu16(r_hi, udiv255), 7);
+    __m128i mixed = lv_x86_select_sse2(alpha_mask, bg, _mm_packus_epi16(r_lo, r_hi));
+
+    __m128i fg_a = _mm_or_si128(_mm_andnot_si128(alpha_mask, fg), _mm_slli_epi32(fa, 24));
+    __m128i res = lv_x86_select_sse2(sel_bg, bg, mixed);
+    return lv_x86_select_sse2(sel_fg, fg_a, res);
+}
+
+static inline __m256i LV_X86_TARGET_AVX2 mix_argb_avx2(__m256i fg, __m256i fa, __m256i bg, int * slow)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i v255 = _mm256_set1_epi16(255);
+    const __m256i alpha_mask = _mm256_set1_epi32((int32_t)0xff000000);
+
+    __m256i ba = _mm256_srli_epi32(bg, 24);
+    __m256i sel_fg = _mm256_or_si256(_mm256_cmpgt_epi32(fa, _mm256_set1_epi32(LV_OPA_MAX - 1)),
+                                     _mm256_cmpgt_epi32(_mm256_set1_epi32(LV_OPA_MIN + 1), ba));
+    __m256i sel_bg = _mm256_cmpgt_epi32(_mm256_set1_epi32(LV_OPA_MIN + 1), fa);
+    __m256i bg_opaque = _mm256_cmpeq_epi32(ba, _mm256_set1_epi32(255));
+    __m256i fast = _mm256_or_si256(_mm256_or_si256(sel_fg, sel_bg), bg_opaque);
+    *slow = _mm256_movemask_ps(_mm256_castsi256_ps(fast)) ^ 0xff;
+
+    __m256i fa8 = lv_x86_spread_mix_rgb_avx2(fa);
+    __m256i fa_lo = _mm256_unpacklo_epi8(fa8, zero);
+    __m256i fa_hi = _mm256_unpackhi_epi8(fa8, zero);
+    __m256i r_lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(fg, zero), fa_lo),
+                                    _mm256_mullo_epi16(_mm256_unpacklo_epi8(bg, zero), _mm256_sub_epi16(v255, fa_lo)));
+    __m256i r_hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(fg, zero), fa_hi),
+                                    _mm256_mullo_epi16(_mm256_unpackhi_epi8(bg, zero), _mm256_sub_epi16(v255, fa_hi)));
+    const __m256i udiv255 = _mm256_set1_epi16((int16_t)0x8081);
+    r_lo = _mm256_srli_epi16(_mm256_mulhi_epu16(r_lo, udiv255), 7);
+    r_hi = _mm256_srli_epi16(_mm256_mulhi_epu16(r_hi, udiv255), 7);
+    __m256i mixed = _mm256_blendv_epi8(_mm256_packus_epi16(r_lo, r_hi), bg, alpha_mask);
+
+    __m256i fg_a = _mm256_or_si256(_mm256_andnot_si256(alpha_mask, fg), _mm256_slli_epi32(fa, 24));
+    __m256i res = _mm256_blendv_epi8(mixed, bg, sel_bg);
+    return _mm256_blendv_epi8(res, fg_a, sel_fg);
+}
+
+static void LV_X86_TARGET_SSE2 blend_row_sse2(lv_color32_t * dest, const lv_x86_row_dsc_t * row, int32_t w)
+{
+    const __m128i color_v = _mm_set1_epi32((int32_t)row->color32);
+    lv_color32_t bg[4];
+    int32_t x;
+    for(x = 0; x <= w - 4; x += 4) {
+        __m128i s = row->src ? _mm_loadu_si128((const __m128i *)&row->src[x * 4]) : color_v;
+        __m128i d = _mm_loadu_si128((const __m128i *)&dest[x]);
+        int slow;
+        __m128i res = mix_argb_sse2(s, lv_x86_get_mix4_sse2(row, s, x), d, &slow);
+        if(slow) _mm_storeu_si128((__m128i *)bg, d);
+        _mm_storeu_si128((__m128i *)&dest[x], res);
+
+        int i;
+        for(i = 0; slow; i++, slow >>= 1) {
+            if(slow & 1) blend_px(dest, row, x + i, bg[i]);
+        }
+    }
+
+    for(; x < w; x++) {
+        blend_px(dest, row, x, dest[x]);
+    }
+}
+
+static void LV_X86_TARGET_AVX2 blend_row_avx2(lv_color32_t * dest, const lv_x86_row_dsc_t * row, int32_t w)
+{
+    const __m256i color_v = _mm256_set1_epi32((int32_t)row->color32);
+    lv_color32_t bg[8];
+    int32_t x;
+    for(x = 0; x <= w - 8; x += 8) {
+        __m256i s = row->src ? _mm256_loadu_si256((const __m256i *)&row->src[x * 4]) : color_v;
+        __m256i d = _mm256_loadu_si256((const __m256i *)&dest[x]);
+        int slow;
+        __m256i res = mix_argb_avx2(s, lv_x86_get_mix8_avx2(row, s, x), d, &slow);
+        if(slow) _mm256_storeu_si256((__m256i *)bg, d);
+        _mm256_storeu_si256((__m256i *)&dest[x], res);
+
+        int i;
+        for(i = 0; slow; i++, slow >>= 1) {
+            if(slow & 1) blend_px(dest, row, x + i, bg[i]);
+        }
+    }
+
+    for(; x < w; x++) {
+        blend_px(dest, row, x, dest[x]);
+    }
+}
+
+/**
+ * Blend a single pixel with the scalar formula
+ * @param dest      the destination line
+ * @param row       the source and mix values of the line
+ * @param x         index of the pixel
+ * @param bg        the original color of the destination pixel
+ */
+static void blend_px(lv_color32_t * dest, const lv_x86_row_dsc_t * row, int32_t x, lv_color32_t bg)
+{
+    const uint8_t * src_px = row->src ? &row->src[x * 4] : (const uint8_t *)&row->color32;
+    lv_color32_t fg;
+    lv_memcpy(&fg, src_px, sizeof(fg));
+    fg.alpha = lv_x86_get_mix(row, src_px, x);
+    dest[x] = lv_color_32_32_mix(fg, bg);
+}
+
+/**
+ * Same as the function of the generic code without the cache
+ */
+static inline lv_color32_t lv_color_32_32_mix(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha >= LV_OPA_MAX || bg.alpha <= LV_OPA_MIN) {
+        return fg;
+    }
+    else if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    else if(bg.alpha == 255) {
+        return lv_color_mix32_inline(fg, bg);
+    }
+    else {
+        lv_opa_t res_alpha = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+        fg.alpha = (uint32_t)((uint32_t)fg.alpha * 255) / res_alpha;
+        lv_color32_t res = lv_color_mix32_inline(fg, bg);
+        res.alpha = res_alpha;
+        return res;
+    }
+}
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 */
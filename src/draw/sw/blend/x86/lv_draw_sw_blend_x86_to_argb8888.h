@@ -0,0 +1,118 @@
+/**
+ * @file lv_draw_sw_blend_x86_to_argb8888.h
+ */
+
+#ifndef LV_DRAW_SW_BLEND_X86_TO_ARGB8888_H
+#define LV_DRAW_SW_BLEND_X86_TO_ARGB8888_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../../../../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Color fill to ARGB8888 */
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888(dsc) \
+    lv_draw_sw_blend_x86_color_to_argb8888(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA(dsc) \
+    lv_draw_sw_blend_x86_color_to_argb8888_with_opa(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK(dsc) \
+    lv_draw_sw_blend_x86_color_to_argb8888_with_mask(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA(dsc) \
+    lv_draw_sw_blend_x86_color_to_argb8888_with_opa_mask(dsc)
+#endif
+
+/* XRGB8888 image blend to ARGB8888. The plain copy is left to `lv_memcpy`.*/
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc, src_px_size) \
+    lv_draw_sw_blend_x86_rgb888_to_argb8888_with_opa(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc, src_px_size) \
+    lv_draw_sw_blend_x86_rgb888_to_argb8888_with_mask(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc, src_px_size) \
+    lv_draw_sw_blend_x86_rgb888_to_argb8888_with_opa_mask(dsc, src_px_size)
+#endif
+
+/* ARGB8888 image blend to ARGB8888 */
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888(dsc) \
+    lv_draw_sw_blend_x86_argb8888_to_argb8888(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc) \
+    lv_draw_sw_blend_x86_argb8888_to_argb8888_with_opa(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc) \
+    lv_draw_sw_blend_x86_argb8888_to_argb8888_with_mask(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc) \
+    lv_draw_sw_blend_x86_argb8888_to_argb8888_with_opa_mask(dsc)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_argb8888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                             uint32_t src_px_size);
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_argb8888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                              uint32_t src_px_size);
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_argb8888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                  uint32_t src_px_size);
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LV_DRAW_SW_BLEND_X86_TO_ARGB8888_H */
@@ -0,0 +1,342 @@
+/**
+ * @file lv_draw_sw_blend_x86_to_rgb565.c
+ * RGB565 blend implementation with SSE2 and AVX2
+ *
+ * The pixels are unpacked to 32 bit lanes so the bit tricks of `lv_color_16_16_mix()`
+ * can be reproduced exactly.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_to_rgb565.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../lv_draw_sw_blend_private.h"
+#include "../../../../misc/lv_color_op_private.h"
+#include "lv_blend_x86_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_result_t blend_area(uint16_t * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                              lv_x86_row_dsc_t * row, int32_t src_stride, int32_t mask_stride);
+static void blend_row_sse2(uint16_t * dest, const lv_x86_row_dsc_t * row, int32_t w);
+static void blend_row_avx2(uint16_t * dest, const lv_x86_row_dsc_t * row, int32_t w);
+static void blend_px_tail(uint16_t * dest, const lv_x86_row_dsc_t * row, int32_t x_start, int32_t w);
+static inline uint16_t lv_color_24_16_mix(const uint8_t * c1, uint16_t c2, uint8_t mix);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    if(!lv_x86_has_sse2()) return LV_RESULT_INVALID;
+
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest_buf = dsc->dest_buf;
+    bool avx2 = lv_x86_has_avx2();
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        if(avx2) lv_draw_sw_blend_x86_fill_u16_avx2(dest_buf, color16, dsc->dest_w);
+        else lv_draw_sw_blend_x86_fill_u16_sse2(dest_buf, color16, dsc->dest_w);
+        dest_buf = drawbuf_next_row(dest_buf, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.color32 = lv_color_to_u16(dsc->color);
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, 0, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.color32 = lv_color_to_u16(dsc->color);
+    row.mask = dsc->mask_buf;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, 0, dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.color32 = lv_color_to_u16(dsc->color);
+    row.mask = dsc->mask_buf;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, 0, dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb565_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 2;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb565_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 2;
+    row.mask = dsc->mask_buf;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride,
+                      dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb565_to_rgb565_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 2;
+    row.mask = dsc->mask_buf;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride,
+                      dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.mask = dsc->mask_buf;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride,
+                      dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb565_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.mask = dsc->mask_buf;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, &row, dsc->src_stride,
+                      dsc->mask_stride);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t blend_area(uint16_t * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                              lv_x86_row_dsc_t * row, int32_t src_stride, int32_t mask_stride)
+{
+    if(!lv_x86_has_sse2()) return LV_RESULT_INVALID;
+
+    bool avx2 = lv_x86_has_avx2();
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        if(avx2) blend_row_avx2(dest_buf, row, w);
+        else blend_row_sse2(dest_buf, row, w);
+
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        if(row->src) row->src += src_stride;
+        if(row->mask) row->mask += mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Same as `lv_color_16_16_mix()` on RGB565 colors in 32 bit lanes
+ */
+static inline __m128i LV_X86_TARGET_SSE2 mix_16_16_sse2(__m128i c1, __m128i c2, __m128i mix)
+{
+    /*The special cases of the scalar code (mix 0 or 255, same colors) give the same result*/
+    const __m128i mask = _mm_set1_epi32(0x07E0F81F);
+    __m128i m = _mm_srli_epi32(_mm_add_epi32(mix, _mm_set1_epi32(4)), 3);
+    __m128i fg = _mm_and_si128(_mm_or_si128(c1, _mm_slli_epi32(c1, 16)), mask);
+    __m128i bg = _mm_and_si128(_mm_or_si128(c2, _mm_slli_epi32(c2, 16)), mask);
+    __m128i res = _mm_srli_epi32(lv_x86_mullo_epi32_sse2(_mm_sub_epi32(fg, bg), m), 5);
+    res = _mm_and_si128(_mm_add_epi32(res, bg), mask);
+    return _mm_and_si128(_mm_or_si128(_mm_srli_epi32(res, 16), res), _mm_set1_epi32(0xffff));
+}
+
+static inline __m256i LV_X86_TARGET_AVX2 mix_16_16_avx2(__m256i c1, __m256i c2, __m256i mix)
+{
+    const __m256i mask = _mm256_set1_epi32(0x07E0F81F);
+    __m256i m = _mm256_srli_epi32(_mm256_add_epi32(mix, _mm256_set1_epi32(4)), 3);
+    __m256i fg = _mm256_and_si256(_mm256_or_si256(c1, _mm256_slli_epi32(c1, 16)), mask);
+    __m256i bg = _mm256_and_si256(_mm256_or_si256(c2, _mm256_slli_epi32(c2, 16)), mask);
+    __m256i res = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(fg, bg), m), 5);
+    res = _mm256_and_si256(_mm256_add_epi32(res, bg), mask);
+    return _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi32(res, 16), res), _mm256_set1_epi32(0xffff));
+}
+
+/**
+ * Same as `lv_color_24_16_mix()` with ARGB8888 source pixels and RGB565 colors in 32 bit lanes
+ */
+static inline __m128i LV_X86_TARGET_SSE2 mix_24_16_sse2(__m128i c1, __m128i c2, __m128i mix)
+{
+    const __m128i m5 = _mm_set1_epi32(0x1F);
+    const __m128i m6 = _mm_set1_epi32(0x3F);
+    /*All products fit into 16 bits*/
+    __m128i mix_inv = _mm_sub_epi32(_mm_set1_epi32(255), mix);
+
+    __m128i sr = _mm_and_si128(_mm_srli_epi32(c1, 19), m5);
+    __m128i sg = _mm_and_si128(_mm_srli_epi32(c1, 10), m6);
+    __m128i sb = _mm_and_si128(_mm_srli_epi32(c1, 3), m5);
+    __m128i dr = _mm_and_si128(_mm_srli_epi32(c2, 11), m5);
+    __m128i dg = _mm_and_si128(_mm_srli_epi32(c2, 5), m6);
+    __m128i db = _mm_and_si128(c2, m5);
+
+    __m128i r = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(sr, mix), _mm_mullo_epi16(dr, mix_inv)), 8);
+    __m128i g = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(sg, mix), _mm_mullo_epi16(dg, mix_inv)), 8);
+    __m128i b = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(sb, mix), _mm_mullo_epi16(db, mix_inv)), 8);
+    __m128i res = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 11), _mm_slli_epi32(g, 5)), b);
+
+    __m128i full = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(sr, 11), _mm_slli_epi32(sg, 5)), sb);
+    res = lv_x86_select_sse2(_mm_cmpeq_epi32(mix, _mm_set1_epi32(255)), full, res);
+    return lv_x86_select_sse2(_mm_cmpeq_epi32(mix, _mm_setzero_si128()), c2, res);
+}
+
+static inline __m256i LV_X86_TARGET_AVX2 mix_24_16_avx2(__m256i c1, __m256i c2, __m256i mix)
+{
+    const __m256i m5 = _mm256_set1_epi32(0x1F);
+    const __m256i m6 = _mm256_set1_epi32(0x3F);
+    __m256i mix_inv = _mm256_sub_epi32(_mm256_set1_epi32(255), mix);
+
+    __m256i sr = _mm256_and_si256(_mm256_srli_epi32(c1, 19), m5);
+    __m256i sg = _mm256_and_si256(_mm256_srli_epi32(c1, 10), m6);
+    __m256i sb = _mm256_and_si256(_mm256_srli_epi32(c1, 3), m5);
+    __m256i dr = _mm256_and_si256(_mm256_srli_epi32(c2, 11), m5);
+    __m256i dg = _mm256_and_si256(_mm256_srli_epi32(c2, 5), m6);
+    __m256i db = _mm256_and_si256(c2, m5);
+
+    __m256i r = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(sr, mix), _mm256_mullo_epi16(dr, mix_inv)), 8);
+    __m256i g = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(sg, mix), _mm256_mullo_epi16(dg, mix_inv)), 8);
+    __m256i b = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(sb, mix), _mm256_mullo_epi16(db, mix_inv)), 8);
+    __m256i res = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(r, 11), _mm256_slli_epi32(g, 5)), b);
+
+    __m256i full = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(sr, 11), _mm256_slli_epi32(sg, 5)), sb);
+    res = _mm256_blendv_epi8(res, full, _mm256_cmpeq_epi32(mix, _mm256_set1_epi32(255)));
+    return _mm256_blendv_epi8(res, c2, _mm256_cmpeq_epi32(mix, _mm256_setzero_si256()));
+}
+
+static void LV_X86_TARGET_SSE2 blend_row_sse2(uint16_t * dest, const lv_x86_row_dsc_t * row, int32_t w)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i color_v = _mm_set1_epi32((int32_t)row->color32);
+    int32_t x;
+    for(x = 0; x <= w - 4; x += 4) {
+        __m128i d = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest[x]), zero);
+        __m128i res;
+        if(row->src_has_alpha) {
+            __m128i s = _mm_loadu_si128((const __m128i *)&row->src[x * 4]);
+            res = mix_24_16_sse2(s, d, lv_x86_get_mix4_sse2(row, s, x));
+        }
+        else {
+            __m128i s = color_v;
+            if(row->src) s = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&row->src[x * 2]), zero);
+            res = mix_16_16_sse2(s, d, lv_x86_get_mix4_sse2(row, s, x));
+        }
+
+        /*SSE2 can pack only with signed saturation so sign extend the 16 bit values first*/
+        res = _mm_srai_epi32(_mm_slli_epi32(res, 16), 16);
+        _mm_storel_epi64((__m128i *)&dest[x], _mm_packs_epi32(res, res));
+    }
+
+    blend_px_tail(dest, row, x, w);
+}
+
+static void LV_X86_TARGET_AVX2 blend_row_avx2(uint16_t * dest, const lv_x86_row_dsc_t * row, int32_t w)
+{
+    const __m256i color_v = _mm256_set1_epi32((int32_t)row->color32);
+    int32_t x;
+    for(x = 0; x <= w - 8; x += 8) {
+        __m256i d = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&dest[x]));
+        __m256i res;
+        if(row->src_has_alpha) {
+            __m256i s = _mm256_loadu_si256((const __m256i *)&row->src[x * 4]);
+            res = mix_24_16_avx2(s, d, lv_x86_get_mix8_avx2(row, s, x));
+        }
+        else {
+            __m256i s = color_v;
+            if(row->src) s = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&row->src[x * 2]));
+            res = mix_16_16_avx2(s, d, lv_x86_get_mix8_avx2(row, s, x));
+        }
+
+        /*Packing works in 128 bit lanes, move the two halves next to each other*/
+        res = _mm256_permute4x64_epi64(_mm256_packus_epi32(res, res), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128((__m128i *)&dest[x], _mm256_castsi256_si128(res));
+    }
+
+    blend_px_tail(dest, row, x, w);
+}
+
+static void blend_px_tail(uint16_t * dest, const lv_x86_row_dsc_t * row, int32_t x_start, int32_t w)
+{
+    int32_t x;
+    for(x = x_start; x < w; x++) {
+        if(row->src_has_alpha) {
+            const uint8_t * src_px = &row->src[x * 4];
+            dest[x] = lv_color_24_16_mix(src_px, dest[x], lv_x86_get_mix(row, src_px, x));
+        }
+        else {
+            uint16_t c = row->src ? ((const uint16_t *)row->src)[x] : (uint16_t)row->color32;
+            dest[x] = lv_color_16_16_mix_inline(c, dest[x], lv_x86_get_mix(row, NULL, x));
+        }
+    }
+}
+
+static inline uint16_t lv_color_24_16_mix(const uint8_t * c1, uint16_t c2, uint8_t mix)
+{
+    if(mix == 0) {
+        return c2;
+    }
+    else if(mix == 255) {
+        return ((c1[2] & 0xF8) << 8)  + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+
+        return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+               ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+               (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+    }
+}
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 */
@@ -0,0 +1,327 @@
+/**
+ * @file lv_draw_sw_blend_x86_to_rgb888.c
+ * RGB888/XRGB8888 blend implementation with SSE2 and AVX2
+ *
+ * Supports both dest_px_size=3 (RGB888) and dest_px_size=4 (XRGB8888).
+ * Every pixel gets a mix value from the opacity, the mask and the source alpha
+ * and is mixed with `lv_x86_mix_u8_...()`, which is bit-exact with `lv_color_24_24_mix()`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_to_rgb888.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../lv_draw_sw_blend_private.h"
+#include "lv_blend_x86_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Pixels processed in one step of the RGB888 loops (48 bytes = 3 SSE registers)*/
+#define RGB888_CHUNK_PX     16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_result_t blend_area(uint8_t * dest_buf, int32_t dest_stride, uint32_t dest_px_size, int32_t w, int32_t h,
+                              lv_x86_row_dsc_t * row, int32_t src_stride, int32_t mask_stride);
+static void blend_row_xrgb8888_sse2(uint8_t * dest, const lv_x86_row_dsc_t * row, int32_t w);
+static void blend_row_xrgb8888_avx2(uint8_t * dest, const lv_x86_row_dsc_t * row, int32_t w);
+static void blend_row_rgb888_sse2(uint8_t * dest, const lv_x86_row_dsc_t * row, int32_t w);
+static void blend_px_tail(uint8_t * dest, uint32_t dest_px_size, const lv_x86_row_dsc_t * row, int32_t x_start, int32_t w);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb888(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size)
+{
+    LV_ASSERT(dest_px_size == 3 || dest_px_size == 4);
+    if(!lv_x86_has_sse2()) return LV_RESULT_INVALID;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    int32_t dest_stride = dsc->dest_stride;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t x;
+    int32_t y;
+
+    if(dest_px_size == 4) {
+        uint32_t color32 = lv_color_to_u32(dsc->color);
+        if(lv_x86_has_avx2()) {
+            for(y = 0; y < h; y++) {
+                lv_draw_sw_blend_x86_fill_u32_avx2((uint32_t *)dest_buf, color32, w);
+                dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+            }
+        }
+        else {
+            for(y = 0; y < h; y++) {
+                lv_draw_sw_blend_x86_fill_u32_sse2((uint32_t *)dest_buf, color32, w);
+                dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+            }
+        }
+        return LV_RESULT_OK;
+    }
+
+    /*RGB888: store 16 pixels (48 bytes) of a repeated B, G, R pattern in one step*/
+    uint8_t pattern[RGB888_CHUNK_PX * 3];
+    for(x = 0; x < RGB888_CHUNK_PX * 3; x += 3) {
+        pattern[x + 0] = dsc->color.blue;
+        pattern[x + 1] = dsc->color.green;
+        pattern[x + 2] = dsc->color.red;
+    }
+
+    lv_draw_sw_blend_x86_fill_pattern48_sse2(dest_buf, pattern, w, h, dest_stride);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb888_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.color32 = lv_color_to_u32(dsc->color);
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dest_px_size, dsc->dest_w, dsc->dest_h, &row, 0, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb888_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.color32 = lv_color_to_u32(dsc->color);
+    row.mask = dsc->mask_buf;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dest_px_size, dsc->dest_w, dsc->dest_h, &row, 0,
+                      dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb888_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc,
+                                                               uint32_t dest_px_size)
+{
+    lv_x86_row_dsc_t row = {0};
+    row.color32 = lv_color_to_u32(dsc->color);
+    row.mask = dsc->mask_buf;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dest_px_size, dsc->dest_w, dsc->dest_h, &row, 0,
+                      dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_rgb888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                           uint32_t dest_px_size, uint32_t src_px_size)
+{
+    /*Converting between 3 and 4 byte pixels is left to the generic code*/
+    if(src_px_size != dest_px_size) return LV_RESULT_INVALID;
+
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = src_px_size;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dest_px_size, dsc->dest_w, dsc->dest_h, &row,
+                      dsc->src_stride, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_rgb888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                            uint32_t dest_px_size, uint32_t src_px_size)
+{
+    if(src_px_size != dest_px_size) return LV_RESULT_INVALID;
+
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = src_px_size;
+    row.mask = dsc->mask_buf;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dest_px_size, dsc->dest_w, dsc->dest_h, &row,
+                      dsc->src_stride, dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_rgb888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                uint32_t dest_px_size, uint32_t src_px_size)
+{
+    if(src_px_size != dest_px_size) return LV_RESULT_INVALID;
+
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = src_px_size;
+    row.mask = dsc->mask_buf;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dest_px_size, dsc->dest_w, dsc->dest_h, &row,
+                      dsc->src_stride, dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb888(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size)
+{
+    /*The alpha channel needs to be separated from the colors for RGB888. Let the generic code do it.*/
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dest_px_size, dsc->dest_w, dsc->dest_h, &row,
+                      dsc->src_stride, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                             uint32_t dest_px_size)
+{
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dest_px_size, dsc->dest_w, dsc->dest_h, &row,
+                      dsc->src_stride, 0);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                              uint32_t dest_px_size)
+{
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.mask = dsc->mask_buf;
+    row.opa = LV_OPA_COVER;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dest_px_size, dsc->dest_w, dsc->dest_h, &row,
+                      dsc->src_stride, dsc->mask_stride);
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                  uint32_t dest_px_size)
+{
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    lv_x86_row_dsc_t row = {0};
+    row.src = dsc->src_buf;
+    row.src_px_size = 4;
+    row.src_has_alpha = true;
+    row.mask = dsc->mask_buf;
+    row.opa = dsc->opa;
+    return blend_area(dsc->dest_buf, dsc->dest_stride, dest_px_size, dsc->dest_w, dsc->dest_h, &row,
+                      dsc->src_stride, dsc->mask_stride);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t blend_area(uint8_t * dest_buf, int32_t dest_stride, uint32_t dest_px_size, int32_t w, int32_t h,
+                              lv_x86_row_dsc_t * row, int32_t src_stride, int32_t mask_stride)
+{
+    LV_ASSERT(dest_px_size == 3 || dest_px_size == 4);
+    if(!lv_x86_has_sse2()) return LV_RESULT_INVALID;
+
+    /*Nothing to draw (scalar code would skip every pixel too)*/
+    if(row->mask == NULL && row->opa == LV_OPA_TRANSP) return LV_RESULT_OK;
+
+    bool avx2 = lv_x86_has_avx2();
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        if(dest_px_size == 3) blend_row_rgb888_sse2(dest_buf, row, w);
+        else if(avx2) blend_row_xrgb8888_avx2(dest_buf, row, w);
+        else blend_row_xrgb8888_sse2(dest_buf, row, w);
+
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        if(row->src) row->src += src_stride;
+        if(row->mask) row->mask += mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static void blend_px_tail(uint8_t * dest, uint32_t dest_px_size, const lv_x86_row_dsc_t * row, int32_t x_start, int32_t w)
+{
+    int32_t x;
+    for(x = x_start; x < w; x++) {
+        const uint8_t * src_px = row->src ? &row->src[x * row->src_px_size] : (const uint8_t *)&row->color32;
+        lv_x86_mix_24_24(src_px, &dest[x * dest_px_size], lv_x86_get_mix(row, src_px, x));
+    }
+}
+
+static void LV_X86_TARGET_SSE2 blend_row_xrgb8888_sse2(uint8_t * dest, const lv_x86_row_dsc_t * row, int32_t w)
+{
+    const __m128i color_v = _mm_set1_epi32((int32_t)row->color32);
+    int32_t x;
+    for(x = 0; x <= w - 4; x += 4) {
+        __m128i s = row->src ? _mm_loadu_si128((const __m128i *)&row->src[x * 4]) : color_v;
+        __m128i m = lv_x86_spread_mix_rgb_sse2(lv_x86_get_mix4_sse2(row, s, x));
+        __m128i d = _mm_loadu_si128((const __m128i *)&dest[x * 4]);
+        _mm_storeu_si128((__m128i *)&dest[x * 4], lv_x86_mix_u8_sse2(s, d, m));
+    }
+
+    blend_px_tail(dest, 4, row, x, w);
+}
+
+static void LV_X86_TARGET_AVX2 blend_row_xrgb8888_avx2(uint8_t * dest, const lv_x86_row_dsc_t * row, int32_t w)
+{
+    const __m256i color_v = _mm256_set1_epi32((int32_t)row->color32);
+    int32_t x;
+    for(x = 0; x <= w - 8; x += 8) {
+        __m256i s = row->src ? _mm256_loadu_si256((const __m256i *)&row->src[x * 4]) : color_v;
+        __m256i m = lv_x86_spread_mix_rgb_avx2(lv_x86_get_mix8_avx2(row, s, x));
+        __m256i d = _mm256_loadu_si256((const __m256i *)&dest[x * 4]);
+        _mm256_storeu_si256((__m256i *)&dest[x * 4], lv_x86_mix_u8_avx2(s, d, m));
+    }
+
+    blend_px_tail(dest, 4, row, x, w);
+}
+
+static void LV_X86_TARGET_SSE2 blend_row_rgb888_sse2(uint8_t * dest, const lv_x86_row_dsc_t * row, int32_t w)
+{
+    /*3 byte pixels don't fit into the registers evenly, so process 16 pixels (3 registers)
+     *in one step and prepare the per-byte mix values in a small buffer if they change per pixel*/
+    uint8_t pattern[RGB888_CHUNK_PX * 3];
+    uint8_t mix[RGB888_CHUNK_PX * 3];
+    __m128i s[3];
+    __m128i m[3];
+    int32_t i;
+
+    if(row->src == NULL) {
+        for(i = 0; i < RGB888_CHUNK_PX * 3; i += 3) lv_memcpy(&pattern[i], &row->color32, 3);
+        for(i = 0; i < 3; i++) s[i] = _mm_loadu_si128((const __m128i *)&pattern[i * 16]);
+    }
+
+    if(row->mask == NULL) {
+        for(i = 0; i < 3; i++) m[i] = _mm_set1_epi8((char)row->opa);
+    }
+
+    int32_t x;
+    for(x = 0; x <= w - RGB888_CHUNK_PX; x += RGB888_CHUNK_PX) {
+        uint8_t * d = &dest[x * 3];
+        if(row->src) {
+            for(i = 0; i < 3; i++) s[i] = _mm_loadu_si128((const __m128i *)&row->src[x * 3 + i * 16]);
+        }
+
+        if(row->mask) {
+            int32_t px;
+            for(px = 0; px < RGB888_CHUNK_PX; px++) {
+                uint8_t v = lv_x86_get_mix(row, NULL, x + px);
+                mix[px * 3 + 0] = v;
+                mix[px * 3 + 1] = v;
+                mix[px * 3 + 2] = v;
+            }
+            for(i = 0; i < 3; i++) m[i] = _mm_loadu_si128((const __m128i *)&mix[i * 16]);
+        }
+
+        for(i = 0; i < 3; i++) {
+            __m128i dv = _mm_loadu_si128((const __m128i *)&d[i * 16]);
+            _mm_storeu_si128((__m128i *)&d[i * 16], lv_x86_mix_u8_sse2(s[i], dv, m[i]));
+        }
+    }
+
+    blend_px_tail(dest, 3, row, x, w);
+}
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 */
@@ -0,0 +1,149 @@
+/**
+ * @file lv_draw_sw_blur_x86.c
+ * Vertical pass of the SW blur with AVX2
+ *
+ * The columns are independent, so the filter step of a row is calculated for 4 pixels
+ * at once, 2 pixels (8 channels) in a register. The results are bit-exact with `blur_3_bytes()` of `lv_draw_sw_blur.c`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blur_x86.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "lv_blend_x86_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Must be the same as in lv_draw_sw_blur.c*/
+#define BLUR_INTENSITY_BITS 12
+#define BLUR_INTENSITY_MAX (1 << 12)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void blur_columns_4_bytes_avx2(uint8_t * buf, int32_t next_px_ofs_byte, uint32_t * sum, int32_t sum_ofs,
+                                      int32_t px_cnt, uint32_t intensity);
+static inline __m256i load_sum2_avx2(const uint32_t * sum, int32_t sum_ofs);
+static inline void store_sum2_avx2(uint32_t * sum, int32_t sum_ofs, __m256i s);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int32_t lv_draw_sw_blur_x86_columns_4_bytes(uint8_t * buf, int32_t next_px_ofs_byte, uint32_t * sum, int32_t sum_ofs,
+                                            int32_t px_cnt, uint32_t intensity)
+{
+    /*The 32 bit multiplication would need to be emulated with SSE2 which is not faster than the generic code*/
+    if(!lv_x86_has_avx2()) return 0;
+
+    blur_columns_4_bytes_avx2(buf, next_px_ofs_byte, sum, sum_ofs, px_cnt, intensity);
+    return px_cnt;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void LV_X86_TARGET_AVX2 blur_columns_4_bytes_avx2(uint8_t * buf, int32_t next_px_ofs_byte, uint32_t * sum,
+                                                         int32_t sum_ofs, int32_t px_cnt, uint32_t intensity)
+{
+    /*`sum` is at most 255 << 12 so `sum * intensity` fits into 32 bits.
+     *The channels are at most 255 and the inverse intensity at most 4096 so they can be
+     *multiplied as 16 bit values*/
+    const __m256i inten = _mm256_set1_epi32((int32_t)intensity);
+    const __m256i inten_inv = _mm256_set1_epi32((int32_t)(BLUR_INTENSITY_MAX - intensity));
+    const __m128i alpha_mask = _mm_set1_epi32((int32_t)0xff000000);
+    const int32_t ofs = next_px_ofs_byte;
+
+    int32_t i;
+    for(i = 0; i + 3 < px_cnt; i += 4) {
+        /*With skipped pixels (downscaled blur) the columns are not next to each other*/
+        __m128i px;
+        if(ofs == 4) px = _mm_loadu_si128((const __m128i *)buf);
+        else px = _mm_set_epi32(*(int32_t *)(buf + ofs * 3), *(int32_t *)(buf + ofs * 2),
+                                    *(int32_t *)(buf + ofs), *(int32_t *)buf);
+
+        /*Pixels 0, 1 and pixels 2, 3 with a channel in each 32 bit lane*/
+        __m256i c01 = _mm256_cvtepu8_epi32(px);
+        __m256i c23 = _mm256_cvtepu8_epi32(_mm_srli_si128(px, 8));
+        __m256i s01 = load_sum2_avx2(sum, sum_ofs);
+        __m256i s23 = load_sum2_avx2(sum + sum_ofs * 2, sum_ofs);
+        s01 = _mm256_add_epi32(_mm256_srli_epi32(_mm256_mullo_epi32(s01, inten), BLUR_INTENSITY_BITS),
+                               _mm256_madd_epi16(c01, inten_inv));
+        s23 = _mm256_add_epi32(_mm256_srli_epi32(_mm256_mullo_epi32(s23, inten), BLUR_INTENSITY_BITS),
+                               _mm256_madd_epi16(c23, inten_inv));
+        store_sum2_avx2(sum, sum_ofs, s01);
+        store_sum2_avx2(sum + sum_ofs * 2, sum_ofs, s23);
+
+        /*The pack works in 128 bit lanes so the result is pixel 0, 2 in the low and 1, 3 in the high lane.
+         *Pack them to bytes and restore the order.*/
+        __m256i res16 = _mm256_packus_epi32(_mm256_srli_epi32(s01, BLUR_INTENSITY_BITS),
+                                            _mm256_srli_epi32(s23, BLUR_INTENSITY_BITS));
+        __m128i res = _mm_packus_epi16(_mm256_castsi256_si128(res16), _mm256_extracti128_si256(res16, 1));
+        res = _mm_shuffle_epi32(res, _MM_SHUFFLE(3, 1, 2, 0));
+
+        /*Keep the original alpha*/
+        res = lv_x86_select_sse2(alpha_mask, px, res);
+
+        if(ofs == 4) _mm_storeu_si128((__m128i *)buf, res);
+        else {
+            *(int32_t *)buf = _mm_cvtsi128_si32(res);
+            *(int32_t *)(buf + ofs) = _mm_extract_epi32(res, 1);
+            *(int32_t *)(buf + ofs * 2) = _mm_extract_epi32(res, 2);
+            *(int32_t *)(buf + ofs * 3) = _mm_extract_epi32(res, 3);
+        }
+
+        buf += ofs * 4;
+        sum += sum_ofs * 4;
+    }
+
+    for(; i < px_cnt; i++) {
+        __m128i px = _mm_cvtsi32_si128(*(int32_t *)buf);
+        __m128i s = _mm_loadu_si128((const __m128i *)sum);
+        s = _mm_add_epi32(_mm_srli_epi32(_mm_mullo_epi32(s, _mm256_castsi256_si128(inten)), BLUR_INTENSITY_BITS),
+                          _mm_madd_epi16(_mm_cvtepu8_epi32(px), _mm256_castsi256_si128(inten_inv)));
+        _mm_storeu_si128((__m128i *)sum, s);
+
+        __m128i res = _mm_srli_epi32(s, BLUR_INTENSITY_BITS);
+        res = _mm_packus_epi16(_mm_packus_epi32(res, res), res);
+        res = lv_x86_select_sse2(alpha_mask, px, res);
+        *(int32_t *)buf = _mm_cvtsi128_si32(res);
+
+        buf += ofs;
+        sum += sum_ofs;
+    }
+}
+
+/**
+ * Load the sums of 2 pixels, one into each 128 bit lane
+ */
+static inline __m256i LV_X86_TARGET_AVX2 load_sum2_avx2(const uint32_t * sum, int32_t sum_ofs)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)sum)),
+                                   _mm_loadu_si128((const __m128i *)(sum + sum_ofs)), 1);
+}
+
+static inline void LV_X86_TARGET_AVX2 store_sum2_avx2(uint32_t * sum, int32_t sum_ofs, __m256i s)
+{
+    _mm_storeu_si128((__m128i *)sum, _mm256_castsi256_si128(s));
+    _mm_storeu_si128((__m128i *)(sum + sum_ofs), _mm256_extracti128_si256(s, 1));
+}
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 */
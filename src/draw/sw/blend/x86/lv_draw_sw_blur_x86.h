@@ -0,0 +1,63 @@
+/**
+ * @file lv_draw_sw_blur_x86.h
+ */
+
+#ifndef LV_DRAW_SW_BLUR_X86_H
+#define LV_DRAW_SW_BLUR_X86_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../../../../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Vertical blur of 4 bytes pixels */
+#ifndef LV_DRAW_SW_BLUR_COLUMNS_4_BYTES
+#define LV_DRAW_SW_BLUR_COLUMNS_4_BYTES(buf, next_px_ofs_byte, sum, sum_ofs, px_cnt, intensity) \
+    lv_draw_sw_blur_x86_columns_4_bytes(buf, next_px_ofs_byte, sum, sum_ofs, px_cnt, intensity)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Apply one step of the vertical IIR filter on a row of 4 bytes pixels. Each pixel belongs to a different
+ * column which is already being blurred. The alpha (4th) byte of the pixels is not changed.
+ * @param buf               the first pixel
+ * @param next_px_ofs_byte  offset to the next pixel in bytes
+ * @param sum               the filter state of the first pixel, 4 values for each pixel (the 4th is ignored)
+ * @param sum_ofs           offset to the filter state of the next pixel in `uint32_t` units
+ * @param px_cnt            number of pixels
+ * @param intensity         the filter coefficient (0..4095)
+ * @return                  `px_cnt` if the pixels were blurred, 0 if the CPU doesn't support AVX2
+ */
+int32_t lv_draw_sw_blur_x86_columns_4_bytes(uint8_t * buf, int32_t next_px_ofs_byte, uint32_t * sum, int32_t sum_ofs,
+                                            int32_t px_cnt, uint32_t intensity);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LV_DRAW_SW_BLUR_X86_H */
@@ -0,0 +1,321 @@
+/**
+ * @file lv_draw_sw_transform_x86.c
+ * Anti-aliased image transformation with SSE2
+ *
+ * Only the pixels whose neighbors are all in the image are handled here, 4 at a time.
+ * The source pixels are loaded one by one as they can be anywhere in the image,
+ * but their positions, the mix ratios and the mixing are calculated for 4 pixels at once.
+ * The results are bit-exact with `transform_argb8888()` and `transform_rgb565a8()`
+ * of `lv_draw_sw_transform.c`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_transform_x86.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "lv_blend_x86_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Bits of the R, G and B channels of an RGB565 color spread to 32 bits as `c | c << 16`*/
+#define RGB565_SPREAD_MASK  0x7E0F81F
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Steps along a line of the destination
+ */
+typedef struct {
+    __m128i xs_ups;         /**< Upscaled X coordinate of the first pixel of the line*/
+    __m128i ys_ups;         /**< Upscaled Y coordinate of the first pixel of the line*/
+    __m128i xs_acc;         /**< `xs_step * x` of the current 4 pixels*/
+    __m128i ys_acc;         /**< `ys_step * x` of the current 4 pixels*/
+    __m128i xs_acc_inc;     /**< `xs_step * 4`*/
+    __m128i ys_acc_inc;     /**< `ys_step * 4`*/
+    __m128i x_last;         /**< `src_w - 1`*/
+    __m128i y_last;         /**< `src_h - 1`*/
+    __m128i stride;         /**< Stride of the source image*/
+    int32_t px_size_shift;  /**< log2 of the pixel size in bytes*/
+} line_sse2_t;
+
+/**
+ * 4 pixels to sample
+ */
+typedef struct {
+    int32_t ofs[4];         /**< Byte offset of the pixels in the source image*/
+    int32_t ofs_hor[4];     /**< Byte offset of their horizontal neighbors*/
+    int32_t ofs_ver[4];     /**< Byte offset of their vertical neighbors*/
+    __m128i xs_fract;       /**< Mix ratio of the horizontal neighbors (0..127) in 32 bit lanes*/
+    __m128i ys_fract;       /**< Mix ratio of the vertical neighbors (0..127) in 32 bit lanes*/
+} px4_sse2_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void line_init_sse2(line_sse2_t * line, int32_t src_w, int32_t src_h, int32_t src_stride,
+                           int32_t px_size_shift, int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                           int32_t x);
+static bool get_px4_sse2(line_sse2_t * line, px4_sse2_t * px);
+static int32_t transform_argb8888_aa_sse2(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                          int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                          int32_t x, int32_t x_end, uint8_t * dest_buf);
+static int32_t transform_rgb565_aa_sse2(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                        int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                        int32_t x, int32_t x_end, uint16_t * cbuf, uint8_t * abuf);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int32_t lv_draw_sw_transform_x86_argb8888_aa(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                             int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                             int32_t x, int32_t x_end, uint8_t * dest_buf)
+{
+    if(!lv_x86_has_sse2()) return 0;
+
+    return transform_argb8888_aa_sse2(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                                      x, x_end, dest_buf);
+}
+
+int32_t lv_draw_sw_transform_x86_rgb565_aa(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                           int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                           int32_t x, int32_t x_end, uint16_t * cbuf, uint8_t * abuf)
+{
+    if(!lv_x86_has_sse2()) return 0;
+
+    return transform_rgb565_aa_sse2(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                                    x, x_end, cbuf, abuf);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void LV_X86_TARGET_SSE2 line_init_sse2(line_sse2_t * line, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                              int32_t px_size_shift, int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                              int32_t x)
+{
+    const __m128i x_v = _mm_add_epi32(_mm_set1_epi32(x), _mm_setr_epi32(0, 1, 2, 3));
+
+    line->xs_ups = _mm_set1_epi32(xs_ups);
+    line->ys_ups = _mm_set1_epi32(ys_ups);
+    line->xs_acc = lv_x86_mullo_epi32_sse2(x_v, _mm_set1_epi32(xs_step));
+    line->ys_acc = lv_x86_mullo_epi32_sse2(x_v, _mm_set1_epi32(ys_step));
+    line->xs_acc_inc = _mm_set1_epi32((int32_t)((uint32_t)xs_step * 4));
+    line->ys_acc_inc = _mm_set1_epi32((int32_t)((uint32_t)ys_step * 4));
+    line->x_last = _mm_set1_epi32(src_w - 1);
+    line->y_last = _mm_set1_epi32(src_h - 1);
+    line->stride = _mm_set1_epi32(src_stride);
+    line->px_size_shift = px_size_shift;
+}
+
+/**
+ * Get the position and mix ratios of the next 4 pixels the same way as the generic code
+ * @param line      the line to step on
+ * @param px        store the result here
+ * @return          false: not all the pixels or their neighbors are in the image. Nothing is changed.
+ */
+static inline bool LV_X86_TARGET_SSE2 get_px4_sse2(line_sse2_t * line, px4_sse2_t * px)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v7f = _mm_set1_epi32(0x7F);
+
+    __m128i xs = _mm_add_epi32(line->xs_ups, _mm_srai_epi32(line->xs_acc, 8));
+    __m128i ys = _mm_add_epi32(line->ys_ups, _mm_srai_epi32(line->ys_acc, 8));
+    __m128i xs_int = _mm_srai_epi32(xs, 8);
+    __m128i ys_int = _mm_srai_epi32(ys, 8);
+
+    /*The neighbors are in the image only if 0 < xs_int < src_w - 1 and 0 < ys_int < src_h - 1*/
+    __m128i in = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(xs_int, zero), _mm_cmplt_epi32(xs_int, line->x_last)),
+                               _mm_and_si128(_mm_cmpgt_epi32(ys_int, zero), _mm_cmplt_epi32(ys_int, line->y_last)));
+    if(_mm_movemask_epi8(in) != 0xFFFF) return false;
+
+    /*Mix with the next neighbor if fract >= 0x80, else with the previous one.
+     *The ratio is `fract - 0x80` or `0x7F - fract`, i.e. the low 7 bits, inverted for the previous neighbor.*/
+    __m128i xs_next = _mm_cmpgt_epi32(_mm_and_si128(xs, _mm_set1_epi32(0xFF)), v7f);
+    __m128i ys_next = _mm_cmpgt_epi32(_mm_and_si128(ys, _mm_set1_epi32(0xFF)), v7f);
+    px->xs_fract = _mm_and_si128(_mm_xor_si128(xs, _mm_andnot_si128(xs_next, v7f)), v7f);
+    px->ys_fract = _mm_and_si128(_mm_xor_si128(ys, _mm_andnot_si128(ys_next, v7f)), v7f);
+
+    __m128i px_size = _mm_set1_epi32(1 << line->px_size_shift);
+    __m128i ofs = _mm_add_epi32(lv_x86_mullo_epi32_sse2(ys_int, line->stride),
+                                _mm_slli_epi32(xs_int, line->px_size_shift));
+    /*+/- 1 pixel or line*/
+    __m128i ofs_hor = _mm_add_epi32(ofs, _mm_sub_epi32(_mm_and_si128(xs_next, _mm_add_epi32(px_size, px_size)), px_size));
+    __m128i ofs_ver = _mm_add_epi32(ofs, _mm_sub_epi32(_mm_and_si128(ys_next, _mm_add_epi32(line->stride, line->stride)),
+                                                       line->stride));
+    _mm_storeu_si128((__m128i *)px->ofs, ofs);
+    _mm_storeu_si128((__m128i *)px->ofs_hor, ofs_hor);
+    _mm_storeu_si128((__m128i *)px->ofs_ver, ofs_ver);
+
+    line->xs_acc = _mm_add_epi32(line->xs_acc, line->xs_acc_inc);
+    line->ys_acc = _mm_add_epi32(line->ys_acc, line->ys_acc_inc);
+
+    return true;
+}
+
+/**
+ * Broadcast the alpha lane of 2 ARGB8888 pixels in 16 bit lanes to the other lanes of the pixel
+ */
+static inline __m128i LV_X86_TARGET_SSE2 broadcast_alpha_sse2(__m128i v)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+/**
+ * AND the 4 lanes of 2 ARGB8888 pixels in 16 bit lanes
+ */
+static inline __m128i LV_X86_TARGET_SSE2 all_lanes_sse2(__m128i v)
+{
+    v = _mm_and_si128(v, _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1)));
+    v = _mm_and_si128(v, _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(1, 0, 3, 2)), _MM_SHUFFLE(1, 0, 3, 2)));
+    return v;
+}
+
+/**
+ * Mix a neighbor into 2 ARGB8888 pixels the same way as `transform_argb8888()`:
+ * - transparent neighbor: only the alpha is reduced
+ * - different neighbor: `lv_color_mix32()` with `fract` as the neighbor's alpha, and the alphas mixed too
+ * @param c         2 pixels in 16 bit lanes
+ * @param n         their neighbors in 16 bit lanes
+ * @param fract     the mix ratios (0..127) in all 4 lanes of the pixels
+ * @return          the mixed pixels
+ */
+static inline __m128i LV_X86_TARGET_SSE2 mix_neighbor_argb8888_sse2(__m128i c, __m128i n, __m128i fract)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha_lanes = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+
+    __m128i fract_inv = _mm_sub_epi16(_mm_set1_epi16(255), fract);
+    __m128i c_part = _mm_mullo_epi16(c, fract_inv);
+    __m128i sum = _mm_add_epi16(_mm_mullo_epi16(n, fract), c_part);
+
+    /*`LV_UDIV255()`: (sum * 0x8081) >> 23*/
+    __m128i mixed = _mm_srli_epi16(_mm_mulhi_epu16(sum, _mm_set1_epi16((short)0x8081)), 7);
+
+    __m128i n_transp = broadcast_alpha_sse2(_mm_cmpeq_epi16(n, zero));
+    __m128i c_transp = broadcast_alpha_sse2(_mm_cmpeq_epi16(c, zero));
+    __m128i same = all_lanes_sse2(_mm_cmpeq_epi16(c, n));
+
+    /*`lv_color_mix32()` keeps the color if the ratio is <= LV_OPA_MIN*/
+    __m128i keep_color = _mm_or_si128(n_transp, _mm_cmplt_epi16(fract, _mm_set1_epi16(LV_OPA_MIN + 1)));
+    __m128i color = lv_x86_select_sse2(keep_color, c, mixed);
+
+    __m128i alpha = lv_x86_select_sse2(_mm_or_si128(same, c_transp), c, _mm_srli_epi16(sum, 8));
+    alpha = lv_x86_select_sse2(n_transp, _mm_srli_epi16(c_part, 8), alpha);
+
+    return lv_x86_select_sse2(alpha_lanes, alpha, color);
+}
+
+static int32_t LV_X86_TARGET_SSE2 transform_argb8888_aa_sse2(const uint8_t * src, int32_t src_w, int32_t src_h,
+                                                             int32_t src_stride,
+                                                             int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                                             int32_t x, int32_t x_end, uint8_t * dest_buf)
+{
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t * dest = (uint32_t *)dest_buf;
+
+    line_sse2_t line;
+    line_init_sse2(&line, src_w, src_h, src_stride, 2, xs_ups, ys_ups, xs_step, ys_step, x);
+
+    int32_t x_start = x;
+    px4_sse2_t px;
+    for(; x <= x_end - 4; x += 4) {
+        if(!get_px4_sse2(&line, &px)) break;
+
+        __m128i c = _mm_setr_epi32(*(const int32_t *)(src + px.ofs[0]), *(const int32_t *)(src + px.ofs[1]),
+                                   *(const int32_t *)(src + px.ofs[2]), *(const int32_t *)(src + px.ofs[3]));
+        __m128i hor = _mm_setr_epi32(*(const int32_t *)(src + px.ofs_hor[0]), *(const int32_t *)(src + px.ofs_hor[1]),
+                                     *(const int32_t *)(src + px.ofs_hor[2]), *(const int32_t *)(src + px.ofs_hor[3]));
+        __m128i ver = _mm_setr_epi32(*(const int32_t *)(src + px.ofs_ver[0]), *(const int32_t *)(src + px.ofs_ver[1]),
+                                     *(const int32_t *)(src + px.ofs_ver[2]), *(const int32_t *)(src + px.ofs_ver[3]));
+
+        /*The ratios in all 4 lanes of the pixels*/
+        __m128i xs_fract = _mm_or_si128(px.xs_fract, _mm_slli_epi32(px.xs_fract, 16));
+        __m128i ys_fract = _mm_or_si128(px.ys_fract, _mm_slli_epi32(px.ys_fract, 16));
+
+        /*First the vertical then the horizontal neighbor is mixed in*/
+        __m128i res_lo = mix_neighbor_argb8888_sse2(_mm_unpacklo_epi8(c, zero), _mm_unpacklo_epi8(ver, zero),
+                                                    _mm_unpacklo_epi32(ys_fract, ys_fract));
+        __m128i res_hi = mix_neighbor_argb8888_sse2(_mm_unpackhi_epi8(c, zero), _mm_unpackhi_epi8(ver, zero),
+                                                    _mm_unpackhi_epi32(ys_fract, ys_fract));
+        res_lo = mix_neighbor_argb8888_sse2(res_lo, _mm_unpacklo_epi8(hor, zero), _mm_unpacklo_epi32(xs_fract, xs_fract));
+        res_hi = mix_neighbor_argb8888_sse2(res_hi, _mm_unpackhi_epi8(hor, zero), _mm_unpackhi_epi32(xs_fract, xs_fract));
+
+        _mm_storeu_si128((__m128i *)&dest[x], _mm_packus_epi16(res_lo, res_hi));
+    }
+
+    return x - x_start;
+}
+
+/**
+ * `lv_color_16_16_mix()` on RGB565 colors spread to 32 bit lanes. It's branchless
+ * as the special cases of `lv_color_16_16_mix()` give the same result with the formula.
+ * @param fg        the spread foreground colors
+ * @param bg        the spread background colors
+ * @param mix       the mix ratios already converted to 0..32 as `(mix + 4) >> 3`
+ * @return          the spread mixed colors
+ */
+static inline __m128i LV_X86_TARGET_SSE2 mix_rgb565_spread_sse2(__m128i fg, __m128i bg, __m128i mix)
+{
+    __m128i res = _mm_srli_epi32(lv_x86_mullo_epi32_sse2(_mm_sub_epi32(fg, bg), mix), 5);
+    return _mm_and_si128(_mm_add_epi32(res, bg), _mm_set1_epi32(RGB565_SPREAD_MASK));
+}
+
+static inline __m128i LV_X86_TARGET_SSE2 spread_rgb565_sse2(__m128i c)
+{
+    return _mm_and_si128(_mm_or_si128(c, _mm_slli_epi32(c, 16)), _mm_set1_epi32(RGB565_SPREAD_MASK));
+}
+
+static int32_t LV_X86_TARGET_SSE2 transform_rgb565_aa_sse2(const uint8_t * src, int32_t src_w, int32_t src_h,
+                                                           int32_t src_stride,
+                                                           int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                                           int32_t x, int32_t x_end, uint16_t * cbuf, uint8_t * abuf)
+{
+    const __m128i v4 = _mm_set1_epi32(4);
+
+    line_sse2_t line;
+    line_init_sse2(&line, src_w, src_h, src_stride, 1, xs_ups, ys_ups, xs_step, ys_step, x);
+
+    int32_t x_start = x;
+    px4_sse2_t px;
+    for(; x <= x_end - 4; x += 4) {
+        if(!get_px4_sse2(&line, &px)) break;
+
+        __m128i c = _mm_setr_epi32(*(const uint16_t *)(src + px.ofs[0]), *(const uint16_t *)(src + px.ofs[1]),
+                                   *(const uint16_t *)(src + px.ofs[2]), *(const uint16_t *)(src + px.ofs[3]));
+        __m128i hor = _mm_setr_epi32(*(const uint16_t *)(src + px.ofs_hor[0]), *(const uint16_t *)(src + px.ofs_hor[1]),
+                                     *(const uint16_t *)(src + px.ofs_hor[2]), *(const uint16_t *)(src + px.ofs_hor[3]));
+        __m128i ver = _mm_setr_epi32(*(const uint16_t *)(src + px.ofs_ver[0]), *(const uint16_t *)(src + px.ofs_ver[1]),
+                                     *(const uint16_t *)(src + px.ofs_ver[2]), *(const uint16_t *)(src + px.ofs_ver[3]));
+
+        /*The ratios are doubled for RGB565 and converted as in `lv_color_16_16_mix()`*/
+        __m128i xs_mix = _mm_srli_epi32(_mm_add_epi32(_mm_slli_epi32(px.xs_fract, 1), v4), 3);
+        __m128i ys_mix = _mm_srli_epi32(_mm_add_epi32(_mm_slli_epi32(px.ys_fract, 1), v4), 3);
+
+        /*Mix the vertical and horizontal neighbors separately and take their average.
+         *The spread form of a mixed color is the same as spreading the final RGB565 color.*/
+        c = spread_rgb565_sse2(c);
+        __m128i v = mix_rgb565_spread_sse2(spread_rgb565_sse2(ver), c, ys_mix);
+        __m128i h = mix_rgb565_spread_sse2(spread_rgb565_sse2(hor), c, xs_mix);
+        __m128i res = mix_rgb565_spread_sse2(h, v, _mm_set1_epi32((LV_OPA_50 + 4) >> 3));
+
+        /*Join the spread colors and pack the 16 bit results without saturation*/
+        res = _mm_or_si128(res, _mm_srli_epi32(res, 16));
+        res = _mm_srai_epi32(_mm_slli_epi32(res, 16), 16);
+        _mm_storel_epi64((__m128i *)&cbuf[x], _mm_packs_epi32(res, res));
+
+        lv_memset(&abuf[x], 0xff, 4);
+    }
+
+    return x - x_start;
+}
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 */
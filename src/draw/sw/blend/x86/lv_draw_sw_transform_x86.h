@@ -0,0 +1,84 @@
+/**
+ * @file lv_draw_sw_transform_x86.h
+ */
+
+#ifndef LV_DRAW_SW_TRANSFORM_X86_H
+#define LV_DRAW_SW_TRANSFORM_X86_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../../../../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Anti-aliased sampling of ARGB8888 images */
+#ifndef LV_DRAW_SW_TRANSFORM_ARGB8888_AA
+#define LV_DRAW_SW_TRANSFORM_ARGB8888_AA(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step, x, x_end, dest_buf) \
+    lv_draw_sw_transform_x86_argb8888_aa(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step, x, x_end, dest_buf)
+#endif
+
+/* Anti-aliased sampling of RGB565 images without alpha */
+#ifndef LV_DRAW_SW_TRANSFORM_RGB565_AA
+#define LV_DRAW_SW_TRANSFORM_RGB565_AA(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step, x, x_end, cbuf, abuf) \
+    lv_draw_sw_transform_x86_rgb565_aa(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step, x, x_end, cbuf, abuf)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Transform the pixels of a line from `x` while the pixels and their neighbors are all in the image.
+ * The pixels are processed in groups, so the last few pixels of such a run are left to the caller.
+ * @param src           the ARGB8888 source image
+ * @param src_w         width of the source image
+ * @param src_h         height of the source image
+ * @param src_stride    stride of the source image in bytes
+ * @param xs_ups        upscaled X coordinate of the first pixel of the line on the source image
+ * @param ys_ups        upscaled Y coordinate of the first pixel of the line on the source image
+ * @param xs_step       X step on the source image for each destination pixel (1/256 of the upscaled unit)
+ * @param ys_step       Y step on the source image for each destination pixel (1/256 of the upscaled unit)
+ * @param x             the first pixel to transform
+ * @param x_end         the width of the line
+ * @param dest_buf      the first pixel of the destination line
+ * @return              number of pixels transformed from `x`
+ */
+int32_t lv_draw_sw_transform_x86_argb8888_aa(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                             int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                             int32_t x, int32_t x_end, uint8_t * dest_buf);
+
+/**
+ * Same as `lv_draw_sw_transform_x86_argb8888_aa()` for RGB565 images without alpha
+ * @param cbuf          the first pixel of the destination color line
+ * @param abuf          the first pixel of the destination alpha line
+ */
+int32_t lv_draw_sw_transform_x86_rgb565_aa(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                           int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                           int32_t x, int32_t x_end, uint16_t * cbuf, uint8_t * abuf);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LV_DRAW_SW_TRANSFORM_X86_H */
@@ -15,6 +15,8 @@
 #include "../../stdlib/lv_string.h"
 #include "../../core/lv_global.h"
 #include "../../misc/lv_area_private.h"
+#include "../../misc/lv_profiler_timeline.h"
+#include "lv_draw_sw_grad.h"
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
     #if LV_USE_THORVG_EXTERNAL
@@ -39,6 +41,17 @@
  *********************/
 #define DRAW_UNIT_ID_SW     1
 
+#if LV_USE_OS
+    /*Keep a few tasks ready for each thread so that they can continue without waiting for the dispatcher*/
+    #define TASK_QUEUE_PENDING_MAX  LV_MIN(LV_DRAW_SW_TASK_QUEUE_SIZE, LV_DRAW_SW_DRAW_UNIT_CNT * 2)
+
+    #if defined(__GNUC__) || defined(__clang__)
+        #define TASK_QUEUE_LOCK_FREE 1
+    #else
+        #define TASK_QUEUE_LOCK_FREE 0
+    #endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -48,6 +61,14 @@
  **********************/
 #if LV_USE_OS
     static void render_thread_cb(void * ptr);
+    static void task_queue_init(lv_draw_sw_task_queue_t * q);
+    static void task_queue_deinit(lv_draw_sw_task_queue_t * q);
+    static bool task_queue_push(lv_draw_sw_task_queue_t * q, lv_draw_task_t * t);
+    static lv_draw_task_t * task_queue_pop(lv_draw_sw_task_queue_t * q);
+    static void task_queue_add_pending(lv_draw_sw_task_queue_t * q, int32_t diff);
+    static inline uint32_t atomic_load_u32(volatile uint32_t * p);
+    static inline void atomic_store_u32(volatile uint32_t * p, uint32_t v);
+    static inline bool atomic_cas_u32(volatile uint32_t * p, uint32_t expected, uint32_t desired);
 #endif
 
 static void execute_drawing(lv_draw_task_t * t);
@@ -78,6 +99,8 @@ void lv_draw_sw_init(void)
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_init();
 #endif
+    lv_draw_sw_grad_cache_init();
+    lv_draw_sw_shadow_cache_init();
 
     lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
     draw_sw_unit->base_unit.dispatch_cb = dispatch;
@@ -90,6 +113,8 @@ void lv_draw_sw_init(void)
 #endif
 
 #if LV_USE_OS
+    task_queue_init(&draw_sw_unit->task_queue);
+
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
         lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
@@ -121,6 +146,8 @@ void lv_draw_sw_deinit(void)
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
 #endif
+    lv_draw_sw_grad_cache_deinit();
+    lv_draw_sw_shadow_cache_deinit();
 }
 
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
@@ -141,6 +168,8 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
         lv_thread_delete(&thread_dsc->thread);
     }
 
+    task_queue_deinit(&draw_sw_unit->task_queue);
+
     return 0;
 #else
     LV_UNUSED(draw_unit);
@@ -253,57 +282,52 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
     lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) draw_unit;
 
 #if LV_USE_OS
-    uint32_t i;
-    uint32_t taken_cnt = 0;
-    /* All idle (couldn't take any tasks): return LV_DRAW_UNIT_IDLE;
+    lv_draw_sw_task_queue_t * q = &draw_sw_unit->task_queue;
+
+    /* All idle (no pending tasks and couldn't take any): return LV_DRAW_UNIT_IDLE;
      * All busy: return 0; as 0 tasks were taken
      * Otherwise return taken_cnt;
      */
+    uint32_t pending_cnt = atomic_load_u32(&q->pending_cnt);
+    uint32_t taken_cnt = 0;
 
-    /*If at least one is busy, it's not all idle*/
-    bool all_idle = true;
-    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
-        if(draw_sw_unit->thread_dscs[i].task_act) {
-            all_idle = false;
-            break;
-        }
-    }
-
+    /*Add all the independent tasks to the queue (up to a limit) so the threads can take
+     *the next one as soon as they are ready, without waiting for the next dispatch*/
     lv_draw_task_t * t = NULL;
-    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
-        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
-
-        /*Do nothing if busy*/
-        if(thread_dsc->task_act) continue;
-
+    while(pending_cnt + taken_cnt < TASK_QUEUE_PENDING_MAX) {
         /*Find an available task. Start from the previously taken task.*/
         t = lv_draw_get_next_available_task(layer, t, DRAW_UNIT_ID_SW);
-
-        /*If there is not available task don't try other threads as there won't be available
-         *tasks for then either*/
-        if(t == NULL) {
-            LV_PROFILER_DRAW_END;
-            if(all_idle) return LV_DRAW_UNIT_IDLE;  /*Couldn't start rendering*/
-            else return taken_cnt;
-        }
+        if(t == NULL) break;
 
         /*Allocate a buffer if not done yet.*/
         void * buf = lv_draw_layer_alloc_buf(layer);
-        /*Do not return is failed. The other thread might already have a buffer can do something. */
-        if(buf == NULL) continue;
+        if(buf == NULL) break;
 
-        /*Take the task*/
-        all_idle = false;
-        taken_cnt++;
         t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
-        thread_dsc->task_act = t;
+        t->draw_unit = draw_unit;
+        task_queue_add_pending(q, 1);
+        if(!task_queue_push(q, t)) {
+            /*Shouldn't happen as the number of pending tasks is limited*/
+            t->state = LV_DRAW_TASK_STATE_WAITING;
+            task_queue_add_pending(q, -1);
+            break;
+        }
+        taken_cnt++;
+    }
 
-        /*Let the render thread work*/
-        if(thread_dsc->inited) lv_thread_sync_signal(&thread_dsc->sync);
+    /*Wake up the idle threads. The busy ones will check the queue when they are ready.*/
+    uint32_t i;
+    uint32_t wake_cnt = taken_cnt;
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT && wake_cnt > 0; i++) {
+        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+        if(thread_dsc->task_act == NULL && thread_dsc->inited) {
+            lv_thread_sync_signal(&thread_dsc->sync);
+            wake_cnt--;
+        }
     }
 
     LV_PROFILER_DRAW_END;
-    if(all_idle) return LV_DRAW_UNIT_IDLE;  /*Couldn't start rendering*/
+    if(pending_cnt == 0 && taken_cnt == 0) return LV_DRAW_UNIT_IDLE;  /*Couldn't start rendering*/
     else return taken_cnt;
 
 #else
@@ -327,6 +351,7 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
     }
 
     t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    t->draw_unit = draw_unit;
     draw_sw_unit->task_act = t;
 
     execute_drawing(t);
@@ -350,40 +375,206 @@ static void render_thread_cb(void * ptr)
     lv_thread_sync_init(&thread_dsc->sync);
     thread_dsc->inited = true;
 
-    while(1) {
-        while(thread_dsc->task_act == NULL) {
-            if(thread_dsc->exit_status) {
-                break;
-            }
-            lv_thread_sync_wait(&thread_dsc->sync);
-        }
+    lv_draw_sw_task_queue_t * q = &((lv_draw_sw_unit_t *)thread_dsc->draw_unit)->task_queue;
 
+    while(1) {
         if(thread_dsc->exit_status) {
             LV_LOG_INFO("ready to exit software rendering thread");
             break;
         }
 
-        execute_drawing(thread_dsc->task_act);
+        /*Take the next ready task directly from the queue*/
+        lv_draw_task_t * t = task_queue_pop(q);
+        if(t == NULL) {
+            lv_thread_sync_wait(&thread_dsc->sync);
+            continue;
+        }
+
+        thread_dsc->task_act = t;
+        execute_drawing(t);
 #if LV_USE_PARALLEL_DRAW_DEBUG
-        parallel_debug_draw(thread_dsc->task_act, thread_dsc->idx);
+        parallel_debug_draw(t, thread_dsc->idx);
 #endif
-        thread_dsc->task_act->state = LV_DRAW_TASK_STATE_FINISHED;
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
         thread_dsc->task_act = NULL;
+        task_queue_add_pending(q, -1);
 
-        /*The draw unit is free now. Request a new dispatching as it can get a new task*/
+        /*Request a new dispatching as the tasks depending on this one might be available now*/
         lv_draw_dispatch_request();
-
     }
 
     thread_dsc->inited = false;
     lv_thread_sync_delete(&thread_dsc->sync);
     LV_LOG_INFO("exit software rendering thread");
 }
+
+static void task_queue_init(lv_draw_sw_task_queue_t * q)
+{
+    lv_memzero(q, sizeof(lv_draw_sw_task_queue_t));
+
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_TASK_QUEUE_SIZE; i++) {
+        q->slots[i].seq = i;
+    }
+
+#if !TASK_QUEUE_LOCK_FREE
+    lv_mutex_init(&q->lock);
+#endif
+}
+
+static void task_queue_deinit(lv_draw_sw_task_queue_t * q)
+{
+#if !TASK_QUEUE_LOCK_FREE
+    lv_mutex_delete(&q->lock);
+#else
+    LV_UNUSED(q);
+#endif
+}
+
+/**
+ * Add a task to the queue. Based on Dmitry Vyukov's bounded MPMC queue:
+ * a slot can be written if its sequence number equals the position and it can be read
+ * if it's one larger. After reading it's set to `position + size` for the next round.
+ * @param q     pointer to a queue
+ * @param t     the task to add
+ * @return      false if the queue is full
+ */
+static bool task_queue_push(lv_draw_sw_task_queue_t * q, lv_draw_task_t * t)
+{
+#if !TASK_QUEUE_LOCK_FREE
+    lv_mutex_lock(&q->lock);
+#endif
+
+    lv_draw_sw_task_slot_t * slot;
+    uint32_t pos = atomic_load_u32(&q->tail);
+    while(1) {
+        slot = &q->slots[pos & (LV_DRAW_SW_TASK_QUEUE_SIZE - 1)];
+        int32_t diff = (int32_t)(atomic_load_u32(&slot->seq) - pos);
+        if(diff == 0) {
+            if(atomic_cas_u32(&q->tail, pos, pos + 1)) break;
+        }
+        else if(diff < 0) {
+#if !TASK_QUEUE_LOCK_FREE
+            lv_mutex_unlock(&q->lock);
+#endif
+            return false;
+        }
+
+        pos = atomic_load_u32(&q->tail);
+    }
+
+    slot->task = t;
+    atomic_store_u32(&slot->seq, pos + 1);
+
+#if !TASK_QUEUE_LOCK_FREE
+    lv_mutex_unlock(&q->lock);
+#endif
+    return true;
+}
+
+/**
+ * Take the oldest task from the queue
+ * @param q     pointer to a queue
+ * @return      the task or NULL if the queue is empty
+ */
+static lv_draw_task_t * task_queue_pop(lv_draw_sw_task_queue_t * q)
+{
+#if !TASK_QUEUE_LOCK_FREE
+    lv_mutex_lock(&q->lock);
+#endif
+
+    lv_draw_sw_task_slot_t * slot;
+    uint32_t pos = atomic_load_u32(&q->head);
+    while(1) {
+        slot = &q->slots[pos & (LV_DRAW_SW_TASK_QUEUE_SIZE - 1)];
+        int32_t diff = (int32_t)(atomic_load_u32(&slot->seq) - (pos + 1));
+        if(diff == 0) {
+            if(atomic_cas_u32(&q->head, pos, pos + 1)) break;
+        }
+        else if(diff < 0) {
+#if !TASK_QUEUE_LOCK_FREE
+            lv_mutex_unlock(&q->lock);
+#endif
+            return NULL;
+        }
+
+        pos = atomic_load_u32(&q->head);
+    }
+
+    lv_draw_task_t * t = slot->task;
+    atomic_store_u32(&slot->seq, pos + LV_DRAW_SW_TASK_QUEUE_SIZE);
+
+#if !TASK_QUEUE_LOCK_FREE
+    lv_mutex_unlock(&q->lock);
 #endif
+    return t;
+}
+
+/**
+ * Adjust the number of tasks which are added to the queue but not finished yet
+ * @param q     pointer to a queue
+ * @param diff  the value to add
+ */
+static void task_queue_add_pending(lv_draw_sw_task_queue_t * q, int32_t diff)
+{
+#if TASK_QUEUE_LOCK_FREE
+    __atomic_add_fetch(&q->pending_cnt, (uint32_t)diff, __ATOMIC_ACQ_REL);
+#else
+    lv_mutex_lock(&q->lock);
+    q->pending_cnt += (uint32_t)diff;
+    lv_mutex_unlock(&q->lock);
+#endif
+}
+
+#if TASK_QUEUE_LOCK_FREE
+
+static inline uint32_t atomic_load_u32(volatile uint32_t * p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static inline void atomic_store_u32(volatile uint32_t * p, uint32_t v)
+{
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+static inline bool atomic_cas_u32(volatile uint32_t * p, uint32_t expected, uint32_t desired)
+{
+    return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+#else
+
+/*The queue is protected by its mutex, so simple reads and writes are enough*/
+
+static inline uint32_t atomic_load_u32(volatile uint32_t * p)
+{
+    return *p;
+}
+
+static inline void atomic_store_u32(volatile uint32_t * p, uint32_t v)
+{
+    *p = v;
+}
+
+static inline bool atomic_cas_u32(volatile uint32_t * p, uint32_t expected, uint32_t desired)
+{
+    if(*p != expected) return false;
+    *p = desired;
+    return true;
+}
+
+#endif /*TASK_QUEUE_LOCK_FREE*/
+
+#endif /*LV_USE_OS*/
 
 static void execute_drawing(lv_draw_task_t * t)
 {
     LV_PROFILER_DRAW_BEGIN;
+#if LV_USE_PROFILER_TIMELINE
+    uint64_t timeline_begin = lv_profiler_timeline_tick_get();
+#endif
+
     /*Render the draw task*/
     switch(t->type) {
         case LV_DRAW_TASK_TYPE_FILL:
@@ -431,6 +622,10 @@ static void execute_drawing(lv_draw_task_t * t)
             break;
     }
 
+#if LV_USE_PROFILER_TIMELINE
+    lv_profiler_timeline_add(LV_PROFILER_TIMELINE_EVENT_DRAW_TASK, t->draw_unit ? t->draw_unit->name : NULL, t->type,
+                             &t->area, timeline_begin);
+#endif
 
     LV_PROFILER_DRAW_END;
 }
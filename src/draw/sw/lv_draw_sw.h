@@ -35,6 +35,18 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Usage of the shadow corner cache. See `LV_DRAW_SW_SHADOW_CACHE_SIZE`.*/
+typedef struct {
+    uint32_t hit_cnt;               /**< Number of shadows whose corner was found in the cache*/
+    uint32_t miss_cnt;              /**< Number of shadows whose corner was calculated and added to the cache*/
+    uint32_t size;                  /**< Bytes used by the cached corners*/
+    uint32_t max_size;              /**< Size of the cache in bytes*/
+} lv_draw_sw_shadow_cache_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -74,6 +86,23 @@ void lv_draw_sw_border(lv_draw_task_t * t, const lv_draw_border_dsc_t * dsc, con
  */
 void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords);
 
+/**
+ * Get the usage of the shadow corner cache.
+ * All fields are 0 if the cache is disabled.
+ * @param stat          store the usage here
+ */
+void lv_draw_sw_shadow_cache_get_stat(lv_draw_sw_shadow_cache_stat_t * stat);
+
+/**
+ * Reset the hit and miss counters of the shadow corner cache
+ */
+void lv_draw_sw_shadow_cache_reset_stat(void);
+
+/**
+ * Drop all the cached shadow corners
+ */
+void lv_draw_sw_shadow_cache_drop_all(void);
+
 /**
  * Draw an image with SW render. It handles image decoding, tiling, transformations, and recoloring.
  * @param t             pointer to a draw task
@@ -113,7 +113,7 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
     int32_t blend_h = lv_area_get_height(&clipped_area);
     int32_t blend_w = lv_area_get_width(&clipped_area);
     int32_t h;
-    lv_opa_t * mask_buf = lv_malloc(blend_w);
+    lv_opa_t * mask_buf = lv_draw_arena_malloc(blend_w);
 
     lv_area_t blend_area = clipped_area;
     lv_area_t img_area;
@@ -156,7 +156,7 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
     lv_area_t round_area_1;
     lv_area_t round_area_2;
     if(dsc->rounded) {
-        circle_mask = lv_malloc(width * width);
+        circle_mask = lv_draw_arena_malloc(width * width);
         LV_ASSERT_MALLOC(circle_mask);
         lv_memset(circle_mask, 0xff, width * width);
         lv_area_t circle_area = {0, 0, width - 1, width - 1};
@@ -231,9 +231,9 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
         lv_draw_sw_mask_free_param(&mask_in_param);
     }
 
-    lv_free(mask_buf);
+    lv_draw_arena_free(mask_buf);
     if(dsc->img_src) lv_image_decoder_close(&decoder_dsc);
-    if(circle_mask) lv_free(circle_mask);
+    if(circle_mask) lv_draw_arena_free(circle_mask);
 #else
     LV_LOG_WARN("Can't draw arc with LV_DRAW_SW_COMPLEX == 0");
     LV_UNUSED(center);
@@ -17,6 +17,11 @@
 #include "../../misc/lv_types.h"
 #include "../../core/lv_refr_private.h"
 #include "../../stdlib/lv_string.h"
+#include "../lv_draw_arena.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    #include "blend/x86/lv_blend_x86.h"
+#endif
 
 /*********************
  *      DEFINES
@@ -29,6 +34,15 @@
  *      TYPEDEFS
  **********************/
 
+/*The state of the filter in a column while the columns are blurred row by row*/
+typedef struct {
+    uint32_t sum[4];        /*4 values so that SIMD code can load them at once, the generic code uses only 3*/
+    int32_t y_start;
+    int32_t y_end;
+    uint32_t sample_len;
+    uint16_t prev;          /*The last blurred pixel of the 1 and 2 bytes formats*/
+} blur_column_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -39,8 +53,12 @@ static inline uint8_t blur_1_bytes(uint32_t * sum, uint8_t px, uint32_t intensit
 static void blur_2_bytes_init(uint32_t * sum, lv_color16_t * buf, uint32_t sample_len, int32_t stride, bool swapped);
 static inline uint16_t blur_2_bytes(uint32_t * sum, uint16_t px, uint32_t intensity, bool swapped);
 
-static void blur_3_bytes_init(uint32_t * sum, volatile uint8_t * buf, uint32_t sample_len, int32_t stride);
-static inline void blur_3_bytes(uint32_t * sum, volatile uint8_t * buf, uint32_t intensity);
+static void blur_3_bytes_init(uint32_t * sum, uint8_t * buf, uint32_t sample_len, int32_t stride);
+static inline void blur_3_bytes(uint32_t * sum, uint8_t * buf, uint32_t intensity);
+
+static void blur_columns_in_row(blur_column_t * columns, int32_t column_cnt, uint8_t * buf, int32_t y,
+                                bool top_to_bottom, uint32_t px_size, int32_t next_px_ofs_byte, int32_t stride_byte,
+                                uint32_t intensity, bool swapped);
 
 static int32_t get_rounded_edge_point(int32_t p_start, int32_t p_end, int32_t p, int32_t r);
 
@@ -111,7 +129,6 @@ void lv_draw_sw_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, const l
 
     uint32_t px_size = lv_color_format_get_size(t->target_layer->draw_buf->header.cf);
     int32_t stride_byte = t->target_layer->draw_buf->header.stride;
-    int32_t stride_px = stride_byte / px_size;
     int32_t next_px_ofs_byte = px_size * skip_cnt;
     bool swapped = t->target_layer->draw_buf->header.cf == LV_COLOR_FORMAT_RGB565_SWAPPED;
 
@@ -119,89 +136,49 @@ void lv_draw_sw_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, const l
     int32_t y;
     int32_t x;
 
-    /*Blur each column top to bottom and bottom to top.*/
-    for(x = clipped_coords.x1; x <= clipped_coords.x2; x += skip_cnt) {
+    /*Blur each column top to bottom and bottom to top.
+     *Walking a column would jump a whole stride on every pixel, so instead process the buffer row by row
+     *and keep the filter state of each column in an array. This way the buffer is read sequentially.*/
+    int32_t column_cnt = (clipped_coords.x2 - clipped_coords.x1) / skip_cnt + 1;
+    blur_column_t * columns = lv_draw_arena_malloc(column_cnt * sizeof(blur_column_t));
+    LV_ASSERT_MALLOC(columns);
+    if(columns == NULL) {
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+    /*The 4th sum is not used by the generic code but SIMD code might calculate it too*/
+    lv_memzero(columns, column_cnt * sizeof(blur_column_t));
+
+    int32_t i;
+    for(i = 0; i < column_cnt; i++) {
+        x = clipped_coords.x1 + i * skip_cnt;
         int32_t cir_y = get_rounded_edge_point(coords->x1, coords->x2, layer_x_ofs + x, radius);
         int32_t y_start = LV_CLAMP(clipped_coords.y1, coords->y1 - layer_y_ofs + cir_y, clipped_coords.y2);
         int32_t y_end = LV_CLAMP(clipped_coords.y1, coords->y2  - layer_y_ofs - cir_y, clipped_coords.y2);
 
         /*Make sure that the width and height is a multiple of skip_cnt so that back and forth blurring
          *surely affects the same pixels */
-        y_start = (y_start / skip_cnt) * skip_cnt;
-        y_end = (y_end / skip_cnt) * skip_cnt;
-        if(y_start > y_end) continue;
-
-        uint32_t sample_len_limited = LV_MIN((y_end - y_start) / skip_cnt + 1, sample_len);
-
-        if(px_size == 1) {
-            /*Compiler optimization might mishandle it, so add volatile*/
-            uint8_t * buf_column_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_start);
-            blur_1_bytes_init(sum, buf_column_start, sample_len_limited, stride_byte * skip_cnt);
-
-            uint8_t buf_prev = buf_column_start[0] + 1; /*Make sure that it's not equal in the first round*/
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                if(buf_prev != *buf_column_start) {
-                    *buf_column_start = blur_1_bytes(sum, *buf_column_start, intensity);
-                    buf_prev = *buf_column_start;
-                }
-                buf_column_start += stride_byte * skip_cnt;
-            }
+        columns[i].y_start = (y_start / skip_cnt) * skip_cnt;
+        columns[i].y_end = (y_end / skip_cnt) * skip_cnt;
 
-            uint8_t * buf_column_end = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_end);
-            blur_1_bytes_init(sum, buf_column_end, sample_len_limited, -stride_byte * skip_cnt);
-            buf_prev = buf_column_end[0] + 1; /*Make sure that it's not equal in the first round*/
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                if(buf_prev != *buf_column_end) {
-                    *buf_column_end = blur_1_bytes(sum, *buf_column_end, intensity);
-                    buf_prev = *buf_column_end;
-                }
-                buf_column_end -= stride_byte * skip_cnt;
-            }
-        }
-        else if(px_size == 2) {
-            uint16_t * buf16_column_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_start);
-            blur_2_bytes_init(sum, (lv_color16_t *)buf16_column_start, sample_len_limited, stride_px * skip_cnt, swapped);
-            uint16_t buf16_prev = buf16_column_start[0] + 1; /*Make sure that it's not equal in the first round*/
-
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                if(buf16_prev != *buf16_column_start) {
-                    *buf16_column_start = blur_2_bytes(sum, *buf16_column_start, intensity, swapped);
-                    buf16_prev = *buf16_column_start;
-                }
-                buf16_column_start += stride_px * skip_cnt;
-            }
-
-            uint16_t * buf16_column_end = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_end);
-            blur_2_bytes_init(sum, (lv_color16_t *)buf16_column_end, sample_len_limited, -stride_px * skip_cnt, swapped);
-            buf16_prev = buf16_column_end[0] + 1; /*Make sure that it's not equal in the first round*/
-
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                if(buf16_prev != *buf16_column_end) {
-                    *buf16_column_end = blur_2_bytes(sum, *buf16_column_end, intensity, swapped);
-                    buf16_prev = *buf16_column_end;
-                }
-                buf16_column_end -= stride_px * skip_cnt;
-            }
-        }
-        else if(px_size >= 3) {
-            /*Compiler optimization might mishandle it, so add volatile*/
-            volatile uint8_t * buf_column_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_start);
-            blur_3_bytes_init(sum, buf_column_start, sample_len_limited, stride_byte * skip_cnt);
+        /*If y_start > y_end the column is simply never blurred*/
+        columns[i].sample_len = LV_MIN((columns[i].y_end - columns[i].y_start) / skip_cnt + 1, sample_len);
+    }
 
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                blur_3_bytes(sum, buf_column_start, intensity);
-                buf_column_start += stride_byte * skip_cnt;
-            }
+    for(y = clipped_coords.y1; y <= clipped_coords.y2; y += skip_cnt) {
+        uint8_t * buf_row = lv_draw_buf_goto_xy(t->target_layer->draw_buf, clipped_coords.x1, y);
+        blur_columns_in_row(columns, column_cnt, buf_row, y, true, px_size, next_px_ofs_byte,
+                            stride_byte * skip_cnt, intensity, swapped);
+    }
 
-            volatile uint8_t * buf_column_end = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_end);
-            blur_3_bytes_init(sum, buf_column_end, sample_len_limited, -stride_byte * skip_cnt);
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                blur_3_bytes(sum, buf_column_end, intensity);
-                buf_column_end -= stride_byte * skip_cnt;
-            }
-        }
+    for(y = clipped_coords.y2; y >= clipped_coords.y1; y -= skip_cnt) {
+        uint8_t * buf_row = lv_draw_buf_goto_xy(t->target_layer->draw_buf, clipped_coords.x1, y);
+        blur_columns_in_row(columns, column_cnt, buf_row, y, false, px_size, next_px_ofs_byte,
+                            -stride_byte * skip_cnt, intensity, swapped);
     }
 
+    lv_draw_arena_free(columns);
+
     /*Blur each line from left to right and right to left.
      *Also fill the gap in each line because of skipped pixels*/
     for(y = clipped_coords.y1; y <= clipped_coords.y2; y += skip_cnt) {
@@ -220,7 +197,6 @@ void lv_draw_sw_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, const l
 
 
         if(px_size == 1) {
-            /*Compiler optimization might mishandle it, so add volatile*/
             uint8_t * buf_line_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_start, y);
 
             blur_1_bytes_init(sum, buf_line_start, sample_len_limited, px_size * skip_cnt);
@@ -314,8 +290,7 @@ void lv_draw_sw_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, const l
             }
         }
         else if(px_size >= 3) {
-            /*Compiler optimization might mishandle it, so add volatile*/
-            volatile uint8_t * buf_line_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_start, y);
+            uint8_t * buf_line_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_start, y);
 
             blur_3_bytes_init(sum, buf_line_start, sample_len_limited, px_size * skip_cnt);
             for(x = x_start + skip_cnt; x <= x_end; x += skip_cnt) {
@@ -323,7 +298,7 @@ void lv_draw_sw_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, const l
                 buf_line_start += next_px_ofs_byte;
             }
 
-            volatile uint8_t * buf_line_end = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_end, y);
+            uint8_t * buf_line_end = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_end, y);
             blur_3_bytes_init(sum, buf_line_end, sample_len_limited, -(int32_t)px_size * skip_cnt);
 
             for(x = x_start; x <= x_end; x += skip_cnt) {
@@ -379,7 +354,7 @@ static void blur_1_bytes_init(uint32_t * sum, uint8_t * buf, uint32_t sample_len
     sum[0] = (sum[0] << BLUR_INTENSITY_BITS) / sample_len;
 }
 
-static void blur_3_bytes_init(uint32_t * sum, volatile uint8_t * buf, uint32_t sample_len, int32_t stride)
+static void blur_3_bytes_init(uint32_t * sum, uint8_t * buf, uint32_t sample_len, int32_t stride)
 {
     uint32_t s;
 
@@ -467,18 +442,121 @@ static inline uint16_t blur_2_bytes(uint32_t * sum, uint16_t px, uint32_t intens
 
 
 
-static inline void blur_3_bytes(uint32_t * sum, volatile uint8_t * buf, uint32_t intensity)
+static inline void blur_3_bytes(uint32_t * sum, uint8_t * buf, uint32_t intensity)
 {
     uint32_t intensity_inv = BLUR_INTENSITY_MAX - intensity;
 
-    sum[0] = ((sum[0] * intensity) >> BLUR_INTENSITY_BITS) + ((buf[0] * intensity_inv));
-    buf[0] = sum[0] >> BLUR_INTENSITY_BITS;
+    /*Work on local copies to let the compiler keep them in registers*/
+    uint32_t s0 = ((sum[0] * intensity) >> BLUR_INTENSITY_BITS) + (buf[0] * intensity_inv);
+    uint32_t s1 = ((sum[1] * intensity) >> BLUR_INTENSITY_BITS) + (buf[1] * intensity_inv);
+    uint32_t s2 = ((sum[2] * intensity) >> BLUR_INTENSITY_BITS) + (buf[2] * intensity_inv);
 
-    sum[1] = ((sum[1] * intensity) >> BLUR_INTENSITY_BITS) + ((buf[1] * intensity_inv));
-    buf[1] = sum[1] >> BLUR_INTENSITY_BITS;
+    sum[0] = s0;
+    sum[1] = s1;
+    sum[2] = s2;
+
+    buf[0] = s0 >> BLUR_INTENSITY_BITS;
+    buf[1] = s1 >> BLUR_INTENSITY_BITS;
+    buf[2] = s2 >> BLUR_INTENSITY_BITS;
+}
+
+/**
+ * Blur one row of pixels in all the columns. The state of the IIR filter of each column is kept in `columns`.
+ * @param columns           the state of the columns
+ * @param column_cnt        number of columns
+ * @param buf               pointer to the pixel of the first column in the row
+ * @param y                 the Y coordinate of the row
+ * @param top_to_bottom     true: the rows go downward, start the filter at `y_start`;
+ *                          false: the rows go upward, start the filter at `y_end`
+ * @param px_size           size of a pixel in bytes
+ * @param next_px_ofs_byte  offset to the next column in bytes
+ * @param stride_byte       offset to the next processed row in bytes (negative when going upward)
+ * @param intensity         the filter coefficient
+ * @param swapped           true: the format is RGB565_SWAPPED
+ */
+static void blur_columns_in_row(blur_column_t * columns, int32_t column_cnt, uint8_t * buf, int32_t y,
+                                bool top_to_bottom, uint32_t px_size, int32_t next_px_ofs_byte, int32_t stride_byte,
+                                uint32_t intensity, bool swapped)
+{
+    int32_t i;
+    if(px_size == 1) {
+        for(i = 0; i < column_cnt; i++, buf += next_px_ofs_byte) {
+            blur_column_t * c = &columns[i];
+            if(y < c->y_start || y > c->y_end) continue;
+
+            if(y == (top_to_bottom ? c->y_start : c->y_end)) {
+                blur_1_bytes_init(c->sum, buf, c->sample_len, stride_byte);
+                c->prev = (uint8_t)(buf[0] + 1); /*Make sure that it's not equal in the first round*/
+            }
+
+            if(c->prev != buf[0]) {
+                buf[0] = blur_1_bytes(c->sum, buf[0], intensity);
+                c->prev = buf[0];
+            }
+        }
+    }
+    else if(px_size == 2) {
+        for(i = 0; i < column_cnt; i++, buf += next_px_ofs_byte) {
+            blur_column_t * c = &columns[i];
+            if(y < c->y_start || y > c->y_end) continue;
+
+            uint16_t * buf16 = (uint16_t *)buf;
+            if(y == (top_to_bottom ? c->y_start : c->y_end)) {
+                blur_2_bytes_init(c->sum, (lv_color16_t *)buf16, c->sample_len, stride_byte / 2, swapped);
+                c->prev = (uint16_t)(buf16[0] + 1); /*Make sure that it's not equal in the first round*/
+            }
 
-    sum[2] = ((sum[2] * intensity) >> BLUR_INTENSITY_BITS) + ((buf[2] * intensity_inv));
-    buf[2] = sum[2] >> BLUR_INTENSITY_BITS;
+            if(c->prev != buf16[0]) {
+                buf16[0] = blur_2_bytes(c->sum, buf16[0], intensity, swapped);
+                c->prev = buf16[0];
+            }
+        }
+    }
+#ifdef LV_DRAW_SW_BLUR_COLUMNS_4_BYTES
+    else if(px_size == 4) {
+        for(i = 0; i < column_cnt; i++, buf += next_px_ofs_byte) {
+            blur_column_t * c = &columns[i];
+            if(y < c->y_start || y > c->y_end) continue;
+
+            if(y == (top_to_bottom ? c->y_start : c->y_end)) {
+                blur_3_bytes_init(c->sum, buf, c->sample_len, stride_byte);
+                blur_3_bytes(c->sum, buf, intensity);
+                continue;
+            }
+
+            /*Find the next columns which are also in the middle of blurring and let the backend
+             *blur them at once. Only the columns at rounded corners start or end in other rows.*/
+            int32_t run_cnt = 1;
+            while(i + run_cnt < column_cnt) {
+                blur_column_t * c_next = &columns[i + run_cnt];
+                if(y <= c_next->y_start || y >= c_next->y_end) break;
+                run_cnt++;
+            }
+
+            if(LV_DRAW_SW_BLUR_COLUMNS_4_BYTES(buf, next_px_ofs_byte, c->sum, sizeof(blur_column_t) / sizeof(uint32_t),
+                                               run_cnt, intensity) == 0) {
+                int32_t j;
+                for(j = 0; j < run_cnt; j++) {
+                    blur_3_bytes(c[j].sum, buf + j * next_px_ofs_byte, intensity);
+                }
+            }
+            i += run_cnt - 1;
+            buf += (run_cnt - 1) * next_px_ofs_byte;
+        }
+    }
+#endif
+    else {
+        for(i = 0; i < column_cnt; i++, buf += next_px_ofs_byte) {
+            blur_column_t * c = &columns[i];
+            if(y < c->y_start || y > c->y_end) continue;
+
+            if(y == (top_to_bottom ? c->y_start : c->y_end)) {
+                blur_3_bytes_init(c->sum, buf, c->sample_len, stride_byte);
+            }
+
+            blur_3_bytes(c->sum, buf, intensity);
+        }
+    }
 }
 
 /**
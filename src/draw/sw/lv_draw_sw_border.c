@@ -99,7 +99,7 @@ void draw_border_complex(lv_draw_task_t * t, const lv_area_t * outer_area, const
 
     lv_draw_sw_blend_dsc_t blend_dsc;
     lv_memzero(&blend_dsc, sizeof(blend_dsc));
-    lv_opa_t * mask_buf = lv_malloc(draw_area_w);
+    lv_opa_t * mask_buf = lv_draw_arena_malloc(draw_area_w);
     blend_dsc.mask_buf = mask_buf;
 
     void * mask_list[3] = {0};
@@ -281,7 +281,7 @@ void draw_border_complex(lv_draw_task_t * t, const lv_area_t * outer_area, const
 
     lv_draw_sw_mask_free_param(&mask_rin_param);
     if(rout > 0) lv_draw_sw_mask_free_param(&mask_rout_param);
-    lv_free(mask_buf);
+    lv_draw_arena_free(mask_buf);
 
 #else
     LV_UNUSED(t);
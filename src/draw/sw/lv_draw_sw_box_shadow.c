@@ -9,7 +9,8 @@
 #include "../../misc/lv_area_private.h"
 #include "lv_draw_sw_mask_private.h"
 #include "../lv_draw_private.h"
-#include "lv_draw_sw.h"
+#include "lv_draw_sw_private.h"
+#include "../../stdlib/lv_string.h"
 #if LV_USE_DRAW_SW
 
 #if LV_DRAW_SW_COMPLEX
@@ -19,7 +20,8 @@
 #include "../../misc/lv_math.h"
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_assert.h"
-#include "../../stdlib/lv_string.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../misc/cache/lv_cache_private.h"
 #include "../lv_draw_mask.h"
 
 /*********************
@@ -36,13 +38,32 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+typedef struct {
+    lv_cache_slot_size_t slot;
+    int32_t size;       /*Size of the corner: shadow width + radius*/
+    int32_t r;
+    int32_t sw;
+    int32_t w;          /*Size of the blurred area. It matters only if it's smaller than twice the corner*/
+    int32_t h;
+    lv_opa_t * buf;
+} shadow_cache_item_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static lv_opa_t * get_corner_buf(const lv_area_t * core_area, int32_t sw, int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
                                                                int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    static bool shadow_create_cb(shadow_cache_item_t * item, void * user_data);
+    static void shadow_free_cb(shadow_cache_item_t * item, void * user_data);
+    static lv_cache_compare_res_t shadow_compare_cb(const shadow_cache_item_t * lhs, const shadow_cache_item_t * rhs);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -55,6 +76,60 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t
  *   GLOBAL FUNCTIONS
  **********************/
 
+void lv_draw_sw_shadow_cache_init(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    const lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)shadow_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)shadow_create_cb,
+        .free_cb = (lv_cache_free_cb_t)shadow_free_cb,
+    };
+
+    lv_memzero(&shadow_cache, sizeof(lv_draw_sw_shadow_cache_t));
+    shadow_cache.cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(shadow_cache_item_t),
+                                         LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_CNT,
+                                         ops);
+    lv_cache_set_name(shadow_cache.cache, "SW_SHADOW");
+#endif
+}
+
+void lv_draw_sw_shadow_cache_deinit(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(shadow_cache.cache == NULL) return;
+    lv_cache_destroy(shadow_cache.cache, NULL);
+    shadow_cache.cache = NULL;
+#endif
+}
+
+void lv_draw_sw_shadow_cache_get_stat(lv_draw_sw_shadow_cache_stat_t * stat)
+{
+    lv_memzero(stat, sizeof(lv_draw_sw_shadow_cache_stat_t));
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(shadow_cache.cache == NULL) return;
+    stat->hit_cnt = shadow_cache.hit_cnt;
+    stat->miss_cnt = shadow_cache.miss_cnt;
+    stat->size = lv_cache_get_size(shadow_cache.cache, NULL);
+    stat->max_size = lv_cache_get_max_size(shadow_cache.cache, NULL);
+#endif
+}
+
+void lv_draw_sw_shadow_cache_reset_stat(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    shadow_cache.hit_cnt = 0;
+    shadow_cache.miss_cnt = 0;
+#endif
+}
+
+void lv_draw_sw_shadow_cache_drop_all(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(shadow_cache.cache == NULL) return;
+    lv_cache_drop_all(shadow_cache.cache, NULL);
+#endif
+}
+
 void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
 {
     /*Calculate the rectangle which is blurred to get the shadow in `shadow_area`*/
@@ -97,34 +172,7 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     /*Get how many pixels are affected by the blur on the corners*/
     int32_t corner_size = dsc->width  + r_sh;
 
-    lv_opa_t * sh_buf;
-
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        LV_ASSERT_MALLOC(sh_buf);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
-    }
-    else {
-        /*A larger buffer is required for calculation*/
-        sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-        LV_ASSERT_MALLOC(sh_buf);
-        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
-        }
-    }
-#else
-    sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-    LV_ASSERT_MALLOC(sh_buf);
-    shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+    lv_opa_t * sh_buf = get_corner_buf(&core_area, dsc->width, r_sh);
 
     /*Skip a lot of masking if the background will cover the shadow that would be masked out*/
     bool simple = dsc->bg_cover;
@@ -138,7 +186,7 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
         masks[0] = &mask_rout_param;
     }
 
-    lv_opa_t * mask_buf = lv_malloc(lv_area_get_width(&shadow_area));
+    lv_opa_t * mask_buf = lv_draw_arena_malloc(lv_area_get_width(&shadow_area));
     lv_area_t blend_area;
     lv_area_t clip_area_sub;
     lv_opa_t * sh_buf_tmp;
@@ -187,7 +235,7 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_sw_mask_apply(masks, mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                 }
@@ -230,7 +278,7 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_sw_mask_apply(masks, mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                 }
@@ -469,7 +517,7 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_sw_mask_apply(masks, mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                 }
@@ -513,7 +561,7 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_sw_mask_apply(masks, mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                 }
@@ -555,14 +603,104 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     if(!simple) {
         lv_draw_sw_mask_free_param(&mask_rout_param);
     }
-    lv_free(sh_buf);
-    lv_free(mask_buf);
+    lv_draw_arena_free(sh_buf);
+    lv_draw_arena_free(mask_buf);
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the blurred corner from the cache or calculate it
+ * @param core_area the area which is blurred to get the shadow
+ * @param sw        shadow width
+ * @param r         radius
+ * @return          a `(sw + r)^2` sized buffer allocated with `lv_draw_arena_malloc()`
+ */
+static lv_opa_t * get_corner_buf(const lv_area_t * core_area, int32_t sw, int32_t r)
+{
+    int32_t size = sw + r;
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    shadow_cache_item_t search_key;
+    bool cacheable = shadow_cache.cache && size <= LV_DRAW_SW_SHADOW_CACHE_SIZE;
+    if(cacheable) {
+        lv_memzero(&search_key, sizeof(search_key));
+        search_key.slot.size = size * size;
+        search_key.size = size;
+        search_key.r = r;
+        search_key.sw = sw;
+        /*The sides of the rectangle don't affect the corner if they are longer than `size + r`*/
+        search_key.w = LV_MIN(lv_area_get_width(core_area), 2 * size);
+        search_key.h = LV_MIN(lv_area_get_height(core_area), 2 * size);
+
+        lv_cache_entry_t * entry = lv_cache_acquire(shadow_cache.cache, &search_key, NULL);
+        if(entry) {
+            shadow_cache.hit_cnt++;
+
+            /*Copy it because the buffer is mirrored while drawing*/
+            shadow_cache_item_t * cached = lv_cache_entry_get_data(entry);
+            lv_opa_t * sh_buf = lv_draw_arena_malloc(size * size);
+            LV_ASSERT_MALLOC(sh_buf);
+            lv_memcpy(sh_buf, cached->buf, size * size);
+            lv_cache_release(shadow_cache.cache, entry, NULL);
+            return sh_buf;
+        }
+    }
+#endif
+
+    /*A larger buffer is required for calculation*/
+    lv_opa_t * sh_buf = lv_draw_arena_malloc(size * size * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(sh_buf);
+    shadow_draw_corner_buf(core_area, (uint16_t *)sh_buf, sw, r);
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(cacheable) {
+        shadow_cache.miss_cnt++;
+
+        /*If an other thread has added it meanwhile it's just returned*/
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(shadow_cache.cache, &search_key, sh_buf);
+        if(entry) lv_cache_release(shadow_cache.cache, entry, NULL);
+    }
+#endif
+
+    return sh_buf;
+}
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+
+static bool shadow_create_cb(shadow_cache_item_t * item, void * user_data)
+{
+    const lv_opa_t * sh_buf = user_data;
+
+    item->buf = lv_malloc(item->slot.size);
+    LV_ASSERT_MALLOC(item->buf);
+    if(item->buf == NULL) return false;
+
+    lv_memcpy(item->buf, sh_buf, item->slot.size);
+    return true;
+}
+
+static void shadow_free_cb(shadow_cache_item_t * item, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(item->buf);
+    item->buf = NULL;
+}
+
+static lv_cache_compare_res_t shadow_compare_cb(const shadow_cache_item_t * lhs, const shadow_cache_item_t * rhs)
+{
+    if(lhs->size != rhs->size) return lhs->size > rhs->size ? 1 : -1;
+    if(lhs->r != rhs->r) return lhs->r > rhs->r ? 1 : -1;
+    if(lhs->sw != rhs->sw) return lhs->sw > rhs->sw ? 1 : -1;
+    if(lhs->w != rhs->w) return lhs->w > rhs->w ? 1 : -1;
+    if(lhs->h != rhs->h) return lhs->h > rhs->h ? 1 : -1;
+    return 0;
+}
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 /**
  * Calculate a blurred corner
  * @param coords Coordinates of the shadow
@@ -594,7 +732,7 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
 #endif /*SHADOW_ENHANCE*/
 
     int32_t y;
-    lv_opa_t * mask_line = lv_malloc(size);
+    lv_opa_t * mask_line = lv_draw_arena_malloc(size);
     uint16_t * sh_ups_tmp_buf = (uint16_t *)sh_buf;
     for(y = 0; y < size; y++) {
         lv_memset(mask_line, 0xff, size);
@@ -613,7 +751,7 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
 
         sh_ups_tmp_buf += size;
     }
-    lv_free(mask_line);
+    lv_draw_arena_free(mask_line);
 
     lv_draw_sw_mask_free_param(&mask_param);
 
@@ -664,7 +802,7 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, u
     if((sw & 1) == 0) s_left--;
 
     /*Horizontal blur*/
-    uint16_t * sh_ups_blur_buf = lv_malloc(size * sizeof(uint16_t));
+    uint16_t * sh_ups_blur_buf = lv_draw_arena_malloc(size * sizeof(uint16_t));
 
     int32_t x;
     int32_t y;
@@ -727,7 +865,7 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, u
         }
     }
 
-    lv_free(sh_ups_blur_buf);
+    lv_draw_arena_free(sh_ups_blur_buf);
 }
 
 #else /*LV_DRAW_SW_COMPLEX*/
@@ -741,6 +879,27 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     LV_LOG_WARN("LV_DRAW_SW_COMPLEX needs to be enabled");
 }
 
+void lv_draw_sw_shadow_cache_init(void)
+{
+}
+
+void lv_draw_sw_shadow_cache_deinit(void)
+{
+}
+
+void lv_draw_sw_shadow_cache_get_stat(lv_draw_sw_shadow_cache_stat_t * stat)
+{
+    lv_memzero(stat, sizeof(lv_draw_sw_shadow_cache_stat_t));
+}
+
+void lv_draw_sw_shadow_cache_reset_stat(void)
+{
+}
+
+void lv_draw_sw_shadow_cache_drop_all(void)
+{
+}
+
 #endif /*LV_DRAW_SW_COMPLEX*/
 
 #endif /*LV_DRAW_USE_SW*/
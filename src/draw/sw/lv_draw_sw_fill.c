@@ -87,7 +87,7 @@ void lv_draw_sw_fill(lv_draw_task_t * t, lv_draw_fill_dsc_t * dsc, const lv_area
     lv_draw_sw_mask_radius_param_t mask_rout_param;
     void * mask_list[2] = {NULL, NULL};
     if(rout > 0) {
-        mask_buf = lv_malloc(clipped_w);
+        mask_buf = lv_draw_arena_malloc(clipped_w);
         lv_draw_sw_mask_radius_init(&mask_rout_param, &bg_coords, rout, false);
         mask_list[0] = &mask_rout_param;
     }
@@ -320,7 +320,7 @@ void lv_draw_sw_fill(lv_draw_task_t * t, lv_draw_fill_dsc_t * dsc, const lv_area
     }
 
     if(mask_buf) {
-        lv_free(mask_buf);
+        lv_draw_arena_free(mask_buf);
         lv_draw_sw_mask_free_param(&mask_rout_param);
     }
     if(grad) {
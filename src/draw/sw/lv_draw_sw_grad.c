@@ -12,6 +12,10 @@
 #include "../../misc/lv_types.h"
 #include "../../osal/lv_os_private.h"
 #include "../../misc/lv_math.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../misc/cache/lv_cache_private.h"
+#include "../../core/lv_global.h"
+#include "../lv_draw_arena.h"
 
 /*********************
  *      DEFINES
@@ -26,10 +30,26 @@
     #define ALIGN(X)    (((X) + 3) & ~3)
 #endif
 
+#define grad_cache LV_GLOBAL_DEFAULT()->sw_grad_cache
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+
+/*The color map depends only on the stops and the size, so the direction is not part of the key.
+ *It allows sharing e.g. the 256 element tables of the linear, radial and conical gradients.*/
+typedef struct {
+    lv_cache_slot_size_t slot;
+    lv_grad_stop_t stops[LV_GRADIENT_MAX_STOPS];
+    uint8_t stops_count;
+    uint32_t map_size;
+    lv_draw_sw_grad_calc_t * calc;
+} grad_cache_item_t;
+
+#endif
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 typedef struct {
@@ -73,7 +93,15 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 typedef lv_result_t (*op_cache_t)(lv_draw_sw_grad_calc_t * c, void * ctx);
-static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static lv_draw_sw_grad_calc_t * allocate_item(uint32_t size);
+static lv_draw_sw_grad_calc_t * get_map(const lv_grad_dsc_t * g, uint32_t size);
+static void calculate_map(const lv_grad_dsc_t * g, lv_draw_sw_grad_calc_t * item);
+
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    static bool grad_create_cb(grad_cache_item_t * item, void * user_data);
+    static void grad_free_cb(grad_cache_item_t * item, void * user_data);
+    static lv_cache_compare_res_t grad_compare_cb(const grad_cache_item_t * lhs, const grad_cache_item_t * rhs);
+#endif
 
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
@@ -89,26 +117,14 @@ static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w
  *   STATIC FUNCTIONS
  **********************/
 
-static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
+static size_t get_item_size(uint32_t size)
 {
-    int32_t size;
-    switch(g->dir) {
-        case LV_GRAD_DIR_HOR:
-        case LV_GRAD_DIR_LINEAR:
-        case LV_GRAD_DIR_RADIAL:
-        case LV_GRAD_DIR_CONICAL:
-            size = w;
-            break;
-        case LV_GRAD_DIR_VER:
-            size = h;
-            break;
-        default:
-            size = 64;
-    }
+    return ALIGN(sizeof(lv_draw_sw_grad_calc_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
+}
 
-    size_t req_size = ALIGN(sizeof(lv_draw_sw_grad_calc_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(
-                                                                                                           lv_opa_t));
-    lv_draw_sw_grad_calc_t * item  = lv_malloc(req_size);
+static lv_draw_sw_grad_calc_t * allocate_item(uint32_t size)
+{
+    lv_draw_sw_grad_calc_t * item  = lv_draw_arena_malloc(get_item_size(size));
     LV_ASSERT_MALLOC(item);
     if(item == NULL) return NULL;
 
@@ -116,9 +132,101 @@ static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w
     item->color_map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
     item->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_color_t)));
     item->size = size;
+    item->cache_entry = NULL;
+    return item;
+}
+
+static void calculate_map(const lv_grad_dsc_t * g, lv_draw_sw_grad_calc_t * item)
+{
+    uint32_t i;
+    for(i = 0; i < item->size; i++) {
+        lv_draw_sw_grad_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    }
+}
+
+/**
+ * Get a calculated, read-only color map. If possible it's taken from the cache.
+ */
+static lv_draw_sw_grad_calc_t * get_map(const lv_grad_dsc_t * g, uint32_t size)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    size_t item_size = get_item_size(size);
+    if(grad_cache && item_size <= LV_DRAW_SW_GRADIENT_CACHE_SIZE) {
+        grad_cache_item_t search_key;
+        lv_memzero(&search_key, sizeof(search_key));
+        search_key.slot.size = item_size;
+        lv_memcpy(search_key.stops, g->stops, g->stops_count * sizeof(lv_grad_stop_t));
+        search_key.stops_count = g->stops_count;
+        search_key.map_size = size;
+
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(grad_cache, &search_key, (void *)g);
+        if(entry) {
+            grad_cache_item_t * cached = lv_cache_entry_get_data(entry);
+            return cached->calc;
+        }
+        /*All entries are in use, calculate a temporary map*/
+    }
+#endif
+
+    lv_draw_sw_grad_calc_t * item = allocate_item(size);
+    if(item == NULL) {
+        LV_LOG_WARN("Failed to allocate item for the gradient");
+        return NULL;
+    }
+
+    calculate_map(g, item);
     return item;
 }
 
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+
+static bool grad_create_cb(grad_cache_item_t * item, void * user_data)
+{
+    const lv_grad_dsc_t * g = user_data;
+
+    /*Not freed by the frame arena as it can be used in later frames too*/
+    lv_draw_sw_grad_calc_t * calc = lv_malloc(item->slot.size);
+    LV_ASSERT_MALLOC(calc);
+    if(calc == NULL) return false;
+
+    uint8_t * p = (uint8_t *)calc;
+    calc->color_map = (lv_color_t *)(p + ALIGN(sizeof(*calc)));
+    calc->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*calc)) + ALIGN(item->map_size * sizeof(lv_color_t)));
+    calc->size = item->map_size;
+    calc->cache_entry = lv_cache_entry_get_entry(item, sizeof(grad_cache_item_t));
+    calculate_map(g, calc);
+
+    item->calc = calc;
+    return true;
+}
+
+static void grad_free_cb(grad_cache_item_t * item, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(item->calc);
+    item->calc = NULL;
+}
+
+static lv_cache_compare_res_t grad_compare_cb(const grad_cache_item_t * lhs, const grad_cache_item_t * rhs)
+{
+    if(lhs->map_size != rhs->map_size) {
+        return lhs->map_size > rhs->map_size ? 1 : -1;
+    }
+
+    if(lhs->stops_count != rhs->stops_count) {
+        return lhs->stops_count > rhs->stops_count ? 1 : -1;
+    }
+
+    int cmp_res = lv_memcmp(lhs->stops, rhs->stops, lhs->stops_count * sizeof(lv_grad_stop_t));
+    if(cmp_res != 0) {
+        return cmp_res > 0 ? 1 : -1;
+    }
+
+    return 0;
+}
+
+#endif
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
@@ -142,24 +250,46 @@ static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
  *     FUNCTIONS
  **********************/
 
+void lv_draw_sw_grad_cache_init(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    const lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)grad_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)grad_create_cb,
+        .free_cb = (lv_cache_free_cb_t)grad_free_cb,
+    };
+
+    grad_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(grad_cache_item_t),
+                                 LV_DRAW_SW_GRADIENT_CACHE_SIZE, ops);
+    lv_cache_set_name(grad_cache, "SW_GRAD");
+#endif
+}
+
+void lv_draw_sw_grad_cache_deinit(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    if(grad_cache == NULL) return;
+    lv_cache_destroy(grad_cache, NULL);
+    grad_cache = NULL;
+#endif
+}
+
 lv_draw_sw_grad_calc_t * lv_draw_sw_grad_get(const lv_grad_dsc_t * g, int32_t w, int32_t h)
 {
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
-    /* Step 1: Search cache for the given key */
-    lv_draw_sw_grad_calc_t * item = allocate_item(g, w, h);
-    if(item == NULL) {
-        LV_LOG_WARN("Failed to allocate item for the gradient");
+#if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
+    /* The complex gradients are calculated line by line into this buffer from the
+     * 256 element table created by their setup function, so it needs no calculation here */
+    if(g->dir >= LV_GRAD_DIR_LINEAR) {
+        lv_draw_sw_grad_calc_t * item = allocate_item(w);
+        if(item == NULL) LV_LOG_WARN("Failed to allocate item for the gradient");
         return item;
     }
+#endif
 
-    /* Step 3: Fill it with the gradient, as expected */
-    uint32_t i;
-    for(i = 0; i < item->size; i++) {
-        lv_draw_sw_grad_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
-    }
-    return item;
+    return get_map(g, g->dir == LV_GRAD_DIR_VER ? h : w);
 }
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_grad_color_calculate(const lv_grad_dsc_t * dsc, int32_t range,
@@ -217,7 +347,16 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_grad_color_calculate(const lv_grad_dsc_t *
 
 void lv_draw_sw_grad_cleanup(lv_draw_sw_grad_calc_t * grad)
 {
-    lv_free(grad);
+    if(grad == NULL) return;
+
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    if(grad->cache_entry) {
+        lv_cache_release(grad_cache, grad->cache_entry, NULL);
+        return;
+    }
+#endif
+
+    lv_draw_arena_free(grad);
 }
 
 
@@ -295,7 +434,7 @@ void lv_draw_sw_grad_radial_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     LV_ASSERT(r_end != 0);
 
     /* Create gradient color map */
-    state->cgrad = lv_draw_sw_grad_get(dsc, 256, 0);
+    state->cgrad = get_map(dsc, 256);
 
     state->x0 = start.x;
     state->y0 = start.y;
@@ -464,7 +603,7 @@ void lv_draw_sw_grad_linear_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     dsc->state = state;
 
     /* Create gradient color map */
-    state->cgrad = lv_draw_sw_grad_get(dsc, 256, 0);
+    state->cgrad = get_map(dsc, 256);
 
     /* Convert from percentage coordinates */
     int32_t wdt = lv_area_get_width(coords);
@@ -492,7 +631,7 @@ void lv_draw_sw_grad_linear_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_draw_sw_grad_cleanup(state->cgrad);
     lv_free(state);
 }
 
@@ -539,7 +678,7 @@ void lv_draw_sw_grad_conical_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords
     dsc->state = state;
 
     /* Create gradient color map */
-    state->cgrad = lv_draw_sw_grad_get(dsc, 256, 0);
+    state->cgrad = get_map(dsc, 256);
 
     /* Convert from percentage coordinates */
     int32_t wdt = lv_area_get_width(coords);
@@ -564,7 +703,7 @@ void lv_draw_sw_grad_conical_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_draw_sw_grad_cleanup(state->cgrad);
     lv_free(state);
 }
 
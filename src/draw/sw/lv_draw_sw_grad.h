@@ -30,6 +30,7 @@ typedef struct {
     lv_color_t   *  color_map;
     lv_opa_t   *  opa_map;
     uint32_t size;
+    lv_cache_entry_t * cache_entry;     /**< Not NULL if the maps are owned by the gradient cache*/
 } lv_draw_sw_grad_calc_t;
 
 
@@ -49,12 +50,32 @@ typedef struct {
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_grad_color_calculate(const lv_grad_dsc_t * dsc, int32_t range,
                                                                  int32_t frac, lv_color_t * color_out, lv_opa_t * opa_out);
 
-/** Get a gradient cache from the given parameters */
+/**
+ * Create the gradient color map cache. Called in `lv_draw_sw_init()`.
+ * The size of the cache is set by `LV_DRAW_SW_GRADIENT_CACHE_SIZE`.
+ */
+void lv_draw_sw_grad_cache_init(void);
+
+/**
+ * Free the gradient color map cache. Called in `lv_draw_sw_deinit()`.
+ */
+void lv_draw_sw_grad_cache_deinit(void);
+
+/**
+ * Get the color and opacity map of a gradient.
+ * The maps of horizontal and vertical gradients are taken from the cache if possible and must not be modified.
+ * For complex gradients a writable buffer is returned which is filled by the `..._get_line` functions.
+ * @param gradient  the gradient descriptor
+ * @param w         width of the gradient's area
+ * @param h         height of the gradient's area
+ * @return          the gradient item or NULL on failure
+ */
 lv_draw_sw_grad_calc_t * lv_draw_sw_grad_get(const lv_grad_dsc_t * gradient, int32_t w, int32_t h);
 
 /**
- * Clean up the gradient item after it was get with `lv_grad_get_from_cache`.
- * @param grad      pointer to a gradient
+ * Clean up the gradient item after it was get with `lv_draw_sw_grad_get`.
+ * Releases it if it's from the cache.
+ * @param grad      pointer to a gradient. Can be NULL.
  */
 void lv_draw_sw_grad_cleanup(lv_draw_sw_grad_calc_t * grad);
 
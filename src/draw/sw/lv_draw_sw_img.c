@@ -340,7 +340,7 @@ static void radius_only(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc
     blend_area.y2 = blend_area.y1;
 
     int32_t blend_w = lv_area_get_width(&blend_area);
-    uint8_t * mask_buf = lv_malloc(blend_w);
+    uint8_t * mask_buf = lv_draw_arena_malloc(blend_w);
     blend_dsc.mask_buf = mask_buf;
     blend_dsc.mask_area = &blend_area;
     blend_dsc.mask_stride = blend_w;
@@ -387,7 +387,7 @@ static void radius_only(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc
         blend_area.y1 ++;
         blend_area.y2 ++;
     }
-    lv_free(mask_buf);
+    lv_draw_arena_free(mask_buf);
 
 }
 #endif /*LV_DRAW_SW_COMPLEX*/
@@ -413,7 +413,7 @@ static void recolor_only(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_ds
     }
     buf_h = MAX_BUF_SIZE / buf_stride;
     buf_h = LV_CLAMP(1, buf_h, blend_h);
-    tmp_buf = lv_malloc(buf_stride * buf_h);
+    tmp_buf = lv_draw_arena_malloc(buf_stride * buf_h);
     LV_ASSERT_MALLOC(tmp_buf);
     if(!tmp_buf) {
         LV_LOG_WARN("Failed to perform image recolor operation. Out of memory");
@@ -457,7 +457,7 @@ static void recolor_only(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_ds
 
     }
 
-    lv_free(tmp_buf);
+    lv_draw_arena_free(tmp_buf);
 
 }
 
@@ -502,19 +502,19 @@ static void transform_and_recolor(lv_draw_task_t * t, const lv_draw_image_dsc_t
         uint32_t buf_stride = blend_w * 3;
         buf_h = MAX_BUF_SIZE / buf_stride;
         buf_h = LV_CLAMP(1, buf_h, blend_h);
-        transformed_buf = lv_malloc(buf_stride * buf_h);
+        transformed_buf = lv_draw_arena_malloc(buf_stride * buf_h);
     }
     else if(cf_final == LV_COLOR_FORMAT_AL88) {
         uint32_t buf_stride = blend_w;
         buf_h = MAX_BUF_SIZE / (buf_stride * 2);
         buf_h = LV_CLAMP(1, buf_h, blend_h);
-        transformed_buf = lv_malloc(buf_stride * buf_h * 2);
+        transformed_buf = lv_draw_arena_malloc(buf_stride * buf_h * 2);
     }
     else {
         uint32_t buf_stride = blend_w * lv_color_format_get_size(cf_final);
         buf_h = MAX_BUF_SIZE / buf_stride;
         buf_h = LV_CLAMP(1, buf_h, blend_h);
-        transformed_buf = lv_malloc(buf_stride * buf_h);
+        transformed_buf = lv_draw_arena_malloc(buf_stride * buf_h);
     }
     LV_ASSERT_MALLOC(transformed_buf);
 
@@ -593,7 +593,7 @@ static void transform_and_recolor(lv_draw_task_t * t, const lv_draw_image_dsc_t
         }
     }
 
-    lv_free(transformed_buf);
+    lv_draw_arena_free(transformed_buf);
 }
 
 static void colorkey_and_recolor(lv_area_t relative_area, uint8_t * src_buf, uint8_t * dest_buf, int32_t src_stride,
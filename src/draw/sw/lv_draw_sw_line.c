@@ -141,7 +141,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_hor(lv_draw_task_t * t, const lv_dra
 
         int32_t dash_start = blend_area.x1 % (dsc->dash_gap + dsc->dash_width);
 
-        lv_opa_t * mask_buf = lv_malloc(blend_area_w);
+        lv_opa_t * mask_buf = lv_draw_arena_malloc(blend_area_w);
         blend_dsc.mask_buf = mask_buf;
         blend_dsc.mask_area = &blend_area;
         blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
@@ -174,7 +174,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_hor(lv_draw_task_t * t, const lv_dra
             blend_area.y1++;
             blend_area.y2++;
         }
-        lv_free(mask_buf);
+        lv_draw_arena_free(mask_buf);
     }
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
@@ -216,7 +216,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_ver(lv_draw_task_t * t, const lv_dra
         int32_t y2 = blend_area.y2;
         blend_area.y2 = blend_area.y1;
 
-        lv_opa_t * mask_buf = lv_malloc(draw_area_w);
+        lv_opa_t * mask_buf = lv_draw_arena_malloc(draw_area_w);
         blend_dsc.mask_buf = mask_buf;
         blend_dsc.mask_area = &blend_area;
         blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
@@ -245,7 +245,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_ver(lv_draw_task_t * t, const lv_dra
             blend_area.y1++;
             blend_area.y2++;
         }
-        lv_free(mask_buf);
+        lv_draw_arena_free(mask_buf);
     }
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
@@ -342,7 +342,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_task_t * t, const lv_dr
     /*Draw the background line by line*/
     int32_t h;
     size_t mask_buf_size = LV_MIN((int32_t)lv_area_get_size(&blend_area), lv_area_get_width(&blend_area));
-    lv_opa_t * mask_buf = lv_malloc(mask_buf_size);
+    lv_opa_t * mask_buf = lv_draw_arena_malloc(mask_buf_size);
 
     /*The real draw area is around the line.
      *It's easy to calculate with steep lines, but the area can be very wide with very flat lines.
@@ -392,7 +392,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_task_t * t, const lv_dr
         lv_draw_sw_blend(t, &blend_dsc);
     }
 
-    lv_free(mask_buf);
+    lv_draw_arena_free(mask_buf);
 
     lv_draw_sw_mask_free_param(&mask_left_param);
     lv_draw_sw_mask_free_param(&mask_right_param);
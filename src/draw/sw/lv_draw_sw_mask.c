@@ -1092,8 +1092,9 @@ static void circ_calc_aa4(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t radiu
     }
 
     const size_t cir_xy_size = (radius + 1) * 2 * 2 * sizeof(int32_t);
-    int32_t * cir_x = lv_malloc_zeroed(cir_xy_size);
+    int32_t * cir_x = lv_draw_arena_malloc(cir_xy_size);
     LV_ASSERT_MALLOC(cir_x);
+    lv_memzero(cir_x, cir_xy_size);
     int32_t * cir_y = &cir_x[(radius + 1) * 2];
 
     uint32_t y_8th_cnt = 0;
@@ -1215,7 +1216,7 @@ static void circ_calc_aa4(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t radiu
         y++;
     }
 
-    lv_free(cir_x);
+    lv_draw_arena_free(cir_x);
 }
 
 static lv_opa_t * get_next_line(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t y, int32_t * len,
@@ -23,6 +23,10 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_DRAW_SW_TASK_QUEUE_SIZE < 2 || (LV_DRAW_SW_TASK_QUEUE_SIZE & (LV_DRAW_SW_TASK_QUEUE_SIZE - 1)) != 0
+#error "LV_DRAW_SW_TASK_QUEUE_SIZE must be a power of 2 and at least 2"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -31,6 +35,24 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_OS
+typedef struct {
+    lv_draw_task_t * task;
+    volatile uint32_t seq;          /**< Tells if the slot is ready to be written or read in the current round*/
+} lv_draw_sw_task_slot_t;
+
+/** Bounded multi-producer multi-consumer queue of draw tasks which can be rendered right away*/
+typedef struct {
+    lv_draw_sw_task_slot_t slots[LV_DRAW_SW_TASK_QUEUE_SIZE];
+    volatile uint32_t head;         /**< Position of the next task to take*/
+    volatile uint32_t tail;         /**< Position of the next task to add*/
+    volatile uint32_t pending_cnt;  /**< Number of tasks added but not finished yet*/
+#if !(defined(__GNUC__) || defined(__clang__))
+    lv_mutex_t lock;                /**< Without atomic built-ins the queue is protected by a mutex*/
+#endif
+} lv_draw_sw_task_queue_t;
+#endif
+
 typedef struct {
     lv_draw_task_t * task_act;
     lv_thread_t thread;
@@ -45,6 +67,7 @@ struct _lv_draw_sw_unit_t {
     lv_draw_unit_t base_unit;
 #if LV_USE_OS
     lv_draw_sw_thread_dsc_t thread_dscs[LV_DRAW_SW_DRAW_UNIT_CNT];
+    lv_draw_sw_task_queue_t task_queue;
 #else
     lv_draw_task_t * task_act;
 #endif
@@ -52,9 +75,9 @@ struct _lv_draw_sw_unit_t {
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
 typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
+    lv_cache_t * cache;             /**< The blurred corners keyed by their size, radius and shadow width*/
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
 } lv_draw_sw_shadow_cache_t;
 #endif
 
@@ -62,6 +85,16 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create the shadow corner cache. Called in `lv_draw_sw_init()`.
+ */
+void lv_draw_sw_shadow_cache_init(void);
+
+/**
+ * Free the shadow corner cache. Called in `lv_draw_sw_deinit()`.
+ */
+void lv_draw_sw_shadow_cache_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -13,8 +13,13 @@
 #include "../../misc/lv_area.h"
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_color.h"
+#include "../../misc/lv_color_op_private.h"
 #include "../../stdlib/lv_string.h"
 
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    #include "blend/x86/lv_blend_x86.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -101,6 +106,16 @@ static void transform_al88(const uint8_t * src, int32_t src_w, int32_t src_h, in
  *      MACROS
  **********************/
 
+/*Anti-alias a run of pixels whose neighbors are all in the image.
+ *Return the number of pixels processed, the rest is done by the generic code.*/
+#ifndef LV_DRAW_SW_TRANSFORM_ARGB8888_AA
+    #define LV_DRAW_SW_TRANSFORM_ARGB8888_AA(...)       0
+#endif
+
+#ifndef LV_DRAW_SW_TRANSFORM_RGB565_AA
+    #define LV_DRAW_SW_TRANSFORM_RGB565_AA(...)         0
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -400,14 +415,14 @@ static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h,
             px_ver.blue = px_ver_u8[0];
             px_ver.alpha = 0xff;
 
-            if(!lv_color32_eq(dest_c32[x], px_ver)) {
+            if(!lv_color32_eq_inline(dest_c32[x], px_ver)) {
                 px_ver.alpha = ys_fract;
-                dest_c32[x] = lv_color_mix32(px_ver, dest_c32[x]);
+                dest_c32[x] = lv_color_mix32_inline(px_ver, dest_c32[x]);
             }
 
-            if(!lv_color32_eq(dest_c32[x], px_hor)) {
+            if(!lv_color32_eq_inline(dest_c32[x], px_hor)) {
                 px_hor.alpha = xs_fract;
-                dest_c32[x] = lv_color_mix32(px_hor, dest_c32[x]);
+                dest_c32[x] = lv_color_mix32_inline(px_hor, dest_c32[x]);
             }
         }
         /*Partially out of the image*/
@@ -484,25 +499,33 @@ static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h
            ys_int + y_next >= 0 &&
            ys_int + y_next <= src_h - 1) {
 
+            /*Let the backend process this and the next pixels while all of their neighbors are in the image*/
+            int32_t px_cnt = LV_DRAW_SW_TRANSFORM_ARGB8888_AA(src, src_w, src_h, src_stride, xs_ups_start, ys_ups_start,
+                                                              xs_step, ys_step, x, x_end, dest_buf);
+            if(px_cnt) {
+                x += px_cnt - 1;
+                continue;
+            }
+
             lv_color32_t px_hor = src_c32[x_next];
             lv_color32_t px_ver = *(const lv_color32_t *)((uint8_t *)src_c32 + y_next * src_stride);
 
             if(px_ver.alpha == 0) {
                 dest_c32[x].alpha = (dest_c32[x].alpha * (0xFF - ys_fract)) >> 8;
             }
-            else if(!lv_color32_eq(dest_c32[x], px_ver)) {
+            else if(!lv_color32_eq_inline(dest_c32[x], px_ver)) {
                 if(dest_c32[x].alpha) dest_c32[x].alpha = ((px_ver.alpha * ys_fract) + (dest_c32[x].alpha * (0xFF - ys_fract))) >> 8;
                 px_ver.alpha = ys_fract;
-                dest_c32[x] = lv_color_mix32(px_ver, dest_c32[x]);
+                dest_c32[x] = lv_color_mix32_inline(px_ver, dest_c32[x]);
             }
 
             if(px_hor.alpha == 0) {
                 dest_c32[x].alpha = (dest_c32[x].alpha * (0xFF - xs_fract)) >> 8;
             }
-            else if(!lv_color32_eq(dest_c32[x], px_hor)) {
+            else if(!lv_color32_eq_inline(dest_c32[x], px_hor)) {
                 if(dest_c32[x].alpha) dest_c32[x].alpha = ((px_hor.alpha * xs_fract) + (dest_c32[x].alpha * (0xFF - xs_fract))) >> 8;
                 px_hor.alpha = xs_fract;
-                dest_c32[x] = lv_color_mix32(px_hor, dest_c32[x]);
+                dest_c32[x] = lv_color_mix32_inline(px_hor, dest_c32[x]);
             }
         }
         /*Partially out of the image*/
@@ -607,19 +630,19 @@ static void transform_argb8888_premultiplied(const uint8_t * src, int32_t src_w,
                 dest_c32[x].alpha = (dest_c32[x].alpha * (0xFF - ys_fract)) >> 8;
 
             }
-            else if(!lv_color32_eq(dest_c32[x], px_ver)) {
+            else if(!lv_color32_eq_inline(dest_c32[x], px_ver)) {
                 if(dest_c32[x].alpha) dest_c32[x].alpha = ((px_ver.alpha * ys_fract) + (dest_c32[x].alpha * (0xFF - ys_fract))) >> 8;
                 px_ver.alpha = ys_fract;
-                dest_c32[x] = lv_color_mix32(px_ver, dest_c32[x]);
+                dest_c32[x] = lv_color_mix32_inline(px_ver, dest_c32[x]);
             }
 
             if(px_hor.alpha == 0) {
                 dest_c32[x].alpha = (dest_c32[x].alpha * (0xFF - xs_fract)) >> 8;
             }
-            else if(!lv_color32_eq(dest_c32[x], px_hor)) {
+            else if(!lv_color32_eq_inline(dest_c32[x], px_hor)) {
                 if(dest_c32[x].alpha) dest_c32[x].alpha = ((px_hor.alpha * xs_fract) + (dest_c32[x].alpha * (0xFF - xs_fract))) >> 8;
                 px_hor.alpha = xs_fract;
-                dest_c32[x] = lv_color_mix32(px_hor, dest_c32[x]);
+                dest_c32[x] = lv_color_mix32_inline(px_hor, dest_c32[x]);
             }
 
             dest_c32[x].red = (dest_c32[x].red * dest_c32[x].alpha) >> 8;
@@ -730,13 +753,21 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
                 if(abuf[x] == 0x00) continue;
             }
             else {
+                /*Let the backend process this and the next pixels while all of their neighbors are in the image*/
+                int32_t px_cnt = LV_DRAW_SW_TRANSFORM_RGB565_AA(src, src_w, src_h, src_stride, xs_ups_start, ys_ups_start,
+                                                                xs_step, ys_step, x, x_end, cbuf, abuf);
+                if(px_cnt) {
+                    x += px_cnt - 1;
+                    continue;
+                }
+
                 abuf[x] = 0xff;
             }
 
             if(cbuf[x] != px_ver || cbuf[x] != px_hor) {
-                uint16_t v = lv_color_16_16_mix(px_ver, cbuf[x], ys_fract);
-                uint16_t h = lv_color_16_16_mix(px_hor, cbuf[x], xs_fract);
-                cbuf[x] = lv_color_16_16_mix(h, v, LV_OPA_50);
+                uint16_t v = lv_color_16_16_mix_inline(px_ver, cbuf[x], ys_fract);
+                uint16_t h = lv_color_16_16_mix_inline(px_hor, cbuf[x], xs_fract);
+                cbuf[x] = lv_color_16_16_mix_inline(h, v, LV_OPA_50);
             }
         }
         /*Partially out of the image*/
@@ -850,9 +881,9 @@ static void transform_rgb565a8_swapped(const uint8_t * src, int32_t src_w, int32
             }
 
             if(cbuf[x] != px_ver || cbuf[x] != px_hor) {
-                uint16_t v = lv_color_16_16_mix(px_ver, cbuf[x], ys_fract);
-                uint16_t h = lv_color_16_16_mix(px_hor, cbuf[x], xs_fract);
-                cbuf[x] =  lv_color_16_16_mix(h, v, LV_OPA_50);
+                uint16_t v = lv_color_16_16_mix_inline(px_ver, cbuf[x], ys_fract);
+                uint16_t h = lv_color_16_16_mix_inline(px_hor, cbuf[x], xs_fract);
+                cbuf[x] =  lv_color_16_16_mix_inline(h, v, LV_OPA_50);
             }
         }
         /*Partially out of the image*/
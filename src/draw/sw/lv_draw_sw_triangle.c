@@ -123,7 +123,7 @@ void lv_draw_sw_triangle(lv_draw_task_t * t, const lv_draw_triangle_dsc_t * dsc)
     masks[1] = &mask_right;
     masks[2] = &mask_bottom;
     int32_t area_w = lv_area_get_width(&draw_area);
-    lv_opa_t * mask_buf = lv_malloc(area_w);
+    lv_opa_t * mask_buf = lv_draw_arena_malloc(area_w);
 
     lv_area_t blend_area = draw_area;
     blend_area.y2 = blend_area.y1;
@@ -183,7 +183,7 @@ void lv_draw_sw_triangle(lv_draw_task_t * t, const lv_draw_triangle_dsc_t * dsc)
         lv_draw_sw_blend(t, &blend_dsc);
     }
 
-    lv_free(mask_buf);
+    lv_draw_arena_free(mask_buf);
     lv_draw_sw_mask_free_param(&mask_bottom);
     lv_draw_sw_mask_free_param(&mask_left);
     lv_draw_sw_mask_free_param(&mask_right);
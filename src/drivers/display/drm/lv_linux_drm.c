@@ -42,7 +42,11 @@
     #error LV_COLOR_DEPTH not supported
 #endif
 
-#define BUFFER_CNT 2
+#if LV_LINUX_DRM_BUFFER_CNT == 3
+    #define BUFFER_CNT 3
+#else
+    #define BUFFER_CNT 2
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -78,6 +82,8 @@ typedef struct {
     drmModePropertyPtr conn_props[128];
     drm_buffer_t drm_bufs[BUFFER_CNT];
     drm_buffer_t * act_buf;
+    lv_display_t * disp;
+    lv_draw_buf_t draw_buf_3;
 #if LV_USE_LINUX_DRM_GBM_BUFFERS
     struct gbm_device * gbm_device;
 #endif
@@ -236,11 +242,25 @@ lv_result_t lv_linux_drm_set_file(lv_display_t * disp, const char * file, int64_
     lv_display_set_buffers_with_stride(disp, drm_dev->drm_bufs[1].map, drm_dev->drm_bufs[0].map, buf_size,
                                        stride, LV_DISPLAY_RENDER_MODE_DIRECT);
 
+#if BUFFER_CNT == 3
+    /* Render the next frame to the 3rd buffer while the previous one waits for the page flip */
+    lv_draw_buf_init(&drm_dev->draw_buf_3, hor_res, ver_res, lv_display_get_color_format(disp), stride,
+                     drm_dev->drm_bufs[2].map, LV_MIN(buf_size, drm_dev->drm_bufs[2].size));
+    lv_display_set_3rd_draw_buffer(disp, &drm_dev->draw_buf_3);
+#endif
+
 
     /* Set the handler that is called before a redraw occurs to set the active buffer/plane
      * when GBM buffers are used the DMA_BUF_SYNC_START is issued there */
     lv_display_add_event_cb(disp, drm_dmabuf_set_active_buf, LV_EVENT_REFR_START, drm_dev);
 
+    /*Let the frame pacing know the refresh rate. It's enabled by `lv_display_set_frame_pacing`.*/
+    drm_dev->disp = disp;
+    if(drm_dev->mode.clock) {
+        uint64_t frame_px = (uint64_t)drm_dev->mode.htotal * drm_dev->mode.vtotal;
+        lv_display_set_vsync_period(disp, (uint32_t)(frame_px * 1000 / drm_dev->mode.clock));
+    }
+
     if(width) {
         lv_display_set_dpi(disp, DIV_ROUND_UP(hor_res * 25400, width * 1000));
     }
@@ -310,14 +330,23 @@ static void page_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec
 {
     LV_UNUSED(fd);
     LV_UNUSED(sequence);
-    LV_UNUSED(tv_sec);
-    LV_UNUSED(tv_usec);
     LV_LOG_TRACE("flip");
     drm_dev_t * drm_dev = user_data;
     if(drm_dev->req) {
         drmModeAtomicFree(drm_dev->req);
         drm_dev->req = NULL;
     }
+
+    if(drm_dev->disp == NULL) return;
+
+    /*The timestamp is from CLOCK_MONOTONIC but the tick might be from any other source,
+     *so report the vsync as `lv_tick_get()` minus the time elapsed since the flip*/
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t age_us = ((int64_t)now.tv_sec - tv_sec) * 1000000 + (now.tv_nsec / 1000 - (int64_t)tv_usec);
+    if(age_us < 0) age_us = 0;
+
+    lv_display_report_vsync(drm_dev->disp, lv_tick_get() - (uint32_t)(age_us / 1000));
 }
 
 static int drm_get_plane_props(drm_dev_t * drm_dev)
@@ -1014,29 +1043,21 @@ static int create_gbm_buffer(drm_dev_t * drm_dev, drm_buffer_t * buf)
 static int drm_setup_buffers(drm_dev_t * drm_dev)
 {
     int ret;
+    int i;
 
+    for(i = 0; i < BUFFER_CNT; i++) {
 #if LV_USE_LINUX_DRM_GBM_BUFFERS
-    ret = create_gbm_buffer(drm_dev, &drm_dev->drm_bufs[0]);
-    if(ret < 0) {
-        return ret;
-    }
-
-    ret = create_gbm_buffer(drm_dev, &drm_dev->drm_bufs[1]);
-    if(ret < 0) {
-        return ret;
-    }
-
+        ret = create_gbm_buffer(drm_dev, &drm_dev->drm_bufs[i]);
+        if(ret < 0) {
+            return ret;
+        }
 #else
-    /* Use dumb buffers */
-    ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[0]);
-    if(ret)
-        return ret;
-
-    ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[1]);
-    if(ret)
-        return ret;
-
+        /* Use dumb buffers */
+        ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[i]);
+        if(ret)
+            return ret;
 #endif
+    }
 
     return 0;
 }
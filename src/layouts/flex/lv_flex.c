@@ -47,6 +47,7 @@ typedef struct {
     uint32_t item_cnt;
     grow_dsc_t * grow_dsc;
     uint32_t grow_item_cnt;
+    int32_t next_track_first_item;
     uint32_t grow_dsc_calc : 1;
 } track_t;
 
@@ -235,18 +236,47 @@ static void flex_update(lv_obj_t * cont, void * user_data)
     int32_t track_first_item;
     int32_t next_track_first_item;
 
+    /*The tracks found while calculating the total size. Saved to not search them again when placing the items.*/
+    track_t * tracks = NULL;
+    uint32_t tracks_size = 0;
+    bool tracks_saved = false;
+
     if(track_cross_place != LV_FLEX_ALIGN_START) {
+        tracks_saved = true;
         track_first_item = f.rev ? cont->spec_attr->child_cnt - 1 : 0;
         track_t t;
         while(track_first_item < (int32_t)cont->spec_attr->child_cnt && track_first_item >= 0) {
+            if(tracks_saved && track_cnt == tracks_size) {
+                uint32_t new_size = tracks_size ? tracks_size * 2 : 4;
+                track_t * new_tracks = lv_realloc(tracks, sizeof(track_t) * new_size);
+                if(new_tracks) {
+                    tracks = new_tracks;
+                    tracks_size = new_size;
+                }
+                else {
+                    /*Out of memory: search the tracks again later*/
+                    tracks_saved = false;
+                }
+            }
+
             /*Search the first item of the next row*/
-            t.grow_dsc_calc = 0;
+            t.grow_dsc_calc = tracks_saved ? 1 : 0;
             next_track_first_item = find_track_end(cont, &f, track_first_item, max_main_size, item_gap, &t);
+            t.next_track_first_item = next_track_first_item;
+            if(tracks_saved) tracks[track_cnt] = t;
+
             total_track_cross_size += t.track_cross_size + track_gap;
             track_cnt++;
             track_first_item = next_track_first_item;
         }
 
+        if(!tracks_saved) {
+            uint32_t i;
+            for(i = 0; i < track_cnt && i < tracks_size; i++) {
+                lv_free(tracks[i].grow_dsc);
+            }
+        }
+
         if(track_cnt)
             total_track_cross_size -= track_gap; /*No gap after the last track*/
 
@@ -261,11 +291,19 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         *cross_pos += total_track_cross_size;
     }
 
+    uint32_t track_id = 0;
     while(track_first_item < (int32_t)cont->spec_attr->child_cnt && track_first_item >= 0) {
         track_t t;
-        t.grow_dsc_calc = 1;
-        /*Search the first item of the next row*/
-        next_track_first_item = find_track_end(cont, &f, track_first_item, max_main_size, item_gap, &t);
+        if(tracks_saved) {
+            t = tracks[track_id];
+            next_track_first_item = t.next_track_first_item;
+        }
+        else {
+            t.grow_dsc_calc = 1;
+            /*Search the first item of the next row*/
+            next_track_first_item = find_track_end(cont, &f, track_first_item, max_main_size, item_gap, &t);
+        }
+        track_id++;
 
         if(rtl && !f.row) {
             *cross_pos -= t.track_cross_size;
@@ -281,6 +319,7 @@ static void flex_update(lv_obj_t * cont, void * user_data)
             *cross_pos += t.track_cross_size + gap + track_gap;
         }
     }
+    lv_free(tracks);
     LV_ASSERT_MEM_INTEGRITY();
 
     if(w_set == LV_SIZE_CONTENT || h_set == LV_SIZE_CONTENT) {
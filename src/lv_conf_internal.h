@@ -29,6 +29,7 @@
 #define LV_DRAW_SW_ASM_NEON             1
 #define LV_DRAW_SW_ASM_HELIUM           2
 #define LV_DRAW_SW_ASM_RISCV_V          3
+#define LV_DRAW_SW_ASM_X86              4
 #define LV_DRAW_SW_ASM_CUSTOM           255
 
 #define LV_NEMA_LIB_NONE            0
@@ -242,6 +243,26 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** 1: Allocate the small, frequently created and deleted objects (e.g. draw tasks, event descriptors)
+ *  from slabs of fixed size blocks instead of `lv_malloc()`. It reduces the allocation overhead and fragmentation. */
+#ifndef LV_USE_MEM_SLAB
+    #ifdef CONFIG_LV_USE_MEM_SLAB
+        #define LV_USE_MEM_SLAB CONFIG_LV_USE_MEM_SLAB
+    #else
+        #define LV_USE_MEM_SLAB 0
+    #endif
+#endif
+#if LV_USE_MEM_SLAB
+    /** Size of the chunks which are allocated with `lv_malloc()` to hold the blocks of a size class */
+    #ifndef LV_MEM_SLAB_CHUNK_SIZE
+        #ifdef CONFIG_LV_MEM_SLAB_CHUNK_SIZE
+            #define LV_MEM_SLAB_CHUNK_SIZE CONFIG_LV_MEM_SLAB_CHUNK_SIZE
+        #else
+            #define LV_MEM_SLAB_CHUNK_SIZE (4 * 1024U)    /**< [bytes] */
+        #endif
+    #endif
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -387,6 +408,39 @@
     #endif
 #endif
 
+/** Size of the frame arena. The draw tasks and the temporary draw buffers created while refreshing
+ *  a display are allocated from it and it's reset at once when the refresh is ready.
+ *  If it gets full `lv_malloc()` is used. See `lv_draw_arena_get_stat()` to size it.
+ *  0: don't use a frame arena. */
+#ifndef LV_DRAW_ARENA_SIZE
+    #ifdef CONFIG_LV_DRAW_ARENA_SIZE
+        #define LV_DRAW_ARENA_SIZE CONFIG_LV_DRAW_ARENA_SIZE
+    #else
+        #define LV_DRAW_ARENA_SIZE 0  /**< [bytes]*/
+    #endif
+#endif
+
+/** Skip drawing the widgets which are fully hidden by opaque widgets drawn after them.
+ *  Before drawing an area the largest this many opaque widgets are collected. 0: disable */
+#ifndef LV_REFR_OCCLUDER_MAX
+    #ifdef CONFIG_LV_REFR_OCCLUDER_MAX
+        #define LV_REFR_OCCLUDER_MAX CONFIG_LV_REFR_OCCLUDER_MAX
+    #else
+        #define LV_REFR_OCCLUDER_MAX 0
+    #endif
+#endif
+
+#if LV_REFR_OCCLUDER_MAX
+    /** Smaller opaque widgets are not worth testing against [px]*/
+    #ifndef LV_REFR_OCCLUDER_MIN_SIZE
+        #ifdef CONFIG_LV_REFR_OCCLUDER_MIN_SIZE
+            #define LV_REFR_OCCLUDER_MIN_SIZE CONFIG_LV_REFR_OCCLUDER_MIN_SIZE
+        #else
+            #define LV_REFR_OCCLUDER_MIN_SIZE 1024
+        #endif
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -578,6 +632,17 @@
         #endif
     #endif
 
+    /** Number of slots in the queue of the draw tasks which are ready to be rendered.
+     *  The draw threads take the tasks from this queue. Used only with `LV_USE_OS`.
+     *  Must be a power of 2 and at least 2. */
+    #ifndef LV_DRAW_SW_TASK_QUEUE_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_TASK_QUEUE_SIZE
+            #define LV_DRAW_SW_TASK_QUEUE_SIZE CONFIG_LV_DRAW_SW_TASK_QUEUE_SIZE
+        #else
+            #define LV_DRAW_SW_TASK_QUEUE_SIZE  16
+        #endif
+    #endif
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #ifndef LV_USE_DRAW_ARM2D_SYNC
         #ifdef CONFIG_LV_USE_DRAW_ARM2D_SYNC
@@ -623,6 +688,21 @@
             #endif
         #endif
 
+        /** Number of shadow corners of the maximal size to cache.
+         *  The cache uses at most `LV_DRAW_SW_SHADOW_CACHE_SIZE^2 * LV_DRAW_SW_SHADOW_CACHE_CNT` bytes,
+         *  so more corners fit in it if they are smaller. The least recently used corners are dropped first. */
+        #ifndef LV_DRAW_SW_SHADOW_CACHE_CNT
+            #ifdef LV_KCONFIG_PRESENT
+                #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_CNT
+                    #define LV_DRAW_SW_SHADOW_CACHE_CNT CONFIG_LV_DRAW_SW_SHADOW_CACHE_CNT
+                #else
+                    #define LV_DRAW_SW_SHADOW_CACHE_CNT 0
+                #endif
+            #else
+                #define LV_DRAW_SW_SHADOW_CACHE_CNT 1
+            #endif
+        #endif
+
         /** Set number of maximally-cached circle data.
          *  The circumference of 1/4 circle are saved for anti-aliasing.
          *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
@@ -663,6 +743,19 @@
         #endif
     #endif
 
+    /** Size of the gradient color map cache in bytes.
+     *  The color and opacity maps of the horizontal and vertical gradients and the 256 element
+     *  tables of the complex gradients are saved and reused while the stops and the size are the same.
+     *  A map of `size` entries uses about `size * 4` bytes.
+     *  - 0: disables caching */
+    #ifndef LV_DRAW_SW_GRADIENT_CACHE_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_GRADIENT_CACHE_SIZE
+            #define LV_DRAW_SW_GRADIENT_CACHE_SIZE CONFIG_LV_DRAW_SW_GRADIENT_CACHE_SIZE
+        #else
+            #define LV_DRAW_SW_GRADIENT_CACHE_SIZE      0
+        #endif
+    #endif
+
 #endif
 
 /*Use TSi's aka (Think Silicon) NemaGFX */
@@ -1617,6 +1710,70 @@
     #endif
 #endif
 
+/** Number of entries in the cache of resolved style values. An entry stores the resolved values of the
+ *  built-in style properties for a part of a widget in a given state so that getting them is an array read.
+ *  An entry needs about `LV_STYLE_NUM_BUILT_IN_PROPS * (sizeof(lv_style_value_t) + 1/8) + 32` bytes.
+ *  0: disable the cache */
+#ifndef LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    #ifdef CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+        #define LV_OBJ_STYLE_RESOLVED_CACHE_CNT CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_CNT
+    #else
+        #define LV_OBJ_STYLE_RESOLVED_CACHE_CNT     0
+    #endif
+#endif
+
+/** Number of style slots stored in each `lv_obj_t`. Widgets having at most this many styles
+ *  (including their local and transition styles) don't allocate a separate array for them.
+ *  A slot needs 8 bytes on 32-bit and 16 bytes on 64-bit systems. */
+#ifndef LV_OBJ_STYLE_INLINE_CNT
+    #ifdef CONFIG_LV_OBJ_STYLE_INLINE_CNT
+        #define LV_OBJ_STYLE_INLINE_CNT CONFIG_LV_OBJ_STYLE_INLINE_CNT
+    #else
+        #define LV_OBJ_STYLE_INLINE_CNT     0
+    #endif
+#endif
+
+/** Allocate the special attributes and the local styles of the widgets from pools in chunks of
+ *  this many blocks instead of one by one to reduce the heap fragmentation.
+ *  The chunks of a pool are freed when all of its blocks are free.
+ *  0: allocate them one by one */
+#ifndef LV_OBJ_ATTR_POOL_BLOCK_CNT
+    #ifdef CONFIG_LV_OBJ_ATTR_POOL_BLOCK_CNT
+        #define LV_OBJ_ATTR_POOL_BLOCK_CNT CONFIG_LV_OBJ_ATTR_POOL_BLOCK_CNT
+    #else
+        #define LV_OBJ_ATTR_POOL_BLOCK_CNT  0
+    #endif
+#endif
+
+/** Count the created and existing widgets of each class. See `lv_obj_class_get_alloc_stat()` */
+#ifndef LV_OBJ_CLASS_ALLOC_STAT
+    #ifdef CONFIG_LV_OBJ_CLASS_ALLOC_STAT
+        #define LV_OBJ_CLASS_ALLOC_STAT CONFIG_LV_OBJ_CLASS_ALLOC_STAT
+    #else
+        #define LV_OBJ_CLASS_ALLOC_STAT     0
+    #endif
+#endif
+
+/** Count how many times the events were sent to the widgets. See `lv_obj_get_event_dispatch_stat()` */
+#ifndef LV_OBJ_EVENT_DISPATCH_STAT
+    #ifdef CONFIG_LV_OBJ_EVENT_DISPATCH_STAT
+        #define LV_OBJ_EVENT_DISPATCH_STAT CONFIG_LV_OBJ_EVENT_DISPATCH_STAT
+    #else
+        #define LV_OBJ_EVENT_DISPATCH_STAT  0
+    #endif
+#endif
+
+/** Keep the properties of the styles sorted by ID and add a 256 bit property bitmap to each `lv_style_t`
+ *  so a property can be found without searching the whole style.
+ *  Constant styles created with `LV_STYLE_CONST_INIT_SORTED` are binary searched. */
+#ifndef LV_STYLE_PROP_INDEX
+    #ifdef CONFIG_LV_STYLE_PROP_INDEX
+        #define LV_STYLE_PROP_INDEX CONFIG_LV_STYLE_PROP_INDEX
+    #else
+        #define LV_STYLE_PROP_INDEX     0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -3773,6 +3930,36 @@
     #endif
 #endif
 
+/** 1: Enable the render timeline profiler.
+ *  Records frames, draw tasks, layer allocations and flush waits into per-thread ring buffers
+ *  which can be exported as Chrome trace JSON. */
+#ifndef LV_USE_PROFILER_TIMELINE
+    #ifdef CONFIG_LV_USE_PROFILER_TIMELINE
+        #define LV_USE_PROFILER_TIMELINE CONFIG_LV_USE_PROFILER_TIMELINE
+    #else
+        #define LV_USE_PROFILER_TIMELINE 0
+    #endif
+#endif
+#if LV_USE_PROFILER_TIMELINE
+    /** Number of events stored per thread. The oldest events are overwritten. */
+    #ifndef LV_PROFILER_TIMELINE_EVENT_CNT
+        #ifdef CONFIG_LV_PROFILER_TIMELINE_EVENT_CNT
+            #define LV_PROFILER_TIMELINE_EVENT_CNT CONFIG_LV_PROFILER_TIMELINE_EVENT_CNT
+        #else
+            #define LV_PROFILER_TIMELINE_EVENT_CNT 1024
+        #endif
+    #endif
+
+    /** Max number of threads which can record events */
+    #ifndef LV_PROFILER_TIMELINE_THREAD_CNT
+        #ifdef CONFIG_LV_PROFILER_TIMELINE_THREAD_CNT
+            #define LV_PROFILER_TIMELINE_THREAD_CNT CONFIG_LV_PROFILER_TIMELINE_THREAD_CNT
+        #else
+            #define LV_PROFILER_TIMELINE_THREAD_CNT 8
+        #endif
+    #endif
+#endif
+
 /** 1: Enable Monkey test */
 #ifndef LV_USE_MONKEY
     #ifdef CONFIG_LV_USE_MONKEY
@@ -4345,6 +4532,16 @@
             #define LV_USE_LINUX_DRM_GBM_BUFFERS 0
         #endif
     #endif
+
+    /** Number of frame buffers: 2 or 3.
+     *  With 3 buffers LVGL can render the next frame while the previous one is waiting for the page flip. */
+    #ifndef LV_LINUX_DRM_BUFFER_CNT
+        #ifdef CONFIG_LV_LINUX_DRM_BUFFER_CNT
+            #define LV_LINUX_DRM_BUFFER_CNT CONFIG_LV_LINUX_DRM_BUFFER_CNT
+        #else
+            #define LV_LINUX_DRM_BUFFER_CNT 2
+        #endif
+    #endif
 #endif
 
 /** Interface for TFT_eSPI */
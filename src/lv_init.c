@@ -8,6 +8,7 @@
  *********************/
 #include "misc/lv_timer_private.h"
 #include "misc/lv_profiler_builtin_private.h"
+#include "misc/lv_profiler_timeline_private.h"
 #include "misc/lv_anim_private.h"
 #include "draw/lv_image_decoder_private.h"
 #include "draw/lv_draw_buf_private.h"
@@ -148,11 +149,6 @@ static inline void lv_global_init(lv_global_t * global)
     void LV_LOG_PRINT_CB(lv_log_level_t, const char * txt);
     global->custom_log_print_cb = LV_LOG_PRINT_CB;
 #endif
-
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    global->sw_shadow_cache.cache_size = -1;
-    global->sw_shadow_cache.cache_r = -1;
-#endif
 }
 
 static inline void lv_cleanup_devices(lv_global_t * global)
@@ -196,6 +192,8 @@ void lv_init(void)
 
     lv_mem_init();
 
+    lv_mem_slab_core_init();
+
     lv_draw_buf_init_handlers();
 
 #if LV_USE_SPAN != 0
@@ -212,6 +210,12 @@ void lv_init(void)
 #endif
 #endif
 
+#if LV_USE_PROFILER_TIMELINE
+    lv_profiler_timeline_config_t timeline_config;
+    lv_profiler_timeline_config_init(&timeline_config);
+    lv_profiler_timeline_init(&timeline_config);
+#endif
+
     lv_os_init();
 
     lv_timer_core_init();
@@ -470,6 +474,8 @@ void lv_deinit(void)
 
     lv_obj_style_deinit();
 
+    lv_obj_class_deinit();
+
 #if LV_USE_UEFI
     lv_uefi_platform_deinit();
 #endif
@@ -519,6 +525,10 @@ void lv_deinit(void)
     lv_profiler_builtin_uninit();
 #endif
 
+#if LV_USE_PROFILER_TIMELINE
+    lv_profiler_timeline_uninit();
+#endif
+
 #if LV_USE_OBJ_ID && LV_USE_OBJ_ID_BUILTIN
     lv_objid_builtin_destroy();
 #endif
@@ -533,6 +543,8 @@ void lv_deinit(void)
 
     lv_fs_deinit();
 
+    lv_mem_slab_core_deinit();
+
     lv_mem_deinit();
 
     lv_initialized = false;
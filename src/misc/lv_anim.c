@@ -9,6 +9,7 @@
 #include "lv_anim_private.h"
 
 #include "../core/lv_global.h"
+#include "../core/lv_obj_private.h"
 #include "../tick/lv_tick.h"
 #include "lv_assert.h"
 #include "lv_timer.h"
@@ -29,6 +30,9 @@
 /**In an anim. time this bit indicates that the value is speed, and not time*/
 #define LV_ANIM_SPEED_MASK 0x80000000
 
+/**The initial number of animations in a batch*/
+#define LV_ANIM_BATCH_SIZE_INIT 16
+
 #define state LV_GLOBAL_DEFAULT()->anim_state
 #define anim_ll_p &(state.anim_ll)
 
@@ -40,6 +44,11 @@
  *  STATIC PROTOTYPES
  **********************/
 static void anim_timer(lv_timer_t * param);
+static void anim_exec_all(uint32_t tick);
+static void anim_batch_collect(uint32_t tick);
+static void anim_batch_apply(void);
+static bool anim_batch_add(lv_anim_t * a, int32_t value, int32_t act_time);
+static void anim_batch_forget(const lv_anim_t * a);
 static void anim_vsync_event(lv_event_t * e);
 static void anim_mark_list_change(void);
 static void anim_completed_handler(lv_anim_t * a);
@@ -79,6 +88,9 @@ void lv_anim_core_init(void)
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+
+    lv_free(state.batch.anims);
+    lv_memzero(&state.batch, sizeof(state.batch));
 }
 
 void lv_anim_enable_vsync_mode(bool enable)
@@ -129,8 +141,14 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         remove_concurrent_anims(a);
     }
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = lv_ll_ins_head(anim_ll_p);
+    /*Add the new animation to the animation linked list.
+     *Keep the animations of the same `var` next to each other to apply them in one go.*/
+    lv_anim_t * a_same_var;
+    LV_LL_READ(anim_ll_p, a_same_var) {
+        if(a_same_var->var == a->var) break;
+    }
+
+    lv_anim_t * new_anim = a_same_var ? lv_ll_ins_prev(anim_ll_p, a_same_var) : lv_ll_ins_head(anim_ll_p);
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
 
@@ -283,6 +301,11 @@ void lv_anim_refr_now(void)
     anim_timer(NULL);
 }
 
+void lv_anim_refr_at(uint32_t tick)
+{
+    anim_exec_all(tick);
+}
+
 int32_t lv_anim_path_linear(const lv_anim_t * a)
 {
     /*Calculate the current step*/
@@ -584,12 +607,36 @@ static void anim_timer(lv_timer_t * param)
 {
     LV_UNUSED(param);
 
+    anim_exec_all(lv_tick_get());
+}
+
+static void anim_exec_all(uint32_t tick)
+{
+    /*Called from a callback of an animation, the animations are being updated right now*/
+    if(state.anim_batch_running) return;
+    state.anim_batch_running = true;
+
     /*Flip the run round*/
     state.anim_run_round = state.anim_run_round ? false : true;
 
+    /*Calculate all the new values first and apply them only after that*/
+    anim_batch_collect(tick);
+    anim_batch_apply();
+
+    state.anim_batch_running = false;
+}
+
+/**
+ * Update the time of the animations and add the new values of the running ones to the batch.
+ * @param tick      the time to update the animations to
+ */
+static void anim_batch_collect(uint32_t tick)
+{
     lv_anim_t * a = lv_ll_get_head(anim_ll_p);
     while(a != NULL) {
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
+        /*The animation might be already updated to a later time (see `lv_anim_refr_at`)*/
+        int32_t elaps_signed = (int32_t)(tick - a->last_timer_run);
+        uint32_t elaps = elaps_signed > 0 ? (uint32_t)elaps_signed : 0;
 
         if(a->is_paused) {
             const uint32_t time_paused = lv_tick_elaps(a->pause_time);
@@ -605,12 +652,10 @@ static void anim_timer(lv_timer_t * param)
         else {
             a->act_time += elaps;
         }
-        a->last_timer_run = lv_tick_get();
+        if(elaps_signed >= 0) a->last_timer_run = tick;
 
-        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_completed_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
+        /*It can be set by `lv_anim_delete()` typically in `start_cb`. If set then the linked list
+         *was changed meanwhile and reading it further could be corrupt*/
         state.anim_list_changed = false;
 
         if(!a->is_paused && a->run_round != state.anim_run_round) {
@@ -637,28 +682,10 @@ static void anim_timer(lv_timer_t * param)
                 int32_t act_time_original = a->act_time; /*The unclipped version is used later to correctly repeat the animation*/
                 if(a->act_time > a->duration) a->act_time = a->duration;
 
-                int32_t act_time_before_exec = a->act_time;
-                int32_t new_value;
-                new_value = a->path_cb(a);
-
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                    if(!state.anim_list_changed && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
-                }
-
-                if(!state.anim_list_changed) {
-                    /*Restore the original time to see if there is over time, ignoring silly values.
-                     *Restore only if it wasn't changed in the `exec_cb` for some special reasons.*/
-                    if(a->act_time == act_time_before_exec && act_time_original < a->duration * 2) {
-                        a->act_time = act_time_original;
-                    }
-
-                    /*If the time is elapsed the animation is ready*/
-                    if(a->act_time >= a->duration) {
-                        anim_completed_handler(a);
-                    }
+                int32_t new_value = a->path_cb(a);
+                if(!anim_batch_add(a, new_value, act_time_original)) {
+                    /*Out of memory: skip this step, the animation will catch up in the next one*/
+                    a->act_time = act_time_original;
                 }
             }
         }
@@ -670,7 +697,104 @@ static void anim_timer(lv_timer_t * param)
         else
             a = lv_ll_get_next(anim_ll_p, a);
     }
+}
+
+/**
+ * Apply the values calculated by `anim_batch_collect` and handle the completed animations.
+ */
+static void anim_batch_apply(void)
+{
+    lv_anim_batch_t * batch = &state.batch;
+
+    /*The animations of the same `var` are next to each other,
+     *so e.g. invalidating a widget again for its next animation can be skipped*/
+    lv_obj_set_invalidation_coalescing(true);
+
+    uint32_t i;
+    for(i = 0; i < batch->cnt; i++) {
+        lv_anim_t * a = batch->anims[i];
+        if(a == NULL) continue; /*Deleted in a callback of another animation*/
+
+        int32_t act_time_before_exec = a->act_time;
+        int32_t new_value = batch->values[i];
+        if(new_value != a->current_value) {
+            a->current_value = new_value;
+            /*Apply the calculated value*/
+            if(a->exec_cb) a->exec_cb(a->var, new_value);
+            if(batch->anims[i] && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
+        }
+
+        /*Deleted in its own `exec_cb`*/
+        if(batch->anims[i] == NULL) continue;
+
+        /*Restore the original time to see if there is over time, ignoring silly values.
+         *Restore only if it wasn't changed in the `exec_cb` for some special reasons.*/
+        int32_t act_time_original = batch->act_times[i];
+        if(a->act_time == act_time_before_exec && act_time_original < a->duration * 2) {
+            a->act_time = act_time_original;
+        }
+
+        /*If the time is elapsed the animation is ready*/
+        if(a->act_time >= a->duration) {
+            anim_completed_handler(a);
+        }
+    }
+
+    batch->cnt = 0;
+    lv_obj_set_invalidation_coalescing(false);
+}
 
+/**
+ * Add an animation and its new value to the batch
+ * @param a         pointer to an animation
+ * @param value     the new value of the animation
+ * @param act_time  the not clipped `act_time` of the animation
+ * @return          true: added; false: out of memory
+ */
+static bool anim_batch_add(lv_anim_t * a, int32_t value, int32_t act_time)
+{
+    lv_anim_batch_t * batch = &state.batch;
+    if(batch->cnt == batch->size) {
+        uint32_t new_size = batch->size ? batch->size * 2 : LV_ANIM_BATCH_SIZE_INIT;
+        /*Allocate the arrays in one block*/
+        lv_anim_t ** new_anims = lv_malloc(new_size * (sizeof(lv_anim_t *) + 2 * sizeof(int32_t)));
+        LV_ASSERT_MALLOC(new_anims);
+        if(new_anims == NULL) return false;
+
+        int32_t * new_values = (int32_t *)(new_anims + new_size);
+        int32_t * new_act_times = new_values + new_size;
+        if(batch->cnt) {
+            lv_memcpy(new_anims, batch->anims, batch->cnt * sizeof(lv_anim_t *));
+            lv_memcpy(new_values, batch->values, batch->cnt * sizeof(int32_t));
+            lv_memcpy(new_act_times, batch->act_times, batch->cnt * sizeof(int32_t));
+        }
+        lv_free(batch->anims);
+
+        batch->anims = new_anims;
+        batch->values = new_values;
+        batch->act_times = new_act_times;
+        batch->size = new_size;
+    }
+
+    batch->anims[batch->cnt] = a;
+    batch->values[batch->cnt] = value;
+    batch->act_times[batch->cnt] = act_time;
+    batch->cnt++;
+
+    return true;
+}
+
+/**
+ * Remove a deleted animation from the batch
+ * @param a     pointer to the deleted animation
+ */
+static void anim_batch_forget(const lv_anim_t * a)
+{
+    lv_anim_batch_t * batch = &state.batch;
+    uint32_t i;
+    for(i = 0; i < batch->cnt; i++) {
+        if(batch->anims[i] == a) batch->anims[i] = NULL;
+    }
 }
 
 /**
@@ -693,6 +817,7 @@ static void anim_completed_handler(lv_anim_t * a)
         /*Delete the animation from the list.
          * This way the `completed_cb` will see the animations like it's animation is already deleted*/
         lv_ll_remove(anim_ll_p, a);
+        anim_batch_forget(a);
         /*Flag that the list has changed*/
         anim_mark_list_change();
 
@@ -821,6 +946,7 @@ static bool remove_concurrent_anims(const lv_anim_t * a_current)
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
             lv_ll_remove(anim_ll_p, a);
+            anim_batch_forget(a);
             if(a->deleted_cb != NULL) a->deleted_cb(a);
 #if LV_USE_EXT_DATA
             if(a->ext_data.free_cb) {
@@ -848,6 +974,7 @@ static void remove_anim(void * a)
 {
     lv_anim_t * anim = a;
     lv_ll_remove(anim_ll_p, a);
+    anim_batch_forget(anim);
     if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
 #if LV_USE_EXT_DATA
     if(anim->ext_data.free_cb) {
@@ -24,12 +24,26 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * The animations to update in a step, stored as separate arrays.
+ * First the new values of all animations are calculated, and applied only after that.
+ */
+typedef struct {
+    lv_anim_t ** anims;         /**< The animations to apply. NULL if deleted in the meantime*/
+    int32_t * values;           /**< The calculated new values*/
+    int32_t * act_times;        /**< The not clipped `act_time`s used to repeat the animations correctly*/
+    uint32_t cnt;
+    uint32_t size;
+} lv_anim_batch_t;
+
 typedef struct {
     bool anim_list_changed;
     bool anim_run_round;
     bool anim_vsync_registered;
+    bool anim_batch_running;
     lv_timer_t * timer;
-    lv_ll_t anim_ll;
+    lv_ll_t anim_ll;            /**< The animations grouped by `var`*/
+    lv_anim_batch_t batch;
 } lv_anim_state_t;
 
 /**********************
@@ -52,6 +66,13 @@ void lv_anim_core_deinit(void);
  */
 void lv_anim_enable_vsync_mode(bool enable);
 
+/**
+ * Update all the animations to a given time, e.g. to the time when the next frame will be shown.
+ * Animations already updated to a later time are not moved back.
+ * @param tick      the time to update the animations to in `lv_tick_get()` units
+ */
+void lv_anim_refr_at(uint32_t tick);
+
 /**********************
  *      MACROS
  **********************/
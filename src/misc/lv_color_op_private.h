@@ -28,6 +28,65 @@ extern "C" {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Same as `lv_color_mix32()` but inline for the per-pixel loops of the SW renderer
+ * @param fg    the foreground color, its alpha is used as the mix ratio
+ * @param bg    the background color
+ * @return      the mixed color with the alpha of `bg`
+ */
+static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM lv_color_mix32_inline(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha >= LV_OPA_MAX) {
+        fg.alpha = bg.alpha;
+        return fg;
+    }
+    if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    bg.red = LV_UDIV255((uint32_t)((uint32_t)fg.red * fg.alpha + (uint32_t)bg.red * (255 - fg.alpha)));
+    bg.green = LV_UDIV255((uint32_t)((uint32_t)fg.green * fg.alpha + (uint32_t)bg.green * (255 - fg.alpha)));
+    bg.blue = LV_UDIV255((uint32_t)((uint32_t)fg.blue * fg.alpha + (uint32_t)bg.blue * (255 - fg.alpha)));
+    return bg;
+}
+
+/**
+ * Same as `lv_color32_eq()` but inline for the per-pixel loops of the SW renderer
+ * @param c1    the first color
+ * @param c2    the second color
+ * @return      true: equal
+ */
+static inline bool lv_color32_eq_inline(lv_color32_t c1, lv_color32_t c2)
+{
+    return c1.blue == c2.blue && c1.green == c2.green && c1.red == c2.red && c1.alpha == c2.alpha;
+}
+
+/**
+ * Same as `lv_color_16_16_mix()` but inline for the per-pixel loops of the SW renderer
+ * @param c1    the first color (typically the foreground color)
+ * @param c2    the second color (typically the background color)
+ * @param mix   0..255, or LV_OPA_0/10/20...
+ * @return      mix == 0: c2, mix == 255: c1, mix == 128: 0.5 x c1 + 0.5 x c2
+ */
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_16_16_mix_inline(uint16_t c1, uint16_t c2, uint8_t mix)
+{
+    if(mix == 255) return c1;
+    if(mix == 0) return c2;
+    if(c1 == c2) return c1;
+
+    uint16_t ret;
+
+    /* Source: https://stackoverflow.com/a/50012418/1999969*/
+    mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+
+    /*0x7E0F81F = 0b00000111111000001111100000011111*/
+    uint32_t bg = (uint32_t)(c2 | ((uint32_t)c2 << 16)) & 0x7E0F81F;
+    uint32_t fg = (uint32_t)(c1 | ((uint32_t)c1 << 16)) & 0x7E0F81F;
+    uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x7E0F81F;
+    ret = (uint16_t)(result >> 16) | result;
+
+    return ret;
+}
+
 /**********************
  *      MACROS
  **********************/
@@ -9,6 +9,7 @@
 #include "lv_event_private.h"
 #include "../core/lv_global.h"
 #include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_mem_slab.h"
 #include "lv_assert.h"
 #include "lv_types.h"
 
@@ -35,6 +36,8 @@ static void event_mark_deleting(lv_event_list_t * list, lv_event_dsc_t * dsc);
 static bool event_is_marked_deleting(lv_event_dsc_t * dsc);
 static uint32_t event_array_size(lv_event_list_t * list);
 static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index);
+static void code_mask_add(lv_event_list_t * list, uint32_t filter);
+static uint32_t code_mask_bit(uint32_t code);
 
 /**********************
  *  STATIC VARIABLES
@@ -109,6 +112,7 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
 {
     if(list == NULL) return LV_RESULT_OK;
     if(e->deleted) return LV_RESULT_INVALID;
+    if(!lv_event_list_has_code(list, e->code)) return LV_RESULT_OK;
 
     /* When obj is deleted in its own event, it will cause the `list->array` header to be released,
      * but the content still exists, which leads to memory leakage.
@@ -159,7 +163,7 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
 lv_event_dsc_t * lv_event_add(lv_event_list_t * list, lv_event_cb_t cb, lv_event_code_t filter,
                               void * user_data)
 {
-    lv_event_dsc_t * dsc = lv_malloc(sizeof(lv_event_dsc_t));
+    lv_event_dsc_t * dsc = lv_malloc_slab(sizeof(lv_event_dsc_t));
     LV_ASSERT_NULL(dsc);
 
     dsc->cb = cb;
@@ -176,6 +180,7 @@ lv_event_dsc_t * lv_event_add(lv_event_list_t * list, lv_event_cb_t cb, lv_event
     }
 
     lv_array_push_back(&list->array, &dsc);
+    code_mask_add(list, filter);
     return dsc;
 }
 
@@ -209,6 +214,12 @@ uint32_t lv_event_get_count(lv_event_list_t * list)
     return event_array_size(list);
 }
 
+bool lv_event_list_has_code(const lv_event_list_t * list, lv_event_code_t code)
+{
+    uint32_t bit = code_mask_bit(code);
+    return (list->code_mask[bit >> 5] & ((uint32_t)1 << (bit & 0x1f))) != 0;
+}
+
 lv_event_dsc_t * lv_event_get_dsc(lv_event_list_t * list, uint32_t index)
 {
     LV_ASSERT_NULL(list);
@@ -449,7 +460,7 @@ static void cleanup_event_list_core(lv_array_t * array)
     for(uint32_t i = 0; i < size; i++) {
         lv_event_dsc_t ** dsc_i = lv_array_at(array, i);
         lv_event_dsc_t ** dsc_kept = lv_array_at(array, kept_count);
-        if(event_is_marked_deleting(*dsc_i)) lv_free(*dsc_i);
+        if(event_is_marked_deleting(*dsc_i)) lv_free_slab(*dsc_i, sizeof(lv_event_dsc_t));
         else {
             *dsc_kept = *dsc_i;
             kept_count++;
@@ -468,6 +479,13 @@ static void cleanup_event_list(lv_event_list_t * list)
     cleanup_event_list_core(&list->array);
 
     list->has_marked_deleting = false;
+
+    /*Keep the bits of the remaining callbacks only*/
+    lv_memzero(list->code_mask, sizeof(list->code_mask));
+    const uint32_t size = event_array_size(list);
+    for(uint32_t i = 0; i < size; i++) {
+        code_mask_add(list, (*event_array_at(list, i))->filter);
+    }
 }
 
 static void event_mark_deleting(lv_event_list_t * list, lv_event_dsc_t * dsc)
@@ -487,3 +505,21 @@ static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index)
 {
     return lv_array_at(&list->array, index);
 }
+
+static void code_mask_add(lv_event_list_t * list, uint32_t filter)
+{
+    filter &= ~(LV_EVENT_PREPROCESS | LV_EVENT_MARKED_DELETING);
+    if(filter == LV_EVENT_ALL) {
+        lv_memset(list->code_mask, 0xff, sizeof(list->code_mask));
+        return;
+    }
+
+    uint32_t bit = code_mask_bit(filter);
+    list->code_mask[bit >> 5] |= (uint32_t)1 << (bit & 0x1f);
+}
+
+static uint32_t code_mask_bit(uint32_t code)
+{
+    code &= ~LV_EVENT_PREPROCESS;
+    return code < LV_EVENT_LAST ? code : LV_EVENT_LAST;
+}
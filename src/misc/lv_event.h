@@ -133,6 +133,10 @@ typedef enum {
 
 typedef struct {
     lv_array_t array;
+
+    /** Bit `n` is set if there can be a callback for event code `n`.
+     *  Bit `LV_EVENT_LAST` stands for the custom event codes.*/
+    uint32_t code_mask[(LV_EVENT_LAST + 32) / 32];
     uint8_t is_traversing: 1;          /**< True: the list is being nested traversed */
     uint8_t has_marked_deleting: 1;    /**< True: the list has marked deleting objects
                                          when some of events are marked as deleting */
@@ -151,6 +155,15 @@ bool lv_event_remove_dsc(lv_event_list_t * list, lv_event_dsc_t * dsc);
 
 uint32_t lv_event_get_count(lv_event_list_t * list);
 
+/**
+ * Check if an event list can have a callback for an event code, i.e. if sending the event to the list
+ * can be skipped. It's a quick check, so it might return `true` even if no callback will be called.
+ * @param list      pointer to an event list
+ * @param code      an event code
+ * @return          false: there is no callback for `code` in the list; true: there might be a callback
+ */
+bool lv_event_list_has_code(const lv_event_list_t * list, lv_event_code_t code);
+
 lv_event_dsc_t * lv_event_get_dsc(lv_event_list_t * list, uint32_t index);
 
 lv_event_cb_t lv_event_dsc_get_cb(lv_event_dsc_t * dsc);
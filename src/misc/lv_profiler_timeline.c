@@ -0,0 +1,534 @@
+/**
+ * @file lv_profiler_timeline.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_profiler_timeline_private.h"
+
+#if LV_USE_PROFILER_TIMELINE
+
+#include "../lvgl.h"
+#include "../core/lv_global.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <time.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define timeline_ctx LV_GLOBAL_DEFAULT()->profiler_timeline_context
+
+#define TIMELINE_STR_MAX_LEN 256
+#define TIMELINE_TICK_PER_SEC_MAX 1000000000 /* Maximum accuracy: 1 nanosecond */
+
+/*Most SW draw tasks take less than 1 ms, so use a finer clock than `lv_tick_get()` if there is one*/
+#if defined(__unix__) || defined(__APPLE__)
+    #define TIMELINE_DEFAULT_TICK_PER_SEC 1000000000
+#else
+    #define TIMELINE_DEFAULT_TICK_PER_SEC 1000
+#endif
+
+/*Thread local storage to find the ring buffer of the current thread without a thread ID callback*/
+#if LV_USE_OS == LV_OS_NONE
+    #define TIMELINE_THREAD_LOCAL       /*There is only one thread*/
+#elif (LV_USE_OS == LV_OS_PTHREAD || LV_USE_OS == LV_OS_WINDOWS) && (defined(__GNUC__) || defined(__clang__))
+    #define TIMELINE_THREAD_LOCAL __thread
+#elif LV_USE_OS == LV_OS_WINDOWS && defined(_MSC_VER)
+    #define TIMELINE_THREAD_LOCAL __declspec(thread)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * An event in the timeline
+ */
+typedef struct {
+    uint64_t begin;         /**< Tick when the event began */
+    uint64_t end;           /**< Tick when the event ended */
+    const char * name;      /**< Name of the draw unit or any label */
+    uint32_t id;            /**< Type specific value */
+    lv_area_t area;         /**< Related area */
+    uint8_t type;           /**< `lv_profiler_timeline_event_type_t` */
+    uint8_t has_area : 1;   /**< 1: `area` is set */
+} lv_profiler_timeline_item_t;
+
+/**
+ * Ring buffer of the events of a thread. Only the thread itself writes it (if thread IDs are available).
+ */
+typedef struct {
+    lv_profiler_timeline_item_t * items;
+    uint32_t cnt;           /**< Number of events written. The last `LV_PROFILER_TIMELINE_EVENT_CNT` are kept. */
+    volatile int tid;       /**< ID of the thread */
+    volatile bool used;     /**< true: assigned to a thread */
+} lv_profiler_timeline_thread_t;
+
+/**
+ * Context of the timeline profiler
+ */
+typedef struct _lv_profiler_timeline_ctx_t {
+    lv_profiler_timeline_thread_t threads[LV_PROFILER_TIMELINE_THREAD_CNT];
+    lv_profiler_timeline_config_t config;
+    volatile bool enable;
+    uint32_t gen;           /**< Different for each initialization to invalidate the thread local ring buffers */
+    int local_tid_cnt;      /**< Number of threads found via thread local storage */
+#if LV_USE_OS
+    lv_mutex_t mutex;       /**< Protects assigning the ring buffers, and writing them if there is no way
+                             *   to find the ring buffer of the current thread */
+#endif
+} lv_profiler_timeline_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static uint64_t default_tick_get_cb(void);
+static lv_profiler_timeline_thread_t * get_thread(int tid, bool locked);
+#ifdef TIMELINE_THREAD_LOCAL
+    static lv_profiler_timeline_thread_t * get_local_thread(void);
+#endif
+static void write_event(const lv_profiler_timeline_item_t * item, int tid, bool first,
+                        lv_profiler_timeline_write_cb_t write_cb, void * user_data);
+static void tick_to_us(uint64_t tick, uint64_t * us, uint32_t * us_frac);
+static const char * get_task_type_name(uint32_t type);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static uint32_t timeline_gen_cnt;
+
+#ifdef TIMELINE_THREAD_LOCAL
+    static TIMELINE_THREAD_LOCAL lv_profiler_timeline_thread_t * local_thread;
+    static TIMELINE_THREAD_LOCAL uint32_t local_thread_gen;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_profiler_timeline_config_init(lv_profiler_timeline_config_t * config)
+{
+    LV_ASSERT_NULL(config);
+    lv_memzero(config, sizeof(lv_profiler_timeline_config_t));
+    config->tick_get_cb = default_tick_get_cb;
+    config->tick_per_sec = TIMELINE_DEFAULT_TICK_PER_SEC;
+}
+
+void lv_profiler_timeline_init(const lv_profiler_timeline_config_t * config)
+{
+    LV_ASSERT_NULL(config);
+    LV_ASSERT_NULL(config->tick_get_cb);
+
+    if(config->tick_per_sec == 0 || config->tick_per_sec > TIMELINE_TICK_PER_SEC_MAX) {
+        LV_LOG_WARN("tick_per_sec range must be between 1~%d", TIMELINE_TICK_PER_SEC_MAX);
+        return;
+    }
+
+    if(timeline_ctx) {
+        lv_profiler_timeline_uninit();
+    }
+
+    timeline_ctx = lv_malloc_zeroed(sizeof(lv_profiler_timeline_ctx_t));
+    LV_ASSERT_MALLOC(timeline_ctx);
+    if(timeline_ctx == NULL) return;
+
+    timeline_ctx->config = *config;
+
+    /*0 is the initial value of the thread local generations so skip it*/
+    timeline_gen_cnt++;
+    if(timeline_gen_cnt == 0) timeline_gen_cnt++;
+    timeline_ctx->gen = timeline_gen_cnt;
+#if LV_USE_OS
+    lv_mutex_init(&timeline_ctx->mutex);
+#endif
+}
+
+void lv_profiler_timeline_uninit(void)
+{
+    if(!timeline_ctx) {
+        return;
+    }
+
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_TIMELINE_THREAD_CNT; i++) {
+        lv_free(timeline_ctx->threads[i].items);
+    }
+
+#if LV_USE_OS
+    lv_mutex_delete(&timeline_ctx->mutex);
+#endif
+    lv_free(timeline_ctx);
+    timeline_ctx = NULL;
+}
+
+void lv_profiler_timeline_set_enable(bool en)
+{
+    if(!timeline_ctx) {
+        return;
+    }
+
+    timeline_ctx->enable = en;
+}
+
+void lv_profiler_timeline_reset(void)
+{
+    if(!timeline_ctx) {
+        return;
+    }
+
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_TIMELINE_THREAD_CNT; i++) {
+        timeline_ctx->threads[i].cnt = 0;
+    }
+}
+
+uint64_t lv_profiler_timeline_tick_get(void)
+{
+    if(!(timeline_ctx && timeline_ctx->enable)) {
+        return 0;
+    }
+
+    uint64_t tick = timeline_ctx->config.tick_get_cb();
+
+    /*0 means "not recording"*/
+    return tick ? tick : 1;
+}
+
+void lv_profiler_timeline_add(lv_profiler_timeline_event_type_t type, const char * name, uint32_t id,
+                              const lv_area_t * area, uint64_t begin)
+{
+    if(begin == 0 || !(timeline_ctx && timeline_ctx->enable)) {
+        return;
+    }
+
+    uint64_t end = timeline_ctx->config.tick_get_cb();
+
+    lv_profiler_timeline_thread_t * thread;
+    bool locked = false;
+    if(timeline_ctx->config.tid_get_cb) {
+        thread = get_thread(timeline_ctx->config.tid_get_cb(), false);
+    }
+    else {
+#ifdef TIMELINE_THREAD_LOCAL
+        thread = get_local_thread();
+#else
+        /*The current thread can't be identified so all threads write the same ring buffer*/
+        locked = true;
+#if LV_USE_OS
+        lv_mutex_lock(&timeline_ctx->mutex);
+#endif
+        thread = get_thread(1, true);
+#endif
+    }
+
+    if(thread == NULL) {
+#if LV_USE_OS
+        if(locked) lv_mutex_unlock(&timeline_ctx->mutex);
+#endif
+        return;
+    }
+
+    lv_profiler_timeline_item_t * item = &thread->items[thread->cnt % LV_PROFILER_TIMELINE_EVENT_CNT];
+    item->begin = begin;
+    item->end = end > begin ? end : begin;
+    item->name = name;
+    item->id = id;
+    item->type = type;
+    if(area) {
+        item->area = *area;
+        item->has_area = 1;
+    }
+    else {
+        item->has_area = 0;
+    }
+
+    thread->cnt++;
+
+#if LV_USE_OS
+    if(locked) lv_mutex_unlock(&timeline_ctx->mutex);
+#else
+    LV_UNUSED(locked);
+#endif
+}
+
+uint32_t lv_profiler_timeline_get_event_count(void)
+{
+    if(!timeline_ctx) {
+        return 0;
+    }
+
+    uint32_t sum = 0;
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_TIMELINE_THREAD_CNT; i++) {
+        lv_profiler_timeline_thread_t * thread = &timeline_ctx->threads[i];
+        if(thread->used) sum += LV_MIN(thread->cnt, LV_PROFILER_TIMELINE_EVENT_CNT);
+    }
+
+    return sum;
+}
+
+void lv_profiler_timeline_export(lv_profiler_timeline_write_cb_t write_cb, void * user_data)
+{
+    LV_ASSERT_NULL(write_cb);
+
+    write_cb("{\"traceEvents\":[", user_data);
+
+    bool first = true;
+    uint32_t i;
+    for(i = 0; timeline_ctx && i < LV_PROFILER_TIMELINE_THREAD_CNT; i++) {
+        lv_profiler_timeline_thread_t * thread = &timeline_ctx->threads[i];
+        if(!thread->used) continue;
+
+        /*Start from the oldest event which is not overwritten*/
+        uint32_t item_cnt = LV_MIN(thread->cnt, LV_PROFILER_TIMELINE_EVENT_CNT);
+        uint32_t start = thread->cnt - item_cnt;
+        uint32_t j;
+        for(j = 0; j < item_cnt; j++) {
+            const lv_profiler_timeline_item_t * item = &thread->items[(start + j) % LV_PROFILER_TIMELINE_EVENT_CNT];
+            write_event(item, thread->tid, first, write_cb, user_data);
+            first = false;
+        }
+    }
+
+    write_cb("\n],\"displayTimeUnit\":\"ms\"}\n", user_data);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint64_t default_tick_get_cb(void)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+    return lv_tick_get();
+#endif
+}
+
+/**
+ * Get the ring buffer of a thread. Assign a new one if it's the first event of the thread.
+ * @param tid       ID of the thread
+ * @param locked    true: the mutex is already locked by the caller
+ * @return          the ring buffer or NULL if there are no more free ring buffers
+ */
+static lv_profiler_timeline_thread_t * get_thread(int tid, bool locked)
+{
+    /*Fast path: the thread already has a ring buffer*/
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_TIMELINE_THREAD_CNT; i++) {
+        lv_profiler_timeline_thread_t * thread = &timeline_ctx->threads[i];
+        if(thread->used && thread->tid == tid) return thread;
+    }
+
+#if LV_USE_OS
+    if(!locked) lv_mutex_lock(&timeline_ctx->mutex);
+#else
+    LV_UNUSED(locked);
+#endif
+
+    lv_profiler_timeline_thread_t * thread_free = NULL;
+    for(i = 0; i < LV_PROFILER_TIMELINE_THREAD_CNT; i++) {
+        lv_profiler_timeline_thread_t * thread = &timeline_ctx->threads[i];
+        if(thread->used) {
+            if(thread->tid == tid) {
+                thread_free = thread;
+                break;
+            }
+        }
+        else if(thread_free == NULL) {
+            thread_free = thread;
+        }
+    }
+
+    if(thread_free && !thread_free->used) {
+        thread_free->items = lv_malloc(LV_PROFILER_TIMELINE_EVENT_CNT * sizeof(lv_profiler_timeline_item_t));
+        LV_ASSERT_MALLOC(thread_free->items);
+        if(thread_free->items) {
+            thread_free->cnt = 0;
+            thread_free->tid = tid;
+            thread_free->used = true;
+        }
+        else {
+            thread_free = NULL;
+        }
+    }
+
+#if LV_USE_OS
+    if(!locked) lv_mutex_unlock(&timeline_ctx->mutex);
+#endif
+
+    if(thread_free == NULL) {
+        LV_LOG_WARN("No free event buffer for thread %d, increase LV_PROFILER_TIMELINE_THREAD_CNT", tid);
+    }
+
+    return thread_free;
+}
+
+#ifdef TIMELINE_THREAD_LOCAL
+/**
+ * Get the ring buffer of the current thread from the thread local storage.
+ * Only the first event of a thread locks, to assign a ring buffer to it.
+ * @return          the ring buffer or NULL if there are no more free ring buffers
+ */
+static lv_profiler_timeline_thread_t * get_local_thread(void)
+{
+    if(local_thread_gen == timeline_ctx->gen) return local_thread;
+
+#if LV_USE_OS
+    lv_mutex_lock(&timeline_ctx->mutex);
+#endif
+
+    /*Not a real thread ID, just a different number for each thread*/
+    timeline_ctx->local_tid_cnt++;
+    local_thread = get_thread(timeline_ctx->local_tid_cnt, true);
+    local_thread_gen = timeline_ctx->gen;
+
+#if LV_USE_OS
+    lv_mutex_unlock(&timeline_ctx->mutex);
+#endif
+
+    return local_thread;
+}
+#endif /*TIMELINE_THREAD_LOCAL*/
+
+static void write_event(const lv_profiler_timeline_item_t * item, int tid, bool first,
+                        lv_profiler_timeline_write_cb_t write_cb, void * user_data)
+{
+    const char * name;
+    const char * cat;
+    switch(item->type) {
+        case LV_PROFILER_TIMELINE_EVENT_FRAME:
+            name = "frame";
+            cat = "refr";
+            break;
+        case LV_PROFILER_TIMELINE_EVENT_DRAW_TASK:
+            name = get_task_type_name(item->id);
+            cat = "draw";
+            break;
+        case LV_PROFILER_TIMELINE_EVENT_LAYER_ALLOC:
+            name = "layer_alloc";
+            cat = "draw";
+            break;
+        case LV_PROFILER_TIMELINE_EVENT_FLUSH_WAIT:
+            name = "flush_wait";
+            cat = "refr";
+            break;
+        default:
+            name = "unknown";
+            cat = "other";
+            break;
+    }
+
+    uint64_t ts;
+    uint32_t ts_frac;
+    uint64_t dur;
+    uint32_t dur_frac;
+    tick_to_us(item->begin, &ts, &ts_frac);
+    tick_to_us(item->end - item->begin, &dur, &dur_frac);
+
+    char buf[TIMELINE_STR_MAX_LEN];
+    lv_snprintf(buf, sizeof(buf),
+                "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                "\"ts\":%" LV_PRIu64 ".%03" LV_PRIu32 ",\"dur\":%" LV_PRIu64 ".%03" LV_PRIu32 ",\"args\":{",
+                first ? "" : ",", name, cat, tid, ts, ts_frac, dur, dur_frac);
+    write_cb(buf, user_data);
+
+    /*The names are usually static strings without special characters so they are not escaped*/
+    bool has_arg = false;
+    if(item->name) {
+        lv_snprintf(buf, sizeof(buf), "\"%s\":\"%s\"",
+                    item->type == LV_PROFILER_TIMELINE_EVENT_DRAW_TASK ? "unit" : "name", item->name);
+        write_cb(buf, user_data);
+        has_arg = true;
+    }
+
+    if(item->type == LV_PROFILER_TIMELINE_EVENT_LAYER_ALLOC) {
+        lv_snprintf(buf, sizeof(buf), "%s\"size\":%" LV_PRIu32, has_arg ? "," : "", item->id);
+        write_cb(buf, user_data);
+        has_arg = true;
+    }
+
+    if(item->has_area) {
+        lv_snprintf(buf, sizeof(buf), "%s\"x\":%" LV_PRId32 ",\"y\":%" LV_PRId32 ",\"w\":%" LV_PRId32 ",\"h\":%" LV_PRId32,
+                    has_arg ? "," : "", item->area.x1, item->area.y1,
+                    lv_area_get_width(&item->area), lv_area_get_height(&item->area));
+        write_cb(buf, user_data);
+    }
+
+    write_cb("}}", user_data);
+}
+
+/**
+ * Convert ticks to microseconds
+ * @param tick      the ticks to convert
+ * @param us        store the integer part of the microseconds here
+ * @param us_frac   store the fraction part in 1/1000 microseconds here
+ */
+static void tick_to_us(uint64_t tick, uint64_t * us, uint32_t * us_frac)
+{
+    uint32_t tick_per_sec = timeline_ctx->config.tick_per_sec;
+    uint64_t sec = tick / tick_per_sec;
+    uint64_t nsec = (tick % tick_per_sec) * (TIMELINE_TICK_PER_SEC_MAX / tick_per_sec);
+
+    *us = sec * 1000000 + nsec / 1000;
+    *us_frac = (uint32_t)(nsec % 1000);
+}
+
+static const char * get_task_type_name(uint32_t type)
+{
+    switch(type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+            return "fill";
+        case LV_DRAW_TASK_TYPE_BORDER:
+            return "border";
+        case LV_DRAW_TASK_TYPE_BOX_SHADOW:
+            return "box_shadow";
+        case LV_DRAW_TASK_TYPE_LETTER:
+            return "letter";
+        case LV_DRAW_TASK_TYPE_LABEL:
+            return "label";
+        case LV_DRAW_TASK_TYPE_IMAGE:
+            return "image";
+        case LV_DRAW_TASK_TYPE_LAYER:
+            return "layer";
+        case LV_DRAW_TASK_TYPE_LINE:
+            return "line";
+        case LV_DRAW_TASK_TYPE_ARC:
+            return "arc";
+        case LV_DRAW_TASK_TYPE_TRIANGLE:
+            return "triangle";
+        case LV_DRAW_TASK_TYPE_MASK_RECTANGLE:
+            return "mask_rectangle";
+        case LV_DRAW_TASK_TYPE_MASK_BITMAP:
+            return "mask_bitmap";
+        case LV_DRAW_TASK_TYPE_BLUR:
+            return "blur";
+#if LV_USE_VECTOR_GRAPHIC
+        case LV_DRAW_TASK_TYPE_VECTOR:
+            return "vector";
+#endif
+#if LV_USE_3DTEXTURE
+        case LV_DRAW_TASK_TYPE_3D:
+            return "3d";
+#endif
+        default:
+            return "draw_task";
+    }
+}
+
+#endif /*LV_USE_PROFILER_TIMELINE*/
@@ -0,0 +1,126 @@
+/**
+ * @file lv_profiler_timeline.h
+ *
+ */
+
+#ifndef LV_PROFILER_TIMELINE_H
+#define LV_PROFILER_TIMELINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_conf_internal.h"
+
+#if LV_USE_PROFILER_TIMELINE
+
+#include "lv_types.h"
+#include "lv_area.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LV_PROFILER_TIMELINE_EVENT_FRAME,       /**< Refreshing a display*/
+    LV_PROFILER_TIMELINE_EVENT_DRAW_TASK,   /**< Rendering a draw task. `id` is its `lv_draw_task_type_t`*/
+    LV_PROFILER_TIMELINE_EVENT_LAYER_ALLOC, /**< Allocating the buffer of a layer. `id` is its size in bytes*/
+    LV_PROFILER_TIMELINE_EVENT_FLUSH_WAIT,  /**< Waiting for the display to finish flushing*/
+} lv_profiler_timeline_event_type_t;
+
+/**
+ * Called with the parts of the exported JSON
+ * @param buf           a NULL terminated string
+ * @param user_data     the `user_data` passed to `lv_profiler_timeline_export`
+ */
+typedef void (*lv_profiler_timeline_write_cb_t)(const char * buf, void * user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the configuration of the timeline profiler with the default values:
+ * `CLOCK_MONOTONIC` in nanoseconds as time source on Unix-like systems,
+ * else `lv_tick_get()` (1 ms resolution), and no thread ID callback
+ * @param config    pointer to the configuration structure
+ */
+void lv_profiler_timeline_config_init(lv_profiler_timeline_config_t * config);
+
+/**
+ * Initialize the timeline profiler. It's disabled by default.
+ * @param config    pointer to an initialized configuration structure
+ */
+void lv_profiler_timeline_init(const lv_profiler_timeline_config_t * config);
+
+/**
+ * Free the recorded events and deinitialize the timeline profiler
+ */
+void lv_profiler_timeline_uninit(void);
+
+/**
+ * Start or stop recording events
+ * @param en        true: start recording; false: stop recording
+ */
+void lv_profiler_timeline_set_enable(bool en);
+
+/**
+ * Drop all the recorded events. Shouldn't be called while recording.
+ */
+void lv_profiler_timeline_reset(void);
+
+/**
+ * Get the current time for the start of an event
+ * @return          the current tick or 0 if the timeline profiler is not recording
+ */
+uint64_t lv_profiler_timeline_tick_get(void);
+
+/**
+ * Record an event which started at `begin` and ends now.
+ * Each thread writes only to its own ring buffer, so it locks only to assign a ring buffer
+ * to the first event of a thread. Without a thread ID callback the ring buffer is found
+ * via thread local storage (GCC, Clang or MSVC with `LV_OS_PTHREAD` or `LV_OS_WINDOWS`).
+ * With other compilers and OSes all threads share one ring buffer and it always locks.
+ * @param type      type of the event
+ * @param name      name of the related draw unit, or any label. Should be a static string.
+ * @param id        a type specific value, see `lv_profiler_timeline_event_type_t`
+ * @param area      the related area or NULL
+ * @param begin     the return value of `lv_profiler_timeline_tick_get()` when the event began.
+ *                  If 0 the event is ignored.
+ */
+void lv_profiler_timeline_add(lv_profiler_timeline_event_type_t type, const char * name, uint32_t id,
+                              const lv_area_t * area, uint64_t begin);
+
+/**
+ * Get the number of events stored in the ring buffers
+ * @return          the number of events
+ */
+uint32_t lv_profiler_timeline_get_event_count(void);
+
+/**
+ * Export the recorded events as Chrome trace JSON which can be opened in Perfetto or `chrome://tracing`.
+ * Shouldn't be called while recording.
+ * @param write_cb  called with the parts of the JSON
+ * @param user_data passed to `write_cb`
+ */
+void lv_profiler_timeline_export(lv_profiler_timeline_write_cb_t write_cb, void * user_data);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_PROFILER_TIMELINE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PROFILER_TIMELINE_H*/
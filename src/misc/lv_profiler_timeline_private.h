@@ -0,0 +1,54 @@
+/**
+ * @file lv_profiler_timeline_private.h
+ *
+ */
+
+#ifndef LV_PROFILER_TIMELINE_PRIVATE_H
+#define LV_PROFILER_TIMELINE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_profiler_timeline.h"
+
+#if LV_USE_PROFILER_TIMELINE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Configuration of the timeline profiler
+ */
+struct _lv_profiler_timeline_config_t {
+    uint64_t (*tick_get_cb)(void);      /**< Callback function to get the current tick count */
+    uint32_t tick_per_sec;              /**< The number of ticks per second */
+    int (*tid_get_cb)(void);            /**< Callback function to get the current thread ID.
+                                         *   If NULL the threads are found via thread local storage if it's
+                                         *   supported, else they share one ring buffer protected by a mutex. */
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_PROFILER_TIMELINE */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PROFILER_TIMELINE_PRIVATE_H*/
@@ -28,6 +28,10 @@
  *  STATIC PROTOTYPES
  **********************/
 
+#if LV_STYLE_PROP_INDEX
+    static void prop_index_update(lv_style_t * style);
+#endif
+
 /**********************
  *  GLOBAL VARIABLES
  **********************/
@@ -300,6 +304,10 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 
     if(style->prop_cnt == 0)  return false;
 
+#if LV_STYLE_PROP_INDEX
+    if(lv_style_get_prop_index(style, prop) < 0) return false;
+#endif
+
     LV_PROFILER_STYLE_BEGIN;
 
     uint8_t * tmp = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
@@ -333,6 +341,10 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
             }
 
             lv_free(old_values);
+#if LV_STYLE_PROP_INDEX
+            style->prop_bitmap[prop >> 5] &= ~((uint32_t)1 << (prop & 0x1F));
+            prop_index_update(style);
+#endif
             LV_PROFILER_STYLE_END;
             return true;
         }
@@ -356,6 +368,15 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     lv_style_prop_t * props;
     int32_t i;
 
+#if LV_STYLE_PROP_INDEX
+    i = lv_style_get_prop_index(style, prop);
+    if(i >= 0) {
+        lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+        values[i] = value;
+        LV_PROFILER_STYLE_END;
+        return;
+    }
+#else
     if(style->values_and_props) {
         props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         for(i = style->prop_cnt - 1; i >= 0; i--) {
@@ -367,6 +388,7 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
             }
         }
     }
+#endif
 
     size_t size = (style->prop_cnt + 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
     uint8_t * values_and_props = lv_realloc(style->values_and_props, size);
@@ -377,6 +399,25 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
 
     style->values_and_props = values_and_props;
 
+#if LV_STYLE_PROP_INDEX
+    /*Insert the new property to keep them sorted by ID.
+     *Its index is the number of properties with smaller ID.*/
+    style->prop_bitmap[prop >> 5] |= (uint32_t)1 << (prop & 0x1F);
+    uint32_t idx = lv_style_get_prop_index(style, prop);
+    uint32_t cnt = style->prop_cnt;
+    uint8_t * old_props = values_and_props + cnt * sizeof(lv_style_value_t);
+    props = values_and_props + (cnt + 1) * sizeof(lv_style_value_t);
+    lv_memmove(props + idx + 1, old_props + idx, (cnt - idx) * sizeof(lv_style_prop_t));
+    lv_memmove(props, old_props, idx * sizeof(lv_style_prop_t));
+
+    lv_style_value_t * values = (lv_style_value_t *)values_and_props;
+    lv_memmove(values + idx + 1, values + idx, (cnt - idx) * sizeof(lv_style_value_t));
+
+    props[idx] = prop;
+    values[idx] = value;
+    style->prop_cnt++;
+    prop_index_update(style);
+#else
     props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
     /*Shift all props to make place for the value before them*/
     for(i = style->prop_cnt - 1; i >= 0; i--) {
@@ -391,6 +432,7 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     /*Set the new property and value*/
     props[style->prop_cnt - 1] = prop;
     values[style->prop_cnt - 1] = value;
+#endif
 
     uint32_t group = lv_style_get_prop_group(prop);
     style->has_group |= (uint32_t)1 << group;
@@ -519,3 +561,23 @@ uint8_t lv_style_prop_lookup_flags(lv_style_prop_t prop)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_STYLE_PROP_INDEX
+/**
+ * Recalculate the number of properties before each word of the property bitmap
+ * @param style pointer to a non-constant style
+ */
+static void prop_index_update(lv_style_t * style)
+{
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        style->prop_idx_base[i] = (uint8_t)cnt;
+        uint32_t word = style->prop_bitmap[i];
+        while(word) {
+            word &= word - 1;
+            cnt++;
+        }
+    }
+}
+#endif
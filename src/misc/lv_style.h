@@ -65,6 +65,32 @@ LV_EXPORT_CONST_INT(LV_SCALE_NONE);
         .prop_cnt = 255,                                                \
     }
 #endif
+
+/**
+ * Same as `LV_STYLE_CONST_INIT` but `prop_array` needs to be sorted by property ID
+ * (excluding the closing `LV_STYLE_CONST_PROPS_END`) so that the properties can be binary searched.
+ * `prop_array` needs to be an array (not a pointer) as its size is calculated at compile time.
+ */
+#if LV_STYLE_PROP_INDEX && LV_USE_ASSERT_STYLE
+#define LV_STYLE_CONST_INIT_SORTED(var_name, prop_array)                \
+    const lv_style_t var_name = {                                       \
+        .sentinel = LV_STYLE_SENTINEL_VALUE,                            \
+        .values_and_props = (void*)prop_array,                          \
+        .has_group = 0xFFFFFFFF,                                        \
+        .prop_cnt = 255,                                                \
+        .const_sorted_cnt = sizeof(prop_array) / sizeof(prop_array[0]) - 1 \
+    }
+#elif LV_STYLE_PROP_INDEX
+#define LV_STYLE_CONST_INIT_SORTED(var_name, prop_array)                \
+    const lv_style_t var_name = {                                       \
+        .values_and_props = (void*)prop_array,                          \
+        .has_group = 0xFFFFFFFF,                                        \
+        .prop_cnt = 255,                                                \
+        .const_sorted_cnt = sizeof(prop_array) / sizeof(prop_array[0]) - 1 \
+    }
+#else
+#define LV_STYLE_CONST_INIT_SORTED(var_name, prop_array) LV_STYLE_CONST_INIT(var_name, prop_array)
+#endif
 // *INDENT-ON*
 
 #define LV_STYLE_CONST_PROPS_END { .prop = LV_STYLE_PROP_INV, .value = { .num = 0 } }
@@ -378,6 +404,12 @@ typedef struct {
 
     uint32_t has_group;
     uint8_t prop_cnt;   /**< 255 means it's a constant style*/
+
+#if LV_STYLE_PROP_INDEX
+    uint8_t const_sorted_cnt;   /**< Number of properties of a constant style sorted by ID. 0: not sorted*/
+    uint8_t prop_idx_base[8];   /**< Number of properties in `prop_bitmap` before each 32 bit word*/
+    uint32_t prop_bitmap[8];    /**< `(1 << (prop % 32))` is set in `prop_bitmap[prop / 32]` if `prop` is in the style*/
+#endif
 } lv_style_t;
 
 /**********************
@@ -516,6 +548,32 @@ void lv_style_transition_dsc_init(lv_style_transition_dsc_t * tr, const lv_style
  */
 lv_style_value_t lv_style_prop_get_default(lv_style_prop_t prop);
 
+#if LV_STYLE_PROP_INDEX
+/**
+ * Get the index of a property in a non-constant style.
+ * As the properties are sorted by ID the index is the number of properties with smaller ID.
+ * @param style pointer to a non-constant style
+ * @param prop  the ID of a property
+ * @return      index of the property in the values and props arrays, or -1 if it's not in the style
+ */
+static inline int32_t lv_style_get_prop_index(const lv_style_t * style, lv_style_prop_t prop)
+{
+    uint32_t word = style->prop_bitmap[prop >> 5];
+    uint32_t bit = (uint32_t)1 << (prop & 0x1F);
+    if((word & bit) == 0) return -1;
+
+    word &= bit - 1;
+#if defined(__GNUC__) || defined(__clang__)
+    uint32_t cnt = (uint32_t)__builtin_popcount(word);
+#else
+    word = word - ((word >> 1) & 0x55555555);
+    word = (word & 0x33333333) + ((word >> 2) & 0x33333333);
+    uint32_t cnt = (((word + (word >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+#endif
+    return (int32_t)(style->prop_idx_base[prop >> 5] + cnt);
+}
+#endif
+
 /**
  * Get the value of a property
  * @param style pointer to a style
@@ -532,6 +590,22 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
     if(lv_style_is_const(style)) {
         lv_style_const_prop_t * props = (lv_style_const_prop_t *)style->values_and_props;
         uint32_t i;
+#if LV_STYLE_PROP_INDEX
+        if(style->const_sorted_cnt) {
+            uint32_t min = 0;
+            uint32_t max = style->const_sorted_cnt;
+            while(min < max) {
+                i = (min + max) >> 1;
+                if(props[i].prop < prop) min = i + 1;
+                else max = i;
+            }
+            if(min < style->const_sorted_cnt && props[min].prop == prop) {
+                *value = props[min].value;
+                return LV_STYLE_RES_FOUND;
+            }
+            return LV_STYLE_RES_NOT_FOUND;
+        }
+#endif
         for(i = 0; props[i].prop != LV_STYLE_PROP_INV; i++) {
             if(props[i].prop == prop) {
                 *value = props[i].value;
@@ -540,6 +614,14 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
         }
     }
     else {
+#if LV_STYLE_PROP_INDEX
+        int32_t i = lv_style_get_prop_index(style, prop);
+        if(i >= 0) {
+            lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+            *value = values[i];
+            return LV_STYLE_RES_FOUND;
+        }
+#else
         lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint32_t i;
         for(i = 0; i < style->prop_cnt; i++) {
@@ -549,6 +631,7 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
                 return LV_STYLE_RES_FOUND;
             }
         }
+#endif
     }
     return LV_STYLE_RES_NOT_FOUND;
 }
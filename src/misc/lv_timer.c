@@ -31,9 +31,17 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bool lv_timer_exec(lv_timer_t * timer);
+static void lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static void timer_update_deadline(lv_timer_t * timer);
+static bool timer_heap_insert(lv_timer_t * timer);
+static void timer_heap_remove(lv_timer_t * timer);
+static void timer_heap_update(lv_timer_t * timer);
+static bool timer_heap_less(const lv_timer_t * t1, const lv_timer_t * t2);
+static void timer_heap_set(uint32_t idx, lv_timer_t * timer);
+static void timer_heap_sift_up(uint32_t idx);
+static void timer_heap_sift_down(uint32_t idx);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,43 +98,20 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
+    /*Run the ready timers in the order of their deadline. The timers which already ran in this call
+     *are behind the others with the same deadline, so stop if such a timer gets to the top.*/
+    state_p->run_id++;
+    while(state_p->heap_cnt) {
+        lv_timer_t * timer_active = state_p->heap[0];
+        if(timer_active->run_id == state_p->run_id) break;
+        if(lv_timer_time_remaining(timer_active) != 0) break;
 
-            timer_active = next; /*Load the next timer*/
-        }
-    } while(timer_active);
+        lv_timer_exec(timer_active);
+    }
 
+    /*The paused timers are not in the heap so the top of the heap is the next timer to run*/
     uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
-
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
-    }
+    if(state_p->heap_cnt) time_until_next = lv_timer_time_remaining(state_p->heap[0]);
 
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
@@ -177,12 +162,20 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->run_id = state.run_id - 1;
+    new_timer->create_id = state.create_id++;
 #if LV_USE_EXT_DATA
     new_timer->ext_data.free_cb = NULL;
     new_timer->ext_data.data = NULL;
 #endif
 
-    state.timer_created = true;
+    new_timer->heap_idx = LV_TIMER_HEAP_IDX_NONE;
+    timer_update_deadline(new_timer);
+    if(!timer_heap_insert(new_timer)) {
+        lv_ll_remove(timer_ll_p, new_timer);
+        lv_free(new_timer);
+        return NULL;
+    }
 
     lv_timer_handler_resume();
 
@@ -197,8 +190,9 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    timer_heap_remove(timer);
     lv_ll_remove(timer_ll_p, timer);
-    state.timer_deleted = true;
+    if(timer == state.timer_exec) state.timer_deleted = true;
 
 #if LV_USE_EXT_DATA
     if(timer->ext_data.free_cb) {
@@ -214,12 +208,17 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+    timer_heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+    if(timer->heap_idx == LV_TIMER_HEAP_IDX_NONE) {
+        timer_update_deadline(timer);
+        if(!timer_heap_insert(timer)) timer->paused = true;
+    }
     lv_timer_handler_resume();
 }
 
@@ -227,6 +226,7 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    timer_heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -234,6 +234,7 @@ void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    timer_heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -241,6 +242,12 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+
+    /*Let the timer handler delete or pause the timer*/
+    if(repeat_count == 0 && timer->heap_idx != LV_TIMER_HEAP_IDX_NONE) {
+        timer->deadline = lv_tick_get();
+        timer_heap_sift_up(timer->heap_idx);
+    }
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -259,6 +266,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    timer_heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -273,6 +281,10 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_cnt = 0;
+    state.heap_size = 0;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -330,42 +342,35 @@ void lv_timer_set_external_data(lv_timer_t * timer, void * data, void (* free_cb
  **********************/
 
 /**
- * Execute timer if its remaining time is zero
+ * Execute a timer whose remaining time is zero
  * @param timer pointer to lv_timer
- * @return true: execute, false: not executed
  */
-static bool lv_timer_exec(lv_timer_t * timer)
-{
-    if(timer->paused) return false;
-
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
-
-        if(timer->timer_cb && original_repeat_count != 0) {
-            LV_PROFILER_TIMER_BEGIN_TAG("timer_cb");
-            timer->timer_cb(timer);
-            LV_PROFILER_TIMER_END_TAG("timer_cb");
-        }
+static void lv_timer_exec(lv_timer_t * timer)
+{
+    /* Decrement the repeat count before executing the timer_cb.
+     * If the timer is deleted in its callback `if(timer->repeat_count == 0)` is not executed below
+     * but at least the repeat count is zero*/
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+    timer->run_id = state.run_id;
+    timer_heap_update(timer);
 
-        if(!state.timer_deleted) {
-            LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
-        }
-        else {
-            LV_TRACE_TIMER("timer callback finished");
-        }
+    state.timer_exec = timer;
+    state.timer_deleted = false;
 
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
+    if(timer->timer_cb && original_repeat_count != 0) {
+        LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
+        LV_PROFILER_TIMER_BEGIN_TAG("timer_cb");
+        timer->timer_cb(timer);
+        LV_PROFILER_TIMER_END_TAG("timer_cb");
+        LV_TRACE_TIMER("timer callback finished");
     }
 
-    if(state.timer_deleted == false) { /*The timer might be deleted by itself as well*/
+    LV_ASSERT_MEM_INTEGRITY();
+
+    state.timer_exec = NULL;
+    if(state.timer_deleted == false) { /*The timer might be deleted by itself*/
         if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
             if(timer->auto_delete) {
                 LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
@@ -377,8 +382,6 @@ static bool lv_timer_exec(lv_timer_t * timer)
             }
         }
     }
-
-    return exec;
 }
 
 /**
@@ -388,11 +391,8 @@ static bool lv_timer_exec(lv_timer_t * timer)
  */
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
 {
-    /*Check if at least 'period' time elapsed*/
-    uint32_t elp = lv_tick_elaps(timer->last_run);
-    if(elp >= timer->period)
-        return 0;
-    return timer->period - elp;
+    int32_t remaining = (int32_t)(timer->deadline - lv_tick_get());
+    return remaining > 0 ? (uint32_t)remaining : 0;
 }
 
 /**
@@ -412,3 +412,122 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+/**
+ * Calculate the deadline of a timer from its last run and period.
+ * The deadline is at most `INT32_MAX` ms later to compare the deadlines even if the tick overflows.
+ * @param timer pointer to lv_timer
+ */
+static void timer_update_deadline(lv_timer_t * timer)
+{
+    uint32_t elp = lv_tick_elaps(timer->last_run);
+    uint32_t remaining = elp >= timer->period ? 0 : timer->period - elp;
+    if(remaining > INT32_MAX) remaining = INT32_MAX;
+    timer->deadline = lv_tick_get() + remaining;
+}
+
+/**
+ * Add a timer to the heap
+ * @param timer pointer to lv_timer
+ * @return true: added; false: out of memory
+ */
+static bool timer_heap_insert(lv_timer_t * timer)
+{
+    if(state.heap_cnt == state.heap_size) {
+        uint32_t new_size = state.heap_size ? state.heap_size * 2 : 16;
+        lv_timer_t ** new_heap = lv_realloc(state.heap, new_size * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(new_heap);
+        if(new_heap == NULL) return false;
+        state.heap = new_heap;
+        state.heap_size = new_size;
+    }
+
+    state.heap_cnt++;
+    timer_heap_set(state.heap_cnt - 1, timer);
+    timer_heap_sift_up(timer->heap_idx);
+    return true;
+}
+
+/**
+ * Remove a timer from the heap if it's there
+ * @param timer pointer to lv_timer
+ */
+static void timer_heap_remove(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_idx;
+    if(idx == LV_TIMER_HEAP_IDX_NONE) return;
+
+    timer->heap_idx = LV_TIMER_HEAP_IDX_NONE;
+    state.heap_cnt--;
+    if(idx == state.heap_cnt) return;
+
+    /*Move the last timer to the free place*/
+    timer_heap_set(idx, state.heap[state.heap_cnt]);
+    timer_heap_sift_up(idx);
+    timer_heap_sift_down(state.heap[idx]->heap_idx);
+}
+
+/**
+ * Recalculate the deadline of a timer and move it to its new place in the heap
+ * @param timer pointer to lv_timer
+ */
+static void timer_heap_update(lv_timer_t * timer)
+{
+    timer_update_deadline(timer);
+    if(timer->heap_idx == LV_TIMER_HEAP_IDX_NONE) return;
+
+    timer_heap_sift_up(timer->heap_idx);
+    timer_heap_sift_down(timer->heap_idx);
+}
+
+/**
+ * Tell if a timer should run before an other
+ * @param t1 pointer to lv_timer
+ * @param t2 pointer to lv_timer
+ * @return true: `t1` should run before `t2`
+ */
+static bool timer_heap_less(const lv_timer_t * t1, const lv_timer_t * t2)
+{
+    int32_t diff = (int32_t)(t1->deadline - t2->deadline);
+    if(diff != 0) return diff < 0;
+
+    /*Run the timers which didn't run yet in the current `lv_timer_handler()` call first*/
+    bool t1_ran = t1->run_id == state.run_id;
+    bool t2_ran = t2->run_id == state.run_id;
+    if(t1_ran != t2_ran) return t2_ran;
+
+    /*Run the newer timers first*/
+    return (int32_t)(t1->create_id - t2->create_id) > 0;
+}
+
+static void timer_heap_set(uint32_t idx, lv_timer_t * timer)
+{
+    state.heap[idx] = timer;
+    timer->heap_idx = idx;
+}
+
+static void timer_heap_sift_up(uint32_t idx)
+{
+    lv_timer_t * timer = state.heap[idx];
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!timer_heap_less(timer, state.heap[parent])) break;
+        timer_heap_set(idx, state.heap[parent]);
+        idx = parent;
+    }
+    timer_heap_set(idx, timer);
+}
+
+static void timer_heap_sift_down(uint32_t idx)
+{
+    lv_timer_t * timer = state.heap[idx];
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= state.heap_cnt) break;
+        if(child + 1 < state.heap_cnt && timer_heap_less(state.heap[child + 1], state.heap[child])) child++;
+        if(!timer_heap_less(state.heap[child], timer)) break;
+        timer_heap_set(idx, state.heap[child]);
+        idx = child;
+    }
+    timer_heap_set(idx, timer);
+}
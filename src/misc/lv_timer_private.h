@@ -21,6 +21,8 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#define LV_TIMER_HEAP_IDX_NONE  UINT32_MAX
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -39,15 +41,24 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     volatile int paused;
     uint32_t auto_delete : 1;
+    uint32_t deadline;         /**< The tick when the timer should run next time */
+    uint32_t heap_idx;         /**< Index in the heap of the timers or `LV_TIMER_HEAP_IDX_NONE` if paused */
+    uint32_t run_id;           /**< ID of the `lv_timer_handler()` call which ran the timer last time */
+    uint32_t create_id;        /**< Increasing ID to run the newer timers first if they have the same deadline */
 };
 
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
+    lv_timer_t ** heap;        /**< Binary min-heap of the not paused timers ordered by their deadline */
+    uint32_t heap_cnt;         /**< Number of timers in the heap */
+    uint32_t heap_size;        /**< Number of timers which fit into the allocated heap */
+    uint32_t run_id;           /**< Increased on every `lv_timer_handler()` call */
+    uint32_t create_id;        /**< Increased on every timer creation */
+    lv_timer_t * timer_exec;   /**< The timer whose callback is being called */
 
     bool lv_timer_run;
     uint8_t idle_last;
-    bool timer_deleted;
-    bool timer_created;
+    bool timer_deleted;        /**< Set if `timer_exec` was deleted in its callback */
     volatile uint32_t timer_time_until_next;
 
     bool already_running;
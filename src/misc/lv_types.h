@@ -119,6 +119,15 @@ typedef struct _lv_display_t lv_display_t;
 typedef struct _lv_layer_t lv_layer_t;
 typedef struct _lv_draw_unit_t lv_draw_unit_t;
 typedef struct _lv_draw_task_t lv_draw_task_t;
+typedef struct _lv_draw_task_index_t lv_draw_task_index_t;
+
+typedef struct _lv_draw_record_t lv_draw_record_t;
+
+typedef struct _lv_draw_arena_t lv_draw_arena_t;
+
+typedef struct _lv_obj_draw_retained_t lv_obj_draw_retained_t;
+
+typedef struct _lv_refr_occlusion_t lv_refr_occlusion_t;
 
 typedef struct _lv_indev_t lv_indev_t;
 
@@ -150,10 +159,14 @@ typedef struct _lv_fragment_managed_states_t lv_fragment_managed_states_t;
 
 typedef struct _lv_profiler_builtin_config_t lv_profiler_builtin_config_t;
 
+typedef struct _lv_profiler_timeline_config_t lv_profiler_timeline_config_t;
+
 typedef struct _lv_rb_node_t lv_rb_node_t;
 
 typedef struct _lv_rb_t lv_rb_t;
 
+typedef struct _lv_mem_slab_t lv_mem_slab_t;
+
 typedef struct _lv_color_filter_dsc_t lv_color_filter_dsc_t;
 
 typedef struct _lv_event_dsc_t lv_event_dsc_t;
@@ -184,6 +197,8 @@ typedef struct _lv_obj_style_t lv_obj_style_t;
 
 typedef struct _lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
+typedef struct _lv_obj_style_resolved_t lv_obj_style_resolved_t;
+
 typedef struct _lv_hit_test_info_t lv_hit_test_info_t;
 
 typedef struct _lv_cover_check_info_t lv_cover_check_info_t;
@@ -234,6 +249,8 @@ typedef struct _lv_led_t lv_led_t;
 
 typedef struct _lv_line_t lv_line_t;
 
+typedef struct _lv_list_t lv_list_t;
+
 typedef struct _lv_menu_load_page_event_data_t lv_menu_load_page_event_data_t;
 
 typedef struct _lv_menu_history_t lv_menu_history_t;
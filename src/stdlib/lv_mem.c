@@ -6,6 +6,7 @@
  *      INCLUDES
  *********************/
 #include "lv_mem_private.h"
+#include "lv_mem_slab_private.h"
 #include "lv_string.h"
 #include "../misc/lv_assert.h"
 #include "../misc/lv_log.h"
@@ -181,6 +182,7 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 {
     lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
     lv_mem_monitor_core(mon_p);
+    lv_mem_slab_monitor(mon_p);
 }
 
 /**********************
@@ -41,6 +41,9 @@ typedef struct {
     size_t max_used;    /**< Max size of Heap memory used */
     uint8_t used_pct;   /**< Percentage used */
     uint8_t frag_pct;   /**< Amount of fragmentation */
+    uint32_t slab_hit_cnt;  /**< Allocations of `lv_malloc_slab()` served from a free block of a slab */
+    uint32_t slab_miss_cnt; /**< Allocations of `lv_malloc_slab()` which needed `lv_malloc()` */
+    size_t slab_used_size;  /**< Size of the blocks given out by the slabs */
 } lv_mem_monitor_t;
 
 /**********************
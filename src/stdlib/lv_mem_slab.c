@@ -0,0 +1,271 @@
+/**
+ * @file lv_mem_slab.c
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mem_slab_private.h"
+#include "lv_string.h"
+#include "../misc/lv_assert.h"
+#include "../core/lv_global.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Keep the blocks aligned for any member type*/
+#define SLAB_ALIGN(size) (((size) + 7) & ~7)
+
+/*The link to the next chunk is stored in front of the blocks*/
+#define SLAB_CHUNK_HEADER_SIZE SLAB_ALIGN(sizeof(void *))
+
+#define slabs LV_GLOBAL_DEFAULT()->mem_slabs
+#define slab_large_cnt LV_GLOBAL_DEFAULT()->mem_slab_large_cnt
+#define slab_mutex LV_GLOBAL_DEFAULT()->mem_slab_mutex
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void free_chunks(lv_mem_slab_t * slab, bool keep_one);
+static void add_chunk_blocks(lv_mem_slab_t * slab, uint8_t * chunk);
+#if LV_USE_MEM_SLAB
+    static lv_mem_slab_t * get_class_slab(size_t size);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_MEM_SLAB
+static const uint16_t class_sizes[LV_MEM_SLAB_CLASS_CNT] = {16, 32, 48, 64, 96, 128, 192, 256, 384, 512};
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_mem_slab_init(lv_mem_slab_t * slab, uint32_t block_size, uint32_t block_cnt)
+{
+    LV_ASSERT_NULL(slab);
+    LV_ASSERT(block_cnt > 0);
+
+    lv_memzero(slab, sizeof(lv_mem_slab_t));
+    slab->block_size = SLAB_ALIGN(LV_MAX(block_size, sizeof(void *)));
+    slab->block_cnt = block_cnt;
+}
+
+void lv_mem_slab_deinit(lv_mem_slab_t * slab)
+{
+    LV_ASSERT_NULL(slab);
+    free_chunks(slab, false);
+}
+
+void * lv_mem_slab_alloc(lv_mem_slab_t * slab)
+{
+    LV_ASSERT_NULL(slab);
+
+    if(slab->free_blocks == NULL) {
+        uint8_t * chunk = lv_malloc(SLAB_CHUNK_HEADER_SIZE + slab->block_cnt * slab->block_size);
+        LV_ASSERT_MALLOC(chunk);
+        if(chunk == NULL) return NULL;
+
+        *(void **)chunk = slab->chunks;
+        slab->chunks = chunk;
+        add_chunk_blocks(slab, chunk);
+        slab->miss_cnt++;
+    }
+    else {
+        slab->hit_cnt++;
+    }
+
+    void * block = slab->free_blocks;
+    slab->free_blocks = *(void **)block;
+    slab->used_cnt++;
+
+    return block;
+}
+
+void lv_mem_slab_free(lv_mem_slab_t * slab, void * p)
+{
+    LV_ASSERT_NULL(slab);
+    if(p == NULL) return;
+
+    *(void **)p = slab->free_blocks;
+    slab->free_blocks = p;
+
+    LV_ASSERT(slab->used_cnt > 0);
+    slab->used_cnt--;
+
+    /*Release the memory when nothing is used from the slab, but keep a chunk as a spare
+     *so that a block allocated and freed again and again (e.g. in every frame)
+     *doesn't cause an `lv_malloc()` and `lv_free()` each time*/
+    if(slab->used_cnt == 0 && slab->chunks && *(void **)slab->chunks) free_chunks(slab, true);
+}
+
+void * lv_malloc_slab(size_t size)
+{
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_t * slab = get_class_slab(size);
+    if(slab == NULL) {
+        slab_large_cnt++;
+        return lv_malloc(size);
+    }
+
+#if LV_USE_OS
+    lv_mutex_lock(&slab_mutex);
+#endif
+    void * p = lv_mem_slab_alloc(slab);
+#if LV_USE_OS
+    lv_mutex_unlock(&slab_mutex);
+#endif
+
+    return p;
+#else
+    return lv_malloc(size);
+#endif
+}
+
+void * lv_malloc_slab_zeroed(size_t size)
+{
+    void * p = lv_malloc_slab(size);
+    if(p) lv_memzero(p, size);
+    return p;
+}
+
+void lv_free_slab(void * p, size_t size)
+{
+#if LV_USE_MEM_SLAB
+    if(p == NULL) return;
+
+    lv_mem_slab_t * slab = get_class_slab(size);
+    if(slab == NULL) {
+        lv_free(p);
+        return;
+    }
+
+#if LV_USE_OS
+    lv_mutex_lock(&slab_mutex);
+#endif
+    lv_mem_slab_free(slab, p);
+#if LV_USE_OS
+    lv_mutex_unlock(&slab_mutex);
+#endif
+#else
+    LV_UNUSED(size);
+    lv_free(p);
+#endif
+}
+
+void lv_mem_slab_core_init(void)
+{
+#if LV_USE_MEM_SLAB
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        uint32_t block_cnt = (LV_MEM_SLAB_CHUNK_SIZE - SLAB_CHUNK_HEADER_SIZE) / class_sizes[i];
+        lv_mem_slab_init(&slabs[i], class_sizes[i], LV_MAX(block_cnt, 1));
+    }
+    slab_large_cnt = 0;
+
+#if LV_USE_OS
+    lv_mutex_init(&slab_mutex);
+#endif
+#endif
+}
+
+void lv_mem_slab_core_deinit(void)
+{
+#if LV_USE_MEM_SLAB
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        lv_mem_slab_deinit(&slabs[i]);
+    }
+
+#if LV_USE_OS
+    lv_mutex_delete(&slab_mutex);
+#endif
+#endif
+}
+
+void lv_mem_slab_monitor(lv_mem_monitor_t * mon_p)
+{
+#if LV_USE_MEM_SLAB
+    /*The allocations larger than the largest size class go to the heap*/
+    mon_p->slab_miss_cnt = slab_large_cnt;
+
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        mon_p->slab_hit_cnt += slabs[i].hit_cnt;
+        mon_p->slab_miss_cnt += slabs[i].miss_cnt;
+        mon_p->slab_used_size += (size_t)slabs[i].used_cnt * slabs[i].block_size;
+    }
+#else
+    LV_UNUSED(mon_p);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Free the chunks of a slab
+ * @param slab      pointer to a slab
+ * @param keep_one  true: keep the last allocated chunk with all of its blocks free
+ */
+static void free_chunks(lv_mem_slab_t * slab, bool keep_one)
+{
+    void * chunk = slab->chunks;
+    if(keep_one && chunk) chunk = *(void **)chunk;
+
+    while(chunk) {
+        void * next = *(void **)chunk;
+        lv_free(chunk);
+        chunk = next;
+    }
+
+    slab->free_blocks = NULL;
+    slab->used_cnt = 0;
+
+    if(keep_one && slab->chunks) {
+        *(void **)slab->chunks = NULL;
+        add_chunk_blocks(slab, slab->chunks);
+    }
+    else {
+        slab->chunks = NULL;
+    }
+}
+
+/**
+ * Link the blocks of a chunk to the free list in address order
+ * @param slab      pointer to a slab
+ * @param chunk     pointer to a chunk of the slab
+ */
+static void add_chunk_blocks(lv_mem_slab_t * slab, uint8_t * chunk)
+{
+    uint8_t * blocks = chunk + SLAB_CHUNK_HEADER_SIZE;
+    uint32_t i;
+    for(i = slab->block_cnt; i > 0; i--) {
+        void * block = blocks + (i - 1) * slab->block_size;
+        *(void **)block = slab->free_blocks;
+        slab->free_blocks = block;
+    }
+}
+
+#if LV_USE_MEM_SLAB
+static lv_mem_slab_t * get_class_slab(size_t size)
+{
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        if(size <= class_sizes[i]) return &slabs[i];
+    }
+
+    return NULL;
+}
+#endif
@@ -0,0 +1,93 @@
+/**
+ * @file lv_mem_slab.h
+ *
+ */
+
+#ifndef LV_MEM_SLAB_H
+#define LV_MEM_SLAB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include "../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a slab which gives out fixed size blocks.
+ * The blocks are taken from chunks allocated with `lv_malloc` when the free blocks run out.
+ * @param slab          pointer to a slab
+ * @param block_size    size of a block in bytes. It's rounded up to keep the blocks 8 byte aligned.
+ * @param block_cnt     number of blocks in a chunk
+ */
+void lv_mem_slab_init(lv_mem_slab_t * slab, uint32_t block_size, uint32_t block_cnt);
+
+/**
+ * Free all chunks of a slab. The blocks given out by the slab can't be used anymore.
+ * @param slab          pointer to a slab
+ */
+void lv_mem_slab_deinit(lv_mem_slab_t * slab);
+
+/**
+ * Get a block from a slab
+ * @param slab          pointer to an initialized slab
+ * @return              pointer to uninitialized memory of `block_size` bytes, or NULL on failure
+ */
+void * lv_mem_slab_alloc(lv_mem_slab_t * slab);
+
+/**
+ * Give back a block to its slab. When all blocks are given back the chunks are freed,
+ * except one which is kept for the next allocations. `lv_mem_slab_deinit()` frees it too.
+ * @param slab          pointer to the slab the block was allocated from
+ * @param p             pointer to the block. Can be NULL.
+ */
+void lv_mem_slab_free(lv_mem_slab_t * slab, void * p);
+
+/**
+ * Allocate memory from the slab of the size class of `size`.
+ * Fall back to `lv_malloc` if `size` is larger than the largest size class
+ * or if `LV_USE_MEM_SLAB` is disabled.
+ * @param size          requested size in bytes
+ * @return              pointer to allocated uninitialized memory, or NULL on failure
+ */
+void * lv_malloc_slab(size_t size);
+
+/**
+ * Allocate zeroed memory from the slab of the size class of `size`.
+ * @param size          requested size in bytes
+ * @return              pointer to allocated zeroed memory, or NULL on failure
+ */
+void * lv_malloc_slab_zeroed(size_t size);
+
+/**
+ * Free memory allocated by `lv_malloc_slab` or `lv_malloc_slab_zeroed`
+ * @param p             pointer to the memory. Can be NULL.
+ * @param size          the same size which was used to allocate the memory
+ */
+void lv_free_slab(void * p, size_t size);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_MEM_SLAB_H*/
@@ -0,0 +1,70 @@
+/**
+ * @file lv_mem_slab_private.h
+ *
+ */
+
+#ifndef LV_MEM_SLAB_PRIVATE_H
+#define LV_MEM_SLAB_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_mem_slab.h"
+#include "lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Number of size classes used by `lv_malloc_slab`*/
+#define LV_MEM_SLAB_CLASS_CNT   10
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_mem_slab_t {
+    void * free_blocks;     /**< Linked list of the free blocks. A free block stores the next one.*/
+    void * chunks;          /**< Linked list of the chunks. The first pointer of a chunk is the next chunk.*/
+    uint32_t block_size;    /**< Aligned size of a block*/
+    uint32_t block_cnt;     /**< Number of blocks in a chunk*/
+    uint32_t used_cnt;      /**< Number of blocks given out*/
+    uint32_t hit_cnt;       /**< Allocations served from the free blocks*/
+    uint32_t miss_cnt;      /**< Allocations which needed a new chunk*/
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the size class slabs of `lv_malloc_slab`. Called in `lv_init()`.
+ */
+void lv_mem_slab_core_init(void);
+
+/**
+ * Free the chunks of the size class slabs. Called in `lv_deinit()`.
+ */
+void lv_mem_slab_core_deinit(void);
+
+/**
+ * Add the statistics of the size class slabs to a memory monitor.
+ * Called by `lv_mem_monitor()`.
+ * @param mon_p     pointer to a memory monitor to complete
+ */
+void lv_mem_slab_monitor(lv_mem_monitor_t * mon_p);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_MEM_SLAB_PRIVATE_H*/
@@ -7,7 +7,7 @@
  *      INCLUDES
  *********************/
 #include "../../core/lv_obj_class_private.h"
-#include "lv_list.h"
+#include "lv_list_private.h"
 #include "../../layouts/flex/lv_flex.h"
 #include "../../display/lv_display.h"
 #include "../label/lv_label.h"
@@ -23,6 +23,11 @@
 #define MY_CLASS_BUTTON (&lv_list_button_class)
 #define MY_CLASS_TEXT   (&lv_list_text_class)
 
+/**Number of extra rows to keep on the top and bottom of the visible rows of a virtual list*/
+#define VIRTUAL_ROW_MARGIN  2
+
+#define VIRTUAL_ROW_NONE    UINT32_MAX
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,10 +35,19 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void lv_list_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_list_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void virtual_rows_update(lv_obj_t * obj, bool refill);
+static void virtual_rows_delete(lv_obj_t * obj);
+static void virtual_row_delete_event_cb(lv_event_t * e);
+
 const lv_obj_class_t lv_list_class = {
     .base_class = &lv_obj_class,
+    .destructor_cb = lv_list_destructor,
+    .event_cb = lv_list_event,
     .width_def = (LV_DPI_DEF * 3) / 2,
     .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(lv_list_t),
     .name = "lv_list",
 };
 
@@ -134,6 +148,65 @@ void lv_list_set_button_text(lv_obj_t * list, lv_obj_t * btn, const char * txt)
     }
 }
 
+void lv_list_set_virtual(lv_obj_t * obj, uint32_t row_cnt, int32_t row_h, lv_list_virtual_row_cb_t row_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    virtual_rows_delete(obj);
+
+    list->row_cb = row_cb;
+    list->row_cnt = row_cb ? row_cnt : 0;
+    list->row_height = row_h;
+    lv_obj_refresh_self_size(obj);
+
+    virtual_rows_update(obj, false);
+}
+
+void lv_list_set_virtual_row_count(lv_obj_t * obj, uint32_t row_cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_list_t * list = (lv_list_t *)obj;
+    if(list->row_cb == NULL) return;
+
+    list->row_cnt = row_cnt;
+    lv_obj_refresh_self_size(obj);
+
+    /*Hide the buttons of the removed rows first as they also count when the scroll is adjusted.
+     *Don't stay scrolled below the last row.*/
+    virtual_rows_update(obj, false);
+    lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+    virtual_rows_update(obj, false);
+}
+
+void lv_list_refresh_virtual_rows(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    virtual_rows_update(obj, true);
+}
+
+uint32_t lv_list_get_virtual_row_count(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_list_t * list = (lv_list_t *)obj;
+    return list->row_cnt;
+}
+
+int32_t lv_list_get_virtual_row_id(lv_obj_t * obj, lv_obj_t * btn)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    uint32_t i;
+    for(i = 0; i < list->row_button_cnt; i++) {
+        if(list->row_buttons[i] == btn) {
+            return list->row_button_ids[i] == VIRTUAL_ROW_NONE ? -1 : (int32_t)list->row_button_ids[i];
+        }
+    }
+
+    return -1;
+}
+
 #if LV_USE_TRANSLATION
 
 lv_obj_t * lv_list_add_translation_tag(lv_obj_t * list, const char * tag)
@@ -174,4 +247,154 @@ void lv_list_set_button_translation_tag(lv_obj_t * list, lv_obj_t * btn, const c
  *   STATIC FUNCTIONS
  **********************/
 
+static void lv_list_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    /*The buttons are already deleted with the other children*/
+    lv_free(list->row_buttons);
+    lv_free(list->row_button_ids);
+    list->row_buttons = NULL;
+    list->row_button_ids = NULL;
+    list->row_button_cnt = 0;
+}
+
+static void lv_list_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    /*Call the ancestor's event handler*/
+    lv_result_t res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_list_t * list = (lv_list_t *)obj;
+    if(list->row_cb == NULL) return;
+
+    if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED) {
+        virtual_rows_update(obj, false);
+    }
+    else if(code == LV_EVENT_GET_SELF_SIZE) {
+        /*Scroll as if all the rows existed*/
+        lv_point_t * p = lv_event_get_param(e);
+        if(list->row_cnt) {
+            int32_t row_gap = lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+            int32_t h = (int32_t)list->row_cnt * (list->row_height + row_gap) - row_gap;
+            p->y = LV_MAX(p->y, h);
+        }
+    }
+}
+
+/**
+ * Show the visible rows of a virtual list on its buttons. Create new buttons if needed.
+ * @param obj       pointer to a list
+ * @param refill    true: call `row_cb` for all the rows; false: only for the rows which got a new button
+ */
+static void virtual_rows_update(lv_obj_t * obj, bool refill)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+    if(list->row_cb == NULL) return;
+
+    int32_t row_pitch = list->row_height + lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+    if(row_pitch <= 0) return;
+
+    /*Find the visible rows and keep a few more around them to have them ready while scrolling*/
+    int32_t first = 0;
+    int32_t end = 0;
+    uint32_t needed = 0;
+    if(list->row_cnt) {
+        int32_t scroll_y = lv_obj_get_scroll_y(obj);
+        int32_t content_h = lv_obj_get_content_height(obj);
+        first = LV_MAX(scroll_y / row_pitch - VIRTUAL_ROW_MARGIN, 0);
+        end = (scroll_y + content_h) / row_pitch + 1 + VIRTUAL_ROW_MARGIN;
+        end = LV_CLAMP(first, end, (int32_t)list->row_cnt);
+
+        /*Have buttons for the largest window at any scroll position
+         *so that the rows are not reassigned when the window grows at the ends*/
+        needed = (uint32_t)LV_MAX(content_h / row_pitch + 2 + 2 * VIRTUAL_ROW_MARGIN, 1);
+        needed = LV_MIN(needed, list->row_cnt);
+    }
+
+    if(needed > list->row_button_cnt) {
+        lv_obj_t ** buttons = lv_realloc(list->row_buttons, needed * sizeof(lv_obj_t *));
+        LV_ASSERT_MALLOC(buttons);
+        if(buttons == NULL) return;
+        list->row_buttons = buttons;
+
+        uint32_t * ids = lv_realloc(list->row_button_ids, needed * sizeof(uint32_t));
+        LV_ASSERT_MALLOC(ids);
+        if(ids == NULL) return;
+        list->row_button_ids = ids;
+
+        while(list->row_button_cnt < needed) {
+            lv_obj_t * btn = lv_list_add_button(obj, NULL, "");
+            lv_obj_add_flag(btn, LV_OBJ_FLAG_IGNORE_LAYOUT);
+            lv_obj_set_height(btn, list->row_height);
+            lv_obj_add_event_cb(btn, virtual_row_delete_event_cb, LV_EVENT_DELETE, obj);
+            list->row_buttons[list->row_button_cnt] = btn;
+            list->row_button_cnt++;
+        }
+
+        /*Assign the rows to the buttons from scratch*/
+        uint32_t i;
+        for(i = 0; i < list->row_button_cnt; i++) {
+            list->row_button_ids[i] = VIRTUAL_ROW_NONE;
+        }
+    }
+
+    /*Every button shows the rows having the same remainder when divided by the number of buttons.
+     *This way only the buttons of the rows scrolled out of view get new rows.*/
+    uint32_t btn_cnt = list->row_button_cnt;
+    uint32_t i;
+    for(i = 0; i < btn_cnt; i++) {
+        lv_obj_t * btn = list->row_buttons[i];
+        uint32_t row_id = (uint32_t)first + (i + btn_cnt - (uint32_t)first % btn_cnt) % btn_cnt;
+        if(row_id >= (uint32_t)end) {
+            list->row_button_ids[i] = VIRTUAL_ROW_NONE;
+            lv_obj_add_flag(btn, LV_OBJ_FLAG_HIDDEN);
+            continue;
+        }
+
+        if(refill || list->row_button_ids[i] != row_id) {
+            list->row_button_ids[i] = row_id;
+            lv_obj_set_y(btn, (int32_t)row_id * row_pitch);
+            list->row_cb(obj, btn, row_id);
+        }
+        lv_obj_remove_flag(btn, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/**
+ * Delete all the buttons of a virtual list
+ * @param obj       pointer to a list
+ */
+static void virtual_rows_delete(lv_obj_t * obj)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+
+    /*The buttons remove themselves from the array when deleted*/
+    while(list->row_button_cnt) {
+        lv_obj_delete(list->row_buttons[list->row_button_cnt - 1]);
+    }
+}
+
+static void virtual_row_delete_event_cb(lv_event_t * e)
+{
+    lv_obj_t * btn = lv_event_get_target(e);
+    lv_list_t * list = lv_event_get_user_data(e);
+
+    uint32_t i;
+    for(i = 0; i < list->row_button_cnt; i++) {
+        if(list->row_buttons[i] == btn) {
+            /*Move the last button to its place. It will get a row again in the next update.*/
+            list->row_button_cnt--;
+            list->row_buttons[i] = list->row_buttons[list->row_button_cnt];
+            list->row_button_ids[i] = VIRTUAL_ROW_NONE;
+            break;
+        }
+    }
+}
+
 #endif /*LV_USE_LIST*/
@@ -29,6 +29,15 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * Called to show the data of a row on a button of a virtual list.
+ * The buttons are reused, so everything the row shows needs to be set.
+ * @param list      pointer to a list
+ * @param btn       pointer to the list button which shows the row from now
+ * @param row_id    index of the row to show
+ */
+typedef void (*lv_list_virtual_row_cb_t)(lv_obj_t * list, lv_obj_t * btn, uint32_t row_id);
+
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_class;
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_text_class;
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_button_class;
@@ -76,6 +85,48 @@ const char * lv_list_get_button_text(lv_obj_t * list, lv_obj_t * btn);
  */
 void lv_list_set_button_text(lv_obj_t * list, lv_obj_t * btn, const char * txt);
 
+/**
+ * Make a list virtual: buttons are created only for the visible rows and a few rows around them.
+ * While scrolling, the buttons of the rows which went out of view are reused to show the new rows.
+ * The list can be scrolled as if all the rows existed.
+ * Every row has the same height and the rows are placed below each other with `pad_row` gap.
+ * @param list      pointer to a list
+ * @param row_cnt   number of rows
+ * @param row_h     height of a row
+ * @param row_cb    called to show the data of a row on a button. NULL to delete the rows
+ *                  and make the list normal again.
+ */
+void lv_list_set_virtual(lv_obj_t * list, uint32_t row_cnt, int32_t row_h, lv_list_virtual_row_cb_t row_cb);
+
+/**
+ * Set the number of rows of a virtual list, e.g. when the data set has changed.
+ * @param list      pointer to a virtual list
+ * @param row_cnt   new number of rows
+ */
+void lv_list_set_virtual_row_count(lv_obj_t * list, uint32_t row_cnt);
+
+/**
+ * Call the `row_cb` of a virtual list again for all the rows having a button,
+ * e.g. when the data of the rows has changed.
+ * @param list      pointer to a virtual list
+ */
+void lv_list_refresh_virtual_rows(lv_obj_t * list);
+
+/**
+ * Get the number of rows of a virtual list
+ * @param list      pointer to a list
+ * @return          number of rows, 0 if the list is not virtual
+ */
+uint32_t lv_list_get_virtual_row_count(lv_obj_t * list);
+
+/**
+ * Get which row is shown by a button of a virtual list
+ * @param list      pointer to a virtual list
+ * @param btn       pointer to a button of the list
+ * @return          index of the row, or -1 if the button doesn't show any rows now
+ */
+int32_t lv_list_get_virtual_row_id(lv_obj_t * list, lv_obj_t * btn);
+
 #if LV_USE_TRANSLATION
 
 /**
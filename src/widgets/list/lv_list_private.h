@@ -0,0 +1,56 @@
+/**
+ * @file lv_list_private.h
+ *
+ */
+
+#ifndef LV_LIST_PRIVATE_H
+#define LV_LIST_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_list.h"
+
+#if LV_USE_LIST
+#include "../../core/lv_obj_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Data of list */
+struct _lv_list_t {
+    lv_obj_t obj;
+    lv_list_virtual_row_cb_t row_cb;    /**< Fills a button with the data of a row. NULL if not virtual*/
+    uint32_t row_cnt;                   /**< Number of rows of a virtual list*/
+    int32_t row_height;                 /**< Height of a row of a virtual list*/
+    lv_obj_t ** row_buttons;            /**< The buttons reused to show the visible rows*/
+    uint32_t * row_button_ids;          /**< The ID of the row shown by each button*/
+    uint32_t row_button_cnt;
+};
+
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_LIST */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_LIST_PRIVATE_H*/
@@ -47,12 +47,27 @@ static size_t get_cell_txt_len(const char * txt);
 static void copy_cell_txt(lv_table_cell_t * dst, const char * txt);
 static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t * area);
 static void scroll_to_selected_cell(lv_obj_t * obj);
+static void free_cells(lv_table_t * table);
 
 static inline bool is_cell_empty(void * cell)
 {
     return cell == NULL;
 }
 
+static inline lv_table_cell_t * get_cell_data(lv_table_t * table, uint32_t cell)
+{
+    /*The cells of a virtual table are not stored*/
+    return table->cell_cb ? NULL : table->cell_data[cell];
+}
+
+static inline bool is_virtual_set_invalid(lv_table_t * table)
+{
+    if(table->cell_cb == NULL) return false;
+
+    LV_LOG_WARN("the cells of a virtual table can't be set");
+    return true;
+}
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -111,6 +126,7 @@ void lv_table_set_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col, const c
     LV_ASSERT_NULL(txt);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(is_virtual_set_invalid(table)) return;
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -146,6 +162,7 @@ void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint32_t row, uint32_t col, con
     LV_ASSERT_NULL(fmt);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(is_virtual_set_invalid(table)) return;
     if(col >= table->col_cnt) {
         lv_table_set_column_count(obj, col + 1);
     }
@@ -225,6 +242,20 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
 
     if(table->row_cnt == row_cnt) return;
 
+    /*The rows of a virtual table are not stored, only the size changes*/
+    if(table->cell_cb) {
+        table->row_cnt = row_cnt;
+        if(table->row_act != LV_TABLE_CELL_NONE && table->row_act >= row_cnt) {
+            table->row_act = LV_TABLE_CELL_NONE;
+            table->col_act = LV_TABLE_CELL_NONE;
+        }
+        refr_size_form_row(obj, 0);
+
+        /*Don't stay scrolled below the last row*/
+        lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+        return;
+    }
+
     uint32_t old_row_cnt = table->row_cnt;
     table->row_cnt         = row_cnt;
 
@@ -267,36 +298,39 @@ void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
     uint32_t old_col_cnt = table->col_cnt;
     table->col_cnt         = col_cnt;
 
-    lv_table_cell_t ** new_cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
-    LV_ASSERT_MALLOC(new_cell_data);
-    if(new_cell_data == NULL) return;
-    uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
+    /*The cells of a virtual table are not stored*/
+    if(table->cell_cb == NULL) {
+        lv_table_cell_t ** new_cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
+        LV_ASSERT_MALLOC(new_cell_data);
+        if(new_cell_data == NULL) return;
+        uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
 
-    lv_memzero(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
+        lv_memzero(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
 
-    /*The new column(s) messes up the mapping of `cell_data`*/
-    uint32_t old_col_start;
-    uint32_t new_col_start;
-    uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
-    uint32_t row;
-    for(row = 0; row < table->row_cnt; row++) {
-        old_col_start = row * old_col_cnt;
-        new_col_start = row * col_cnt;
-
-        lv_memcpy(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
-                  sizeof(new_cell_data[0]) * min_col_cnt);
-
-        /*Free the old cells (only if the table becomes smaller)*/
-        int32_t i;
-        for(i = 0; i < (int32_t)old_col_cnt - (int32_t)col_cnt; i++) {
-            uint32_t idx = old_col_start + min_col_cnt + i;
-            lv_free(table->cell_data[idx]);
-            table->cell_data[idx] = NULL;
+        /*The new column(s) messes up the mapping of `cell_data`*/
+        uint32_t old_col_start;
+        uint32_t new_col_start;
+        uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
+        uint32_t row;
+        for(row = 0; row < table->row_cnt; row++) {
+            old_col_start = row * old_col_cnt;
+            new_col_start = row * col_cnt;
+
+            lv_memcpy(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
+                      sizeof(new_cell_data[0]) * min_col_cnt);
+
+            /*Free the old cells (only if the table becomes smaller)*/
+            int32_t i;
+            for(i = 0; i < (int32_t)old_col_cnt - (int32_t)col_cnt; i++) {
+                uint32_t idx = old_col_start + min_col_cnt + i;
+                lv_free(table->cell_data[idx]);
+                table->cell_data[idx] = NULL;
+            }
         }
-    }
 
-    lv_free(table->cell_data);
-    table->cell_data = new_cell_data;
+        lv_free(table->cell_data);
+        table->cell_data = new_cell_data;
+    }
 
     /*Initialize the new column widths if any*/
     table->col_w = lv_realloc(table->col_w, col_cnt * sizeof(table->col_w[0]));
@@ -329,6 +363,7 @@ void lv_table_set_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(is_virtual_set_invalid(table)) return;
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -355,6 +390,7 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(is_virtual_set_invalid(table)) return;
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -375,11 +411,12 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
     table->cell_data[cell]->ctrl &= (~ctrl);
 }
 
-void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, void * user_data)
+void lv_table_set_cell_user_data(lv_obj_t * obj, uint32_t row, uint32_t col, void * user_data)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(is_virtual_set_invalid(table)) return;
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -400,7 +437,25 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
     table->cell_data[cell]->user_data = user_data;
 }
 
-void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col)
+void lv_table_set_virtual(lv_obj_t * obj, uint32_t row_cnt, int32_t row_h, lv_table_virtual_cell_cb_t cell_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+
+    free_cells(table);
+    table->row_cnt = 0;
+    table->row_act = LV_TABLE_CELL_NONE;
+    table->col_act = LV_TABLE_CELL_NONE;
+    table->cell_cb = cell_cb;
+    table->virtual_row_h = LV_MAX(row_h, 1);
+
+    lv_table_set_row_count(obj, row_cnt);
+    refr_size_form_row(obj, 0);
+    lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+}
+
+void lv_table_set_selected_cell(lv_obj_t * obj, uint32_t row, uint32_t col)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
@@ -433,6 +488,11 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col)
         LV_LOG_WARN("invalid row or column");
         return "";
     }
+    if(table->cell_cb) {
+        const char * txt = table->cell_cb(obj, row, col);
+        return txt ? txt : "";
+    }
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return "";
@@ -456,6 +516,14 @@ uint32_t lv_table_get_column_count(lv_obj_t * obj)
     return table->col_cnt;
 }
 
+bool lv_table_is_virtual(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    return table->cell_cb != NULL;
+}
+
 int32_t lv_table_get_column_width(lv_obj_t * obj, uint32_t col)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -479,10 +547,10 @@ bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
         LV_LOG_WARN("invalid row or column");
         return false;
     }
-    uint32_t cell = row * table->col_cnt + col;
+    lv_table_cell_t * cell_data = get_cell_data(table, row * table->col_cnt + col);
 
-    if(is_cell_empty(table->cell_data[cell])) return false;
-    else return (table->cell_data[cell]->ctrl & ctrl) == ctrl;
+    if(is_cell_empty(cell_data)) return false;
+    else return (cell_data->ctrl & ctrl) == ctrl;
 }
 
 void lv_table_get_selected_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col)
@@ -492,7 +560,7 @@ void lv_table_get_selected_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col)
     *col = table->col_act;
 }
 
-void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col)
+void * lv_table_get_cell_user_data(lv_obj_t * obj, uint32_t row, uint32_t col)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
@@ -501,11 +569,11 @@ void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col)
         LV_LOG_WARN("invalid row or column");
         return NULL;
     }
-    uint32_t cell = row * table->col_cnt + col;
+    lv_table_cell_t * cell_data = get_cell_data(table, row * table->col_cnt + col);
 
-    if(is_cell_empty(table->cell_data[cell])) return NULL;
+    if(is_cell_empty(cell_data)) return NULL;
 
-    return table->cell_data[cell]->user_data;
+    return cell_data->user_data;
 }
 
 /**********************
@@ -537,17 +605,7 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
     LV_UNUSED(class_p);
     lv_table_t * table = (lv_table_t *)obj;
-    /*Free the cell texts*/
-    uint32_t i;
-    for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
-        if(table->cell_data[i]) {
-            lv_free(table->cell_data[i]);
-            table->cell_data[i] = NULL;
-        }
-    }
-
-    if(table->cell_data) lv_free(table->cell_data);
-    if(table->row_h) lv_free(table->row_h);
+    free_cells(table);
     if(table->col_w) lv_free(table->col_w);
 }
 
@@ -575,7 +633,8 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
         for(i = 0; i < table->col_cnt; i++) w += table->col_w[i];
 
         int32_t h = 0;
-        for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
+        if(table->cell_cb) h = table->row_cnt * table->virtual_row_h;
+        else for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
 
         p->x = w - 1;
         p->y = h - 1;
@@ -611,9 +670,7 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
     }
     else if(code == LV_EVENT_KEY) {
         int32_t c = *((int32_t *)lv_event_get_param(e));
-        int32_t col = table->col_act;
-        int32_t row = table->row_act;
-        if(col == LV_TABLE_CELL_NONE || row == LV_TABLE_CELL_NONE) {
+        if(table->col_act == LV_TABLE_CELL_NONE || table->row_act == LV_TABLE_CELL_NONE) {
             table->col_act = 0;
             table->row_act = 0;
             scroll_to_selected_cell(obj);
@@ -621,6 +678,8 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
             return;
         }
 
+        int32_t col = table->col_act;
+        int32_t row = table->row_act;
         if(col >= (int32_t)table->col_cnt) col = 0;
         if(row >= (int32_t)table->row_cnt) row = 0;
 
@@ -719,9 +778,16 @@ static void draw_main(lv_event_t * e)
     int32_t scroll_x = lv_obj_get_scroll_x(obj) ;
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
 
+    /*Skip the rows of a virtual table above the clip area. They all have the same height.*/
+    uint32_t row_start = 0;
+    if(table->cell_cb && clip_area.y1 > cell_area.y2 + 1) {
+        row_start = LV_MIN((uint32_t)(clip_area.y1 - cell_area.y2 - 1) / table->virtual_row_h, table->row_cnt);
+        cell_area.y2 += row_start * table->virtual_row_h;
+    }
+
     /*Handle custom drawer*/
-    for(row = 0; row < table->row_cnt; row++) {
-        int32_t h_row = table->row_h[row];
+    for(row = row_start; row < table->row_cnt; row++) {
+        int32_t h_row = table->cell_cb ? table->virtual_row_h : table->row_h[row];
 
         cell_area.y1 = cell_area.y2 + 1;
         cell_area.y2 = cell_area.y1 + h_row - 1;
@@ -732,8 +798,9 @@ static void draw_main(lv_event_t * e)
         else cell_area.x2 = obj->coords.x1 + bg_left - 1 - scroll_x + border_width;
 
         for(col = 0; col < table->col_cnt; col++) {
+            lv_table_cell_t * cell_data = get_cell_data(table, cell);
             lv_table_cell_ctrl_t ctrl = 0;
-            if(table->cell_data[cell]) ctrl = table->cell_data[cell]->ctrl;
+            if(cell_data) ctrl = cell_data->ctrl;
 
             if(rtl) {
                 cell_area.x2 = cell_area.x1 - 1;
@@ -746,7 +813,7 @@ static void draw_main(lv_event_t * e)
 
             uint32_t col_merge = 0;
             for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
-                lv_table_cell_t * next_cell_data = table->cell_data[cell + col_merge];
+                lv_table_cell_t * next_cell_data = get_cell_data(table, cell + col_merge);
 
                 if(is_cell_empty(next_cell_data)) break;
 
@@ -819,7 +886,17 @@ static void draw_main(lv_event_t * e)
 
             lv_draw_rect(layer, &rect_dsc_act, &cell_area_border);
 
-            if(table->cell_data[cell]) {
+            const char * txt = NULL;
+            if(table->cell_cb) {
+                txt = table->cell_cb(obj, row, col);
+                /*The text might be in a buffer which is reused for the next cell*/
+                label_dsc_act.text_local = 1;
+            }
+            else if(cell_data) {
+                txt = cell_data->txt;
+            }
+
+            if(txt) {
                 const int32_t cell_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
                 const int32_t cell_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
                 const int32_t cell_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -845,7 +922,7 @@ static void draw_main(lv_event_t * e)
                     label_dsc_act.flag |= LV_TEXT_FLAG_EXPAND;
                 }
 
-                lv_text_get_size_attributes(&txt_size, table->cell_data[cell]->txt, label_dsc_def.font, &attributes);
+                lv_text_get_size_attributes(&txt_size, txt, label_dsc_def.font, &attributes);
 
                 /*Align the content to the middle if not cropped*/
                 if(!crop) {
@@ -858,7 +935,7 @@ static void draw_main(lv_event_t * e)
                 label_mask_ok = lv_area_intersect(&label_clip_area, &clip_area, &cell_area);
                 if(label_mask_ok) {
                     layer->_clip_area = label_clip_area;
-                    label_dsc_act.text = table->cell_data[cell]->txt;
+                    label_dsc_act.text = txt;
                     lv_draw_label(layer, &label_dsc_act, &txt_area);
                     layer->_clip_area = clip_area;
                 }
@@ -888,6 +965,9 @@ static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
     const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    /*The rows of a virtual table have a fixed height*/
+    if(table->cell_cb) start_row = table->row_cnt;
+
     uint32_t i;
     for(i = start_row; i < table->row_cnt; i++) {
         int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
@@ -1050,11 +1130,17 @@ static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * c
         *row = 0;
         tmp = 0;
 
-        for(*row = 0; *row < table->row_cnt; (*row)++) {
-            tmp += table->row_h[*row];
-            if(y < tmp) {
-                is_click_on_valid_row = true;
-                break;
+        if(table->cell_cb) {
+            *row = y < 0 ? table->row_cnt : LV_MIN((uint32_t)y / table->virtual_row_h, table->row_cnt);
+            is_click_on_valid_row = *row < table->row_cnt;
+        }
+        else {
+            for(*row = 0; *row < table->row_cnt; (*row)++) {
+                tmp += table->row_h[*row];
+                if(y < tmp) {
+                    is_click_on_valid_row = true;
+                    break;
+                }
             }
         }
     }
@@ -1107,7 +1193,7 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
     uint32_t col_merge = 0;
     int32_t offset = 0;
     for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
-        lv_table_cell_t * next_cell_data = table->cell_data[row * table->col_cnt + col_merge];
+        lv_table_cell_t * next_cell_data = get_cell_data(table, row * table->col_cnt + col_merge);
 
         if(is_cell_empty(next_cell_data)) break;
 
@@ -1134,14 +1220,34 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
 
     uint32_t r;
     area->y1 = 0;
-    for(r = 0; r < row; r++) {
-        area->y1 += table->row_h[r];
+    if(table->cell_cb) {
+        area->y1 = row * table->virtual_row_h;
+    }
+    else {
+        for(r = 0; r < row; r++) {
+            area->y1 += table->row_h[r];
+        }
     }
 
     area->y1 += lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
     area->y1 -= lv_obj_get_scroll_y(obj);
-    area->y2 = area->y1 + table->row_h[row] - 1;
+    area->y2 = area->y1 + (table->cell_cb ? table->virtual_row_h : table->row_h[row]) - 1;
+
+}
+
+static void free_cells(lv_table_t * table)
+{
+    if(table->cell_data) {
+        uint32_t i;
+        for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
+            lv_free(table->cell_data[i]);
+        }
+        lv_free(table->cell_data);
+        table->cell_data = NULL;
+    }
 
+    lv_free(table->row_h);
+    table->row_h = NULL;
 }
 
 static void scroll_to_selected_cell(lv_obj_t * obj)
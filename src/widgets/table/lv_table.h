@@ -27,7 +27,7 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
-#define LV_TABLE_CELL_NONE 0XFFFF
+#define LV_TABLE_CELL_NONE 0XFFFFFFFF
 LV_EXPORT_CONST_INT(LV_TABLE_CELL_NONE);
 
 /**********************
@@ -44,6 +44,16 @@ typedef enum {
     LV_TABLE_CELL_CTRL_CUSTOM_4    = 1 << 7,
 } lv_table_cell_ctrl_t;
 
+/**
+ * Called to get the text of a cell of a virtual table.
+ * The text is copied while the cell is drawn, so it can be in a buffer reused for the next cell.
+ * @param table     pointer to a table
+ * @param row       id of the row
+ * @param col       id of the column
+ * @return          text of the cell or NULL if the cell is empty
+ */
+typedef const char * (*lv_table_virtual_cell_cb_t)(lv_obj_t * table, uint32_t row, uint32_t col);
+
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_table_class;
 
 #if LV_USE_OBJ_PROPERTY
@@ -140,7 +150,20 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
  *                  and it will be freed automatically when the table is deleted or
  *                  when the cell is dropped due to lower row or column count.
  */
-void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, void * user_data);
+void lv_table_set_cell_user_data(lv_obj_t * obj, uint32_t row, uint32_t col, void * user_data);
+
+/**
+ * Make a table virtual: the cells are not stored but their texts are queried by `cell_cb`
+ * only for the rows being drawn, so the table can have a very large number of rows.
+ * Every row has the same height and the cell control bits and user data are not supported.
+ * The stored cells of the table are deleted.
+ * @param obj       pointer to a Table object
+ * @param row_cnt   number of rows. It can be changed later with `lv_table_set_row_count()`
+ * @param row_h     height of a row
+ * @param cell_cb   called to get the text of a cell. NULL to make the table normal again
+ *                  with `row_cnt` empty rows.
+ */
+void lv_table_set_virtual(lv_obj_t * obj, uint32_t row_cnt, int32_t row_h, lv_table_virtual_cell_cb_t cell_cb);
 
 /**
  * Set the selected cell
@@ -148,7 +171,7 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
  * @param row       id of the cell row to select
  * @param col       id of the cell column to select
  */
-void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col);
+void lv_table_set_selected_cell(lv_obj_t * obj, uint32_t row, uint32_t col);
 
 /*=====================
  * Getter functions
@@ -159,7 +182,7 @@ void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col);
  * @param obj       pointer to a Table object
  * @param row       id of the row [0 .. row_cnt -1]
  * @param col       id of the column [0 .. col_cnt -1]
- * @return          text in the cell
+ * @return          text in the cell. On a virtual table it's the text returned by `cell_cb`.
  */
 const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col);
 
@@ -177,6 +200,13 @@ uint32_t lv_table_get_row_count(lv_obj_t * obj);
  */
 uint32_t lv_table_get_column_count(lv_obj_t * obj);
 
+/**
+ * Tell whether a table is virtual
+ * @param obj       pointer to a Table object
+ * @return          true: the cells are queried by a callback set by `lv_table_set_virtual()`
+ */
+bool lv_table_is_virtual(lv_obj_t * obj);
+
 /**
  * Get the width of a column
  * @param obj       table pointer to a Table object
@@ -209,7 +239,7 @@ void lv_table_get_selected_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col);
  * @param row       id of the row [0 .. row_cnt -1]
  * @param col       id of the column [0 .. col_cnt -1]
  */
-void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col);
+void * lv_table_get_cell_user_data(lv_obj_t * obj, uint32_t row, uint32_t col);
 
 /**********************
  *      MACROS
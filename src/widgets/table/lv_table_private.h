@@ -44,6 +44,8 @@ struct _lv_table_t {
     int32_t * col_w;
     uint32_t col_act;
     uint32_t row_act;
+    lv_table_virtual_cell_cb_t cell_cb; /**< Returns the text of a cell. NULL if not virtual*/
+    int32_t virtual_row_h;              /**< Height of the rows of a virtual table*/
 };
 
 
@@ -35,6 +35,7 @@ test_options = {
     'OPTIONS_TEST_DEFHEAP': 'Test config, LVGL heap, 32 bit color depth',
     'OPTIONS_TEST_VG_LITE': 'VG-Lite simulator with full config, 32 bit color depth',
     'OPTIONS_TEST_RISCV_V': 'RISC-V Vector emulation with full config, 32 bit color depth',
+    'OPTIONS_TEST_X86': 'x86 SSE2/AVX2 blending with full config, 32 bit color depth',
 }
 
 
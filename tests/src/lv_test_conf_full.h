@@ -2,7 +2,11 @@
 #define LV_TEST_CONF_FULL_H
 
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
-#define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_USE_MEM_SLAB                 1
+#define LV_DRAW_ARENA_SIZE              (128 * 1024)
+#define LV_REFR_OCCLUDER_MAX            8
+#define LV_DRAW_SW_SHADOW_CACHE_SIZE    64
+#define LV_DRAW_SW_SHADOW_CACHE_CNT     4
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
@@ -12,6 +16,12 @@
 #define LV_USE_ASSERT_MEM_INTEGRITY     1
 #define LV_USE_ASSERT_OBJ               1
 #define LV_USE_ASSERT_STYLE             1
+#define LV_STYLE_PROP_INDEX             1
+#define LV_OBJ_STYLE_RESOLVED_CACHE_CNT 64
+#define LV_OBJ_STYLE_INLINE_CNT         2
+#define LV_OBJ_ATTR_POOL_BLOCK_CNT      32
+#define LV_OBJ_CLASS_ALLOC_STAT         1
+#define LV_OBJ_EVENT_DISPATCH_STAT      1
 #define LV_USE_FLOAT      1
 #define LV_USE_MATRIX     1
 
@@ -112,6 +122,7 @@
 #define LV_USE_PROFILER         1
 #define LV_PROFILER_INCLUDE     "lv_profiler_builtin.h"
 #define LV_USE_PROFILER_BUILTIN_POSIX 1
+#define LV_USE_PROFILER_TIMELINE 1
 #define LV_USE_GRIDNAV          1
 #define LV_USE_XML              1
 #define LV_USE_TRANSLATION      1
@@ -205,6 +216,7 @@
 #define LV_USE_FONT_MANAGER 1
 
 #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    1
+#define LV_DRAW_SW_GRADIENT_CACHE_SIZE      (16 * 1024)
 
 #define LV_USE_GESTURE_RECOGNITION 1
 
@@ -0,0 +1,127 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    lv_draw_arena_reset_stat();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_DRAW_ARENA_SIZE
+
+#define arena LV_GLOBAL_DEFAULT()->draw_info.arena
+
+void test_draw_arena_refresh(void)
+{
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_pos(obj, i * 40, i * 20);
+        lv_obj_set_style_shadow_width(obj, 20, 0);
+        lv_obj_set_style_radius(obj, 10, 0);
+        lv_obj_set_style_transform_rotation(obj, i * 100, 0);
+    }
+    lv_refr_now(NULL);
+
+    lv_draw_arena_stat_t stat;
+    lv_draw_arena_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_ARENA_SIZE, stat.size);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.used_max);
+
+    /*Everything is given back after the refresh*/
+    TEST_ASSERT_EQUAL_UINT32(0, arena.used);
+    TEST_ASSERT_EQUAL_UINT32(0, arena.alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, arena.refr_depth);
+}
+
+void test_draw_arena_outside_refresh(void)
+{
+    void * p = lv_draw_arena_malloc(100);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_FALSE(lv_draw_arena_contains(p));
+    lv_draw_arena_free(p);
+
+    TEST_ASSERT_NULL(lv_draw_arena_alloc(100));
+}
+
+void test_draw_arena_free_order(void)
+{
+    lv_draw_arena_refr_begin();
+
+    uint8_t * p1 = lv_draw_arena_malloc(10);
+    uint32_t used1 = arena.used;
+    uint8_t * p2 = lv_draw_arena_malloc(20);
+    uint8_t * p3 = lv_draw_arena_malloc(30);
+    TEST_ASSERT_TRUE(lv_draw_arena_contains(p1));
+    TEST_ASSERT_TRUE(lv_draw_arena_contains(p3));
+    TEST_ASSERT_EQUAL_UINT32(0, (lv_uintptr_t)p2 % 8);
+    TEST_ASSERT_LESS_THAN(p3, p2);
+    lv_memset(p1, 0x11, 10);
+    lv_memset(p2, 0x22, 20);
+    lv_memset(p3, 0x33, 30);
+
+    /*Not the last one so it remains in the arena*/
+    uint32_t used3 = arena.used;
+    lv_draw_arena_free(p2);
+    TEST_ASSERT_EQUAL_UINT32(used3, arena.used);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0x33, p3, 30);
+
+    /*The last one and the freed ones before it are given back*/
+    lv_draw_arena_free(p3);
+    TEST_ASSERT_EQUAL_UINT32(used1, arena.used);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0x11, p1, 10);
+
+    /*The space is reused*/
+    TEST_ASSERT_EQUAL_PTR(p2, lv_draw_arena_malloc(40));
+    TEST_ASSERT_EQUAL_UINT32(2, arena.alloc_cnt);
+
+    lv_draw_arena_refr_end();
+
+    /*Reset only if everything is freed*/
+    TEST_ASSERT_NOT_EQUAL(0, arena.used);
+    lv_draw_arena_refr_begin();
+    lv_draw_arena_free(p2);
+    lv_draw_arena_free(p1);
+    lv_draw_arena_refr_end();
+    TEST_ASSERT_EQUAL_UINT32(0, arena.used);
+    TEST_ASSERT_NULL(arena.last);
+}
+
+void test_draw_arena_overflow(void)
+{
+    lv_draw_arena_refr_begin();
+
+    uint8_t * p1 = lv_draw_arena_malloc(LV_DRAW_ARENA_SIZE / 2);
+    uint8_t * p2 = lv_draw_arena_malloc(LV_DRAW_ARENA_SIZE / 2);
+    uint8_t * p3 = lv_draw_arena_malloc(100);
+    TEST_ASSERT_TRUE(lv_draw_arena_contains(p1));
+    TEST_ASSERT_FALSE(lv_draw_arena_contains(p2));
+    TEST_ASSERT_TRUE(lv_draw_arena_contains(p3));
+
+    lv_draw_arena_free(p3);
+    lv_draw_arena_free(p2);
+    lv_draw_arena_free(p1);
+    lv_draw_arena_refr_end();
+
+    lv_draw_arena_stat_t stat;
+    lv_draw_arena_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.overflow_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_ARENA_SIZE / 2, stat.overflow_size_max);
+    TEST_ASSERT_GREATER_THAN_UINT32(LV_DRAW_ARENA_SIZE / 2, stat.used_max);
+
+    lv_draw_arena_reset_stat();
+    lv_draw_arena_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.overflow_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.used_max);
+}
+
+#endif
+
+#endif
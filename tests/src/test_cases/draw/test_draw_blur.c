@@ -119,4 +119,68 @@ void test_blur(void)
     }
 }
 
+#define LARGE_CANVAS_WIDTH 240
+#define LARGE_CANVAS_HEIGHT 190
+
+static void large_canvas_render(const char * name_sub, lv_color_format_t cf, void * canvas_buf)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_buffer(canvas, canvas_buf, LARGE_CANVAS_WIDTH, LARGE_CANVAS_HEIGHT, cf);
+    lv_canvas_fill_bg(canvas, lv_color_hex3(0xccc), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    /*A grid in the background*/
+    lv_draw_fill_dsc_t fill_dsc;
+    lv_draw_fill_dsc_init(&fill_dsc);
+    int32_t i;
+    for(i = 0; i < 8; i++) {
+        fill_dsc.color = lv_palette_main(i * 2);
+        lv_area_t stripe_coords = {i * 30, 0, i * 30 + 14, LARGE_CANVAS_HEIGHT - 1};
+        lv_draw_fill(&layer, &fill_dsc, &stripe_coords);
+    }
+
+    fill_dsc.color = lv_color_black();
+    fill_dsc.opa = LV_OPA_50;
+    for(i = 0; i < 6; i++) {
+        lv_area_t stripe_coords = {0, i * 32, LARGE_CANVAS_WIDTH - 1, i * 32 + 11};
+        lv_draw_fill(&layer, &fill_dsc, &stripe_coords);
+    }
+
+    /*Large enough to skip some pixels while blurring*/
+    lv_draw_blur_dsc_t blur_dsc;
+    lv_draw_blur_dsc_init(&blur_dsc);
+    blur_dsc.blur_radius = 40;
+
+    lv_area_t blur_coords = {10, 10, LARGE_CANVAS_WIDTH - 11, LARGE_CANVAS_HEIGHT - 11};
+    lv_draw_blur(&layer, &blur_dsc, &blur_coords);
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.color = lv_color_black();
+    label_dsc.font = &lv_font_montserrat_14;
+    label_dsc.align = LV_TEXT_ALIGN_CENTER;
+    label_dsc.text = name_sub;
+
+    lv_area_t label_coords = {0, 80, LARGE_CANVAS_WIDTH - 1, 100};
+    lv_draw_label(&layer, &label_dsc, &label_coords);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_blur_large(void)
+{
+    static LV_ATTRIBUTE_MEM_ALIGN uint8_t canvas_buf[5][LV_TEST_WIDTH_TO_STRIDE(LARGE_CANVAS_WIDTH,
+                                                                                4) * LARGE_CANVAS_HEIGHT + LV_DRAW_BUF_ALIGN];
+
+    large_canvas_render("l8", LV_COLOR_FORMAT_L8, canvas_buf[0]);
+    large_canvas_render("rgb565", LV_COLOR_FORMAT_RGB565, canvas_buf[1]);
+    large_canvas_render("rgb888", LV_COLOR_FORMAT_RGB888, canvas_buf[2]);
+    large_canvas_render("xrgb8888", LV_COLOR_FORMAT_XRGB8888, canvas_buf[3]);
+    large_canvas_render("argb8888", LV_COLOR_FORMAT_ARGB8888, canvas_buf[4]);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/draw_blur_large.png");
+}
+
 #endif
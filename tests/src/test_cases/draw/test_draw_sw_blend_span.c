@@ -0,0 +1,123 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define LINE_W 100
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static void init_line_mask(lv_opa_t * mask)
+{
+    int32_t x;
+    for(x = 0; x < LINE_W; x++) {
+        if(x < 10) mask[x] = x * 25;                /*Partial*/
+        else if(x < 40) mask[x] = LV_OPA_COVER;     /*Long covered span*/
+        else if(x < 45) mask[x] = 50 + x;           /*Partial*/
+        else if(x < 80) mask[x] = LV_OPA_TRANSP;    /*Long transparent span*/
+        else if(x < 85) mask[x] = LV_OPA_COVER;     /*Short covered span*/
+        else mask[x] = 255 - x;                     /*Partial*/
+    }
+}
+
+static void init_bg(lv_draw_buf_t * buf)
+{
+    uint32_t i;
+    uint8_t * data = buf->data;
+    for(i = 0; i < buf->data_size; i++) {
+        data[i] = (i * 37) & 0xff;
+        /*Every 3rd pixel is transparent*/
+        if(buf->header.cf == LV_COLOR_FORMAT_ARGB8888 && (i % 12) == 3) data[i] = 0;
+        /*The X byte is always 0xFF*/
+        if(buf->header.cf == LV_COLOR_FORMAT_XRGB8888 && (i % 4) == 3) data[i] = 0xff;
+    }
+}
+
+static void blend_line(lv_draw_buf_t * buf, const lv_opa_t * mask, lv_opa_t opa, bool px_by_px)
+{
+    lv_layer_t layer;
+    lv_memzero(&layer, sizeof(layer));
+    layer.draw_buf = buf;
+    layer.color_format = buf->header.cf;
+    lv_area_set(&layer.buf_area, 0, 0, LINE_W - 1, 0);
+
+    lv_draw_task_t t;
+    lv_memzero(&t, sizeof(t));
+    t.target_layer = &layer;
+    t.clip_area = layer.buf_area;
+
+    lv_draw_sw_blend_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.color = lv_color_hex(0x2080c0);
+    dsc.opa = opa;
+    dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+
+    if(px_by_px) {
+        /*1 px wide lines can't have spans*/
+        int32_t x;
+        for(x = 0; x < LINE_W; x++) {
+            lv_area_t area;
+            lv_area_set(&area, x, 0, x, 0);
+            dsc.blend_area = &area;
+            dsc.mask_area = &area;
+            dsc.mask_buf = &mask[x];
+            lv_draw_sw_blend(&t, &dsc);
+        }
+    }
+    else {
+        dsc.blend_area = &layer.buf_area;
+        dsc.mask_area = &layer.buf_area;
+        dsc.mask_buf = mask;
+        lv_draw_sw_blend(&t, &dsc);
+    }
+}
+
+void test_draw_sw_blend_span_same_result(void)
+{
+    static const lv_color_format_t cfs[] = {
+        LV_COLOR_FORMAT_RGB565,
+        LV_COLOR_FORMAT_RGB565_SWAPPED,
+        LV_COLOR_FORMAT_RGB888,
+        LV_COLOR_FORMAT_XRGB8888,
+        LV_COLOR_FORMAT_ARGB8888,
+        LV_COLOR_FORMAT_L8,
+        LV_COLOR_FORMAT_A8,
+        LV_COLOR_FORMAT_AL88,
+    };
+    static const lv_opa_t opas[] = {LV_OPA_COVER, LV_OPA_60};
+
+    lv_opa_t mask[LINE_W];
+    init_line_mask(mask);
+
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        for(j = 0; j < sizeof(opas) / sizeof(opas[0]); j++) {
+            lv_draw_buf_t * buf_span = lv_draw_buf_create(LINE_W, 1, cfs[i], LV_STRIDE_AUTO);
+            lv_draw_buf_t * buf_px = lv_draw_buf_create(LINE_W, 1, cfs[i], LV_STRIDE_AUTO);
+            init_bg(buf_span);
+            init_bg(buf_px);
+
+            blend_line(buf_span, mask, opas[j], false);
+            blend_line(buf_px, mask, opas[j], true);
+
+            char msg[64];
+            lv_snprintf(msg, sizeof(msg), "color format: %d, opa: %d", cfs[i], opas[j]);
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(buf_px->data, buf_span->data, buf_px->data_size, msg);
+
+            lv_draw_buf_destroy(buf_span);
+            lv_draw_buf_destroy(buf_px);
+        }
+    }
+}
+
+#endif
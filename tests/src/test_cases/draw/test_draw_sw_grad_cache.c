@@ -0,0 +1,137 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "../../../src/draw/sw/lv_draw_sw_grad.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+
+#define grad_cache LV_GLOBAL_DEFAULT()->sw_grad_cache
+
+static void init_grad(lv_grad_dsc_t * grad, lv_color_t c1, lv_color_t c2, lv_grad_dir_t dir)
+{
+    static const lv_opa_t opas[] = {LV_OPA_COVER, LV_OPA_50};
+    static const uint8_t fracs[] = {20, 200};
+    lv_color_t colors[] = {c1, c2};
+    lv_memzero(grad, sizeof(lv_grad_dsc_t));
+    lv_grad_init_stops(grad, colors, opas, fracs, 2);
+    grad->dir = dir;
+}
+
+void test_draw_sw_grad_cache_hit(void)
+{
+    lv_cache_drop_all(grad_cache, NULL);
+
+    lv_grad_dsc_t grad;
+    init_grad(&grad, lv_palette_main(LV_PALETTE_RED), lv_palette_main(LV_PALETTE_BLUE), LV_GRAD_DIR_HOR);
+
+    lv_draw_sw_grad_calc_t * calc1 = lv_draw_sw_grad_get(&grad, 100, 50);
+    TEST_ASSERT_NOT_NULL(calc1);
+    TEST_ASSERT_NOT_NULL(calc1->cache_entry);
+    TEST_ASSERT_EQUAL_UINT32(100, calc1->size);
+    TEST_ASSERT_GREATER_THAN(0, lv_cache_get_size(grad_cache, NULL));
+
+    uint32_t i;
+    for(i = 0; i < calc1->size; i++) {
+        lv_color_t c;
+        lv_opa_t opa;
+        lv_draw_sw_grad_color_calculate(&grad, 100, i, &c, &opa);
+        TEST_ASSERT_TRUE(lv_color_eq(c, calc1->color_map[i]));
+        TEST_ASSERT_EQUAL_UINT8(opa, calc1->opa_map[i]);
+    }
+
+    /*A vertical gradient with the same stops and size uses the same map*/
+    grad.dir = LV_GRAD_DIR_VER;
+    lv_draw_sw_grad_calc_t * calc2 = lv_draw_sw_grad_get(&grad, 50, 100);
+    TEST_ASSERT_EQUAL_PTR(calc1, calc2);
+
+    /*Other stops need a new map*/
+    grad.stops[1].frac = 210;
+    lv_draw_sw_grad_calc_t * calc3 = lv_draw_sw_grad_get(&grad, 50, 100);
+    TEST_ASSERT_NOT_EQUAL(calc1, calc3);
+
+    lv_draw_sw_grad_cleanup(calc1);
+    lv_draw_sw_grad_cleanup(calc2);
+    lv_draw_sw_grad_cleanup(calc3);
+}
+
+void test_draw_sw_grad_cache_not_cached(void)
+{
+    lv_grad_dsc_t grad;
+    init_grad(&grad, lv_palette_main(LV_PALETTE_GREEN), lv_palette_main(LV_PALETTE_BLUE), LV_GRAD_DIR_HOR);
+
+    /*Too large for the cache*/
+    lv_draw_sw_grad_calc_t * calc = lv_draw_sw_grad_get(&grad, LV_DRAW_SW_GRADIENT_CACHE_SIZE, 10);
+    TEST_ASSERT_NOT_NULL(calc);
+    TEST_ASSERT_NULL(calc->cache_entry);
+    lv_draw_sw_grad_cleanup(calc);
+
+#if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
+    /*The buffer of the complex gradients is written while drawing*/
+    grad.dir = LV_GRAD_DIR_LINEAR;
+    calc = lv_draw_sw_grad_get(&grad, 100, 10);
+    TEST_ASSERT_NOT_NULL(calc);
+    TEST_ASSERT_NULL(calc->cache_entry);
+    lv_draw_sw_grad_cleanup(calc);
+#endif
+}
+
+void test_draw_sw_grad_cache_budget(void)
+{
+    lv_cache_drop_all(grad_cache, NULL);
+
+    lv_grad_dsc_t grad;
+    init_grad(&grad, lv_palette_main(LV_PALETTE_RED), lv_palette_main(LV_PALETTE_BLUE), LV_GRAD_DIR_VER);
+
+    /*Many different gradients: the old ones are evicted*/
+    uint32_t i;
+    for(i = 0; i < 64; i++) {
+        grad.stops[0].frac = i;
+        lv_draw_sw_grad_calc_t * calc = lv_draw_sw_grad_get(&grad, 10, 400);
+        TEST_ASSERT_NOT_NULL(calc);
+        TEST_ASSERT_NOT_NULL(calc->cache_entry);
+        lv_draw_sw_grad_cleanup(calc);
+        TEST_ASSERT_LESS_OR_EQUAL(LV_DRAW_SW_GRADIENT_CACHE_SIZE, lv_cache_get_size(grad_cache, NULL));
+    }
+}
+
+void test_draw_sw_grad_cache_render(void)
+{
+    lv_cache_drop_all(grad_cache, NULL);
+
+    static lv_grad_dsc_t grad;
+    init_grad(&grad, lv_palette_main(LV_PALETTE_RED), lv_palette_main(LV_PALETTE_BLUE), LV_GRAD_DIR_HOR);
+
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(obj, 100, 60);
+        lv_obj_set_pos(obj, (i % 4) * 120, (i / 4) * 100);
+        lv_obj_set_style_bg_grad(obj, &grad, 0);
+    }
+    lv_refr_now(NULL);
+
+    /*All the objects have the same size and gradient so only one map is created*/
+    size_t size = lv_cache_get_size(grad_cache, NULL);
+    TEST_ASSERT_GREATER_THAN(0, size);
+    TEST_ASSERT_LESS_THAN(2 * (100 * 4), size);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(size, lv_cache_get_size(grad_cache, NULL));
+}
+
+#endif
+
+#endif
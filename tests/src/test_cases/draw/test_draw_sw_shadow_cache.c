@@ -0,0 +1,148 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    lv_draw_sw_shadow_cache_drop_all();
+    lv_draw_sw_shadow_cache_reset_stat();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+
+static lv_obj_t * create_card(int32_t x, int32_t y, int32_t shadow_width, int32_t radius)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, 100, 80);
+    lv_obj_set_style_radius(obj, radius, 0);
+    lv_obj_set_style_shadow_width(obj, shadow_width, 0);
+    return obj;
+}
+
+void test_draw_sw_shadow_cache_reuse(void)
+{
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        create_card(20 + i * 150, 20, 20, 10);
+    }
+    lv_refr_now(NULL);
+
+    /*All the cards have the same corner*/
+    lv_draw_sw_shadow_cache_stat_t stat;
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(3, stat.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(30 * 30, stat.size);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_CNT,
+                             stat.max_size);
+}
+
+void test_draw_sw_shadow_cache_multiple_styles(void)
+{
+    create_card(20, 20, 20, 10);
+    create_card(200, 20, 10, 5);
+    create_card(400, 20, 30, 0);
+    lv_refr_now(NULL);
+
+    lv_draw_sw_shadow_cache_stat_t stat;
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(3, stat.miss_cnt);
+
+    /*The next frames use the cached corners of all the styles*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(3, stat.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(6, stat.hit_cnt);
+}
+
+void test_draw_sw_shadow_cache_not_cached(void)
+{
+    /*Too large corner*/
+    create_card(20, 20, LV_DRAW_SW_SHADOW_CACHE_SIZE, 10);
+    lv_refr_now(NULL);
+
+    lv_draw_sw_shadow_cache_stat_t stat;
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.size);
+}
+
+void test_draw_sw_shadow_cache_small_obj(void)
+{
+    /*The corner of a small object is different even if the shadow width and radius are the same*/
+    create_card(20, 20, 20, 4);
+    lv_obj_t * small = create_card(300, 20, 20, 4);
+    lv_obj_set_size(small, 12, 12);
+    lv_refr_now(NULL);
+
+    lv_draw_sw_shadow_cache_stat_t stat;
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.miss_cnt);
+}
+
+void test_draw_sw_shadow_cache_budget(void)
+{
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        create_card((i % 5) * 150 + 20, (i / 5) * 110 + 20, 10 + i * 2, 10);
+    }
+    lv_refr_now(NULL);
+
+    lv_draw_sw_shadow_cache_stat_t stat;
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(stat.max_size, stat.size);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.size);
+}
+
+static void draw_shadow_to_canvas(lv_obj_t * canvas)
+{
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.radius = 8;
+    dsc.shadow_width = 16;
+    dsc.shadow_spread = 2;
+    dsc.shadow_offset_x = 3;
+    lv_area_t area = {20, 20, 60, 50};
+    lv_draw_rect(&layer, &dsc, &area);
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_draw_sw_shadow_cache_same_result(void)
+{
+    LV_DRAW_BUF_DEFINE_STATIC(buf1, 80, 80, LV_COLOR_FORMAT_ARGB8888);
+    LV_DRAW_BUF_DEFINE_STATIC(buf2, 80, 80, LV_COLOR_FORMAT_ARGB8888);
+    LV_DRAW_BUF_INIT_STATIC(buf1);
+    LV_DRAW_BUF_INIT_STATIC(buf2);
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+
+    lv_canvas_set_draw_buf(canvas, &buf1);
+    draw_shadow_to_canvas(canvas);
+    lv_canvas_set_draw_buf(canvas, &buf2);
+    draw_shadow_to_canvas(canvas);
+
+    lv_draw_sw_shadow_cache_stat_t stat;
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.hit_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(buf1.data, buf2.data, buf1.data_size);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,155 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define TASK_CNT        400
+#define TEST_UNIT_ID    7
+
+static lv_layer_t layer;
+static uint32_t rnd_seed;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    rnd_seed = 0x1234;
+    lv_layer_init(&layer);
+    lv_area_set(&layer.buf_area, 0, 0, 799, 479);
+    layer._clip_area = layer.buf_area;
+    layer.phy_clip_area = layer.buf_area;
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+    TEST_ASSERT_NULL(layer.task_index);
+}
+
+static int32_t rnd(int32_t min, int32_t max)
+{
+    rnd_seed = rnd_seed * 1103515245 + 12345;
+    return min + (int32_t)((rnd_seed >> 8) % (uint32_t)(max - min + 1));
+}
+
+static void add_tasks(uint32_t cnt)
+{
+    lv_draw_fill_dsc_t dsc;
+    lv_draw_fill_dsc_init(&dsc);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        /*Mostly small tasks, some large ones and some outside of the layer.
+         *The first task is small, as a screen sized first task would disable the search.*/
+        int32_t size_max = (rnd(0, 9) == 0 && layer.draw_task_head) ? 1000 : 40;
+        lv_area_t a;
+        a.x1 = rnd(-100, 850);
+        a.y1 = rnd(-100, 550);
+        a.x2 = a.x1 + rnd(0, size_max);
+        a.y2 = a.y1 + rnd(0, size_max);
+        lv_draw_fill(&layer, &dsc, &a);
+    }
+
+    /*Keep the draw tasks for the test draw unit only*/
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->preferred_draw_unit_id = TEST_UNIT_ID;
+        t = t->next;
+    }
+}
+
+static void randomize_states(void)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        int32_t r = rnd(0, 9);
+        if(r == 0) t->state = LV_DRAW_TASK_STATE_FINISHED;
+        else if(r == 1) t->state = LV_DRAW_TASK_STATE_QUEUED;
+        else if(r == 2) {
+            t->state = LV_DRAW_TASK_STATE_QUEUED;
+            t->preferred_draw_unit_id = TEST_UNIT_ID + 1;
+        }
+        else t->state = LV_DRAW_TASK_STATE_WAITING;
+        t = t->next;
+    }
+}
+
+/*Reference implementation: compare with all the older draw tasks*/
+static bool is_independent_ref(lv_draw_task_t * t_check, uint8_t unit_id)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t != t_check) {
+        if(t->state != LV_DRAW_TASK_STATE_FINISHED &&
+           !(t->state == LV_DRAW_TASK_STATE_QUEUED && t->preferred_draw_unit_id == unit_id)) {
+            lv_area_t a;
+            if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) return false;
+        }
+        t = t->next;
+    }
+    return true;
+}
+
+static void check_available_tasks(void)
+{
+    lv_draw_task_t * t_ref = layer.draw_task_head;
+    lv_draw_task_t * t = lv_draw_get_next_available_task(&layer, NULL, TEST_UNIT_ID);
+    uint32_t found_cnt = 0;
+    while(t_ref) {
+        if(t_ref->state == LV_DRAW_TASK_STATE_WAITING && t_ref->preferred_draw_unit_id == TEST_UNIT_ID &&
+           is_independent_ref(t_ref, TEST_UNIT_ID)) {
+            TEST_ASSERT_EQUAL_PTR(t_ref, t);
+            t = lv_draw_get_next_available_task(&layer, t, TEST_UNIT_ID);
+            found_cnt++;
+        }
+        t_ref = t_ref->next;
+    }
+    TEST_ASSERT_NULL(t);
+    TEST_ASSERT_GREATER_THAN(0, found_cnt);
+}
+
+void test_draw_task_index_matches_linear_search(void)
+{
+    add_tasks(TASK_CNT);
+    randomize_states();
+
+    check_available_tasks();
+    TEST_ASSERT_NOT_NULL(layer.task_index);
+}
+
+void test_draw_task_index_add_and_remove(void)
+{
+    add_tasks(TASK_CNT);
+    check_available_tasks();
+    TEST_ASSERT_NOT_NULL(layer.task_index);
+
+    /*New draw tasks are added to the existing index*/
+    add_tasks(TASK_CNT / 2);
+    randomize_states();
+    check_available_tasks();
+
+    /*Remove the finished tasks. Mark the others as queued so that the real draw units don't take them*/
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = rnd(0, 1) ? LV_DRAW_TASK_STATE_FINISHED : LV_DRAW_TASK_STATE_QUEUED;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+    t = layer.draw_task_head;
+    while(t) {
+        TEST_ASSERT_NOT_EQUAL(LV_DRAW_TASK_STATE_FINISHED, t->state);
+        t = t->next;
+    }
+
+    randomize_states();
+    check_available_tasks();
+}
+
+#endif
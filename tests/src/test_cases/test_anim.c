@@ -263,4 +263,117 @@ void test_anim_vsync_mode(void)
     lv_anim_delete(&var, exec_cb);
 }
 
+static lv_anim_t * anim_to_delete;
+
+static void delete_other_exec_cb(void * var, int32_t v)
+{
+    exec_cb(var, v);
+    if(anim_to_delete) {
+        lv_anim_delete(anim_to_delete->var, NULL);
+        anim_to_delete = NULL;
+    }
+}
+
+static void opa_exec_cb(void * var, int32_t v)
+{
+    lv_obj_set_style_opa(var, v, 0);
+}
+
+void test_anim_grouped_by_var(void)
+{
+    int32_t var1;
+    int32_t var2;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_duration(&a, 100);
+
+    lv_anim_set_var(&a, &var1);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_start(&a);
+    lv_anim_set_var(&a, &var2);
+    lv_anim_start(&a);
+    lv_anim_set_var(&a, &var1);
+    lv_anim_set_custom_exec_cb(&a, custom_exec_cb);
+    lv_anim_set_exec_cb(&a, NULL);
+    lv_anim_start(&a);
+
+    /*The animations of `var1` are next to each other*/
+    lv_anim_t * anim = lv_ll_get_head(&LV_GLOBAL_DEFAULT()->anim_state.anim_ll);
+    TEST_ASSERT_EQUAL_PTR(&var2, anim->var);
+    anim = lv_ll_get_next(&LV_GLOBAL_DEFAULT()->anim_state.anim_ll, anim);
+    TEST_ASSERT_EQUAL_PTR(&var1, anim->var);
+    anim = lv_ll_get_next(&LV_GLOBAL_DEFAULT()->anim_state.anim_ll, anim);
+    TEST_ASSERT_EQUAL_PTR(&var1, anim->var);
+
+    lv_test_wait(50);
+    TEST_ASSERT_EQUAL(50, var1);
+    TEST_ASSERT_EQUAL(50, var2);
+}
+
+void test_anim_delete_other_in_exec_cb(void)
+{
+    int32_t var1 = 0;
+    int32_t var2 = 0;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_set_early_apply(&a, false);
+
+    lv_anim_set_var(&a, &var2);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    anim_to_delete = lv_anim_start(&a);
+
+    /*Started later so it's applied first*/
+    lv_anim_set_var(&a, &var1);
+    lv_anim_set_exec_cb(&a, delete_other_exec_cb);
+    lv_anim_start(&a);
+
+    /*The value of the second animation was already calculated, but it's not applied*/
+    lv_test_wait(20);
+    TEST_ASSERT_NULL(anim_to_delete);
+    TEST_ASSERT_EQUAL(19, var1);
+    TEST_ASSERT_EQUAL(0, var2);
+    TEST_ASSERT_NULL(lv_anim_get(&var2, NULL));
+}
+
+void test_anim_many_widgets(void)
+{
+    lv_obj_t * objs[100];
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        objs[i] = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(objs[i], 20, 20);
+
+        /*Animate 3 properties of every widget*/
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, objs[i]);
+        lv_anim_set_duration(&a, 200 + i);
+        lv_anim_set_values(&a, 0, i);
+        lv_anim_set_exec_cb(&a, (lv_anim_exec_xcb_t)lv_obj_set_x);
+        lv_anim_start(&a);
+        lv_anim_set_exec_cb(&a, (lv_anim_exec_xcb_t)lv_obj_set_y);
+        lv_anim_start(&a);
+        lv_anim_set_values(&a, LV_OPA_TRANSP, LV_OPA_COVER);
+        lv_anim_set_exec_cb(&a, opa_exec_cb);
+        lv_anim_start(&a);
+    }
+
+    for(i = 0; i < 20; i++) {
+        lv_test_wait(20);
+        lv_refr_now(NULL);
+    }
+
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+    for(i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL_INT32(i, lv_obj_get_x(objs[i]));
+        TEST_ASSERT_EQUAL_INT32(i, lv_obj_get_y(objs[i]));
+        TEST_ASSERT_EQUAL_UINT8(LV_OPA_COVER, lv_obj_get_style_opa(objs[i], 0));
+    }
+}
+
 #endif
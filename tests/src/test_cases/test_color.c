@@ -121,6 +121,38 @@ void test_color_to_u32(void)
     TEST_ASSERT_EQUAL_UINT32(0xFF7B2D43, lv_color_to_u32(test_color_random));
 }
 
+void test_color_mix32(void)
+{
+    lv_color32_t fg = { .red = 200, .green = 100, .blue = 0, .alpha = 128 };
+    lv_color32_t bg = { .red = 0, .green = 100, .blue = 200, .alpha = 77 };
+
+    lv_color32_t res = lv_color_mix32(fg, bg);
+    TEST_ASSERT_EQUAL_UINT8(100, res.red);
+    TEST_ASSERT_EQUAL_UINT8(100, res.green);
+    TEST_ASSERT_EQUAL_UINT8(99, res.blue);
+    TEST_ASSERT_EQUAL_UINT8(77, res.alpha);
+
+    /*Opaque foreground: keep the alpha of the background*/
+    fg.alpha = LV_OPA_COVER;
+    res = lv_color_mix32(fg, bg);
+    fg.alpha = bg.alpha;
+    TEST_ASSERT_TRUE(lv_color32_eq(fg, res));
+
+    /*Transparent foreground*/
+    fg.alpha = LV_OPA_TRANSP;
+    res = lv_color_mix32(fg, bg);
+    TEST_ASSERT_TRUE(lv_color32_eq(bg, res));
+    TEST_ASSERT_FALSE(lv_color32_eq(fg, res));
+}
+
+void test_color_16_16_mix(void)
+{
+    TEST_ASSERT_EQUAL_HEX16(0x780F, lv_color_16_16_mix(0xF800, 0x001F, LV_OPA_50));
+    TEST_ASSERT_EQUAL_HEX16(0xBFF7, lv_color_16_16_mix(0x07E0, 0xFFFF, 64));
+    TEST_ASSERT_EQUAL_HEX16(0xF800, lv_color_16_16_mix(0xF800, 0x001F, LV_OPA_COVER));
+    TEST_ASSERT_EQUAL_HEX16(0x001F, lv_color_16_16_mix(0xF800, 0x001F, LV_OPA_TRANSP));
+}
+
 void test_color_lighten(void)
 {
     /*Test basic color lighten*/
@@ -464,6 +464,160 @@ void test_display_dpi_tile_cnt_antialiasing(void)
     lv_display_delete(disp);
 }
 
+static uint32_t layer_init_cnt;
+
+static void count_layer_init_cb(lv_display_t * disp, lv_layer_t * layer)
+{
+    LV_UNUSED(disp);
+    LV_UNUSED(layer);
+    layer_init_cnt++;
+}
+
+void test_display_tile_mode(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    TEST_ASSERT_EQUAL(LV_DISPLAY_TILE_MODE_AUTO, lv_display_get_tile_mode(disp));
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 100, 100);
+    lv_refr_now(NULL);
+
+    uint32_t tile_cnt_ori = lv_display_get_tile_cnt(disp);
+    lv_display_set_tile_cnt(disp, 4);
+    void (*layer_init_ori)(lv_display_t *, lv_layer_t *) = disp->layer_init;
+    disp->layer_init = count_layer_init_cb;
+
+    /*Small areas are not divided in auto mode*/
+    layer_init_cnt = 0;
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, layer_init_cnt);
+
+    /*Always use the set number of tiles*/
+    lv_display_set_tile_mode(NULL, LV_DISPLAY_TILE_MODE_ALWAYS);
+    TEST_ASSERT_EQUAL(LV_DISPLAY_TILE_MODE_ALWAYS, lv_display_get_tile_mode(NULL));
+    layer_init_cnt = 0;
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, layer_init_cnt);
+
+    /*Thin areas are not divided*/
+    lv_area_t a;
+    lv_area_set(&a, 0, 0, 99, 9);
+    layer_init_cnt = 0;
+    lv_obj_invalidate_area(lv_screen_active(), &a);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, layer_init_cnt);
+
+    disp->layer_init = layer_init_ori;
+    lv_display_set_tile_cnt(disp, tile_cnt_ori);
+    lv_display_set_tile_mode(disp, LV_DISPLAY_TILE_MODE_AUTO);
+}
+
+static uint32_t flush_cnt;
+
+static void count_flush_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    flush_cnt++;
+}
+
+void test_display_inv_area_join_and_overflow(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_refr_now(NULL);
+    lv_display_add_event_cb(disp, count_flush_event_cb, LV_EVENT_FLUSH_START, NULL);
+
+    /*Close small areas are cheaper to refresh together*/
+    lv_area_t a;
+    lv_area_set(&a, 10, 10, 19, 19);
+    lv_inv_area(disp, &a);
+    lv_area_set(&a, 22, 10, 31, 19);
+    lv_inv_area(disp, &a);
+    flush_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+
+    /*Distant areas are refreshed one by one, even if there are more than LV_INV_BUF_SIZE*/
+    uint32_t i;
+    for(i = 0; i < 60; i++) {
+        lv_area_set(&a, (i % 10) * 80, (i / 10) * 80, (i % 10) * 80 + 29, (i / 10) * 80 + 29);
+        lv_inv_area(disp, &a);
+    }
+    TEST_ASSERT_EQUAL_UINT32(60, disp->inv_p);
+    flush_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(60, flush_cnt);
+
+    /*Above LV_INV_BUF_SIZE_MAX the new areas are joined to the existing ones instead of refreshing the screen*/
+    for(i = 0; i < LV_INV_BUF_SIZE_MAX + 10; i++) {
+        lv_area_set(&a, (i % 20) * 40, (i / 20) * 30, (i % 20) * 40, (i / 20) * 30);
+        lv_inv_area(disp, &a);
+    }
+    TEST_ASSERT_EQUAL_UINT32(LV_INV_BUF_SIZE_MAX, disp->inv_p);
+    uint32_t size_sum = 0;
+    for(i = 0; i < disp->inv_p; i++) {
+        size_sum += lv_area_get_size(&disp->inv_areas[i]);
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(1000, size_sum);
+    lv_refr_now(NULL);
+
+    lv_display_remove_event_cb_with_user_data(disp, count_flush_event_cb, NULL);
+}
+
+void test_display_occlusion_culling(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+
+    /*Fully hidden by `cover`*/
+    lv_obj_t * hidden = lv_obj_create(scr);
+    lv_obj_remove_style_all(hidden);
+    lv_obj_set_style_bg_opa(hidden, LV_OPA_COVER, 0);
+    lv_obj_set_pos(hidden, 10, 10);
+    lv_obj_set_size(hidden, 100, 100);
+
+    /*Partially visible*/
+    lv_obj_t * partly = lv_obj_create(scr);
+    lv_obj_remove_style_all(partly);
+    lv_obj_set_style_bg_opa(partly, LV_OPA_COVER, 0);
+    lv_obj_set_pos(partly, 150, 150);
+    lv_obj_set_size(partly, 100, 100);
+
+    lv_obj_t * cover = lv_obj_create(scr);
+    lv_obj_remove_style_all(cover);
+    lv_obj_set_style_bg_opa(cover, LV_OPA_COVER, 0);
+    lv_obj_set_size(cover, 200, 200);
+
+    /*Children are in front of their parent, so they don't hide it*/
+    lv_obj_t * child = lv_obj_create(cover);
+    lv_obj_remove_style_all(child);
+    lv_obj_set_style_bg_opa(child, LV_OPA_COVER, 0);
+    lv_obj_set_size(child, LV_PCT(100), LV_PCT(100));
+
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_FALSE(hidden->rendered);
+    TEST_ASSERT_TRUE(partly->rendered);
+    TEST_ASSERT_TRUE(cover->rendered);
+    TEST_ASSERT_TRUE(child->rendered);
+
+    lv_display_overdraw_info_t info;
+    lv_display_get_overdraw_info(NULL, &info);
+    TEST_ASSERT_EQUAL_UINT32(lv_display_get_horizontal_resolution(NULL) * lv_display_get_vertical_resolution(NULL),
+                             info.refr_px);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, info.culled_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(100 * 100, info.culled_px);
+    TEST_ASSERT_GREATER_THAN_UINT32(info.refr_px, info.drawn_px);
+
+    /*Once uncovered it's drawn*/
+    lv_obj_add_flag(cover, LV_OBJ_FLAG_HIDDEN);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(hidden->rendered);
+    lv_display_get_overdraw_info(NULL, &info);
+    TEST_ASSERT_EQUAL_UINT32(0, info.culled_cnt);
+}
+
 void test_display_delete_refr_timer(void)
 {
     lv_display_t * disp = lv_display_create(480, 320);
@@ -0,0 +1,176 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define DISP_W  64
+#define DISP_H  64
+
+static lv_display_t * disp;
+static lv_draw_buf_t * bufs[3];
+static lv_obj_t * obj;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(d);
+}
+
+static void create_display(uint32_t buf_cnt)
+{
+    disp = lv_display_create(DISP_W, DISP_H);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_ARGB8888);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    uint32_t i;
+    for(i = 0; i < buf_cnt; i++) {
+        bufs[i] = lv_draw_buf_create(DISP_W, DISP_H, LV_COLOR_FORMAT_ARGB8888, 0);
+    }
+    lv_display_set_draw_buffers(disp, bufs[0], bufs[1]);
+    if(buf_cnt == 3) lv_display_set_3rd_draw_buffer(disp, bufs[2]);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+
+    /*Hide the performance monitor*/
+    lv_obj_add_flag(lv_display_get_layer_sys(disp), LV_OBJ_FLAG_HIDDEN);
+
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(scr, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+
+    obj = lv_obj_create(scr);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, 10, 10);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+}
+
+/*Move the red square and render a frame. Return the buffer it was rendered to.*/
+static lv_draw_buf_t * move_and_render(int32_t x, int32_t y)
+{
+    lv_obj_set_pos(obj, x, y);
+    lv_draw_buf_t * buf = lv_display_get_buf_active(disp);
+    lv_refr_now(disp);
+    return buf;
+}
+
+static bool is_red(lv_draw_buf_t * buf, int32_t x, int32_t y)
+{
+    lv_color32_t * px = lv_draw_buf_goto_xy(buf, x, y);
+    return px->red == 0xff && px->green == 0x00 && px->blue == 0x00;
+}
+
+static bool is_white(lv_draw_buf_t * buf, int32_t x, int32_t y)
+{
+    lv_color32_t * px = lv_draw_buf_goto_xy(buf, x, y);
+    return px->red == 0xff && px->green == 0xff && px->blue == 0xff;
+}
+
+void setUp(void)
+{
+    disp = NULL;
+    lv_memzero(bufs, sizeof(bufs));
+}
+
+void tearDown(void)
+{
+    if(disp) lv_display_delete(disp);
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        if(bufs[i]) lv_draw_buf_destroy(bufs[i]);
+    }
+}
+
+void test_buffer_sync_double_buffered(void)
+{
+    create_display(2);
+
+    lv_draw_buf_t * buf = move_and_render(0, 0);
+    TEST_ASSERT_EQUAL_PTR(bufs[0], buf);
+    TEST_ASSERT_TRUE(is_red(buf, 5, 5));
+
+    /*Only the old and new positions are redrawn, the rest is copied from buf 0*/
+    buf = move_and_render(20, 20);
+    TEST_ASSERT_EQUAL_PTR(bufs[1], buf);
+    TEST_ASSERT_TRUE(is_white(buf, 5, 5));
+    TEST_ASSERT_TRUE(is_red(buf, 25, 25));
+    TEST_ASSERT_TRUE(is_white(buf, 50, 50));
+
+    buf = move_and_render(40, 40);
+    TEST_ASSERT_EQUAL_PTR(bufs[0], buf);
+    TEST_ASSERT_TRUE(is_white(buf, 5, 5));
+    TEST_ASSERT_TRUE(is_white(buf, 25, 25));
+    TEST_ASSERT_TRUE(is_red(buf, 45, 45));
+
+    /*Nothing is left to copy to the rendered buffer*/
+    TEST_ASSERT_TRUE(lv_ll_is_empty(&disp->stale_areas[0]));
+    TEST_ASSERT_FALSE(lv_ll_is_empty(&disp->stale_areas[1]));
+}
+
+void test_buffer_sync_triple_buffered(void)
+{
+    create_display(3);
+
+    lv_draw_buf_t * buf = move_and_render(0, 0);
+    TEST_ASSERT_EQUAL_PTR(bufs[0], buf);
+
+    buf = move_and_render(20, 20);
+    TEST_ASSERT_EQUAL_PTR(bufs[1], buf);
+    TEST_ASSERT_TRUE(is_white(buf, 5, 5));
+    TEST_ASSERT_TRUE(is_red(buf, 25, 25));
+
+    buf = move_and_render(40, 40);
+    TEST_ASSERT_EQUAL_PTR(bufs[2], buf);
+    TEST_ASSERT_TRUE(is_white(buf, 5, 5));
+    TEST_ASSERT_TRUE(is_white(buf, 25, 25));
+    TEST_ASSERT_TRUE(is_red(buf, 45, 45));
+
+    /*Buf 0 missed 2 frames. Both are copied from buf 2.*/
+    buf = move_and_render(40, 0);
+    TEST_ASSERT_EQUAL_PTR(bufs[0], buf);
+    TEST_ASSERT_TRUE(is_white(buf, 5, 5));
+    TEST_ASSERT_TRUE(is_white(buf, 25, 25));
+    TEST_ASSERT_TRUE(is_white(buf, 45, 45));
+    TEST_ASSERT_TRUE(is_red(buf, 45, 5));
+    TEST_ASSERT_TRUE(is_white(buf, 60, 60));
+}
+
+void test_buffer_sync_stale_areas_are_disjoint(void)
+{
+    create_display(3);
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_refr_now(disp);
+
+    /*Buf 0 is rendered, buf 1 and 2 have to copy the whole screen*/
+    TEST_ASSERT_TRUE(lv_ll_is_empty(&disp->stale_areas[0]));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_ll_get_len(&disp->stale_areas[1]));
+
+    lv_area_t a1 = {0, 0, 29, 29};
+    lv_obj_invalidate_area(scr, &a1);
+    lv_refr_now(disp);
+    TEST_ASSERT_TRUE(lv_ll_is_empty(&disp->stale_areas[1]));
+
+    lv_area_t a2 = {10, 10, 39, 39};
+    lv_obj_invalidate_area(scr, &a2);
+    lv_refr_now(disp);
+    TEST_ASSERT_TRUE(lv_ll_is_empty(&disp->stale_areas[2]));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_ll_get_len(&disp->stale_areas[1]));
+
+    /*Buf 0 missed a1 and a2. Every pixel of them should be copied only once.*/
+    uint32_t px_sum = 0;
+    lv_area_t * area;
+    LV_LL_READ(&disp->stale_areas[0], area) {
+        lv_area_t * other;
+        LV_LL_READ(&disp->stale_areas[0], other) {
+            lv_area_t common;
+            if(other != area) TEST_ASSERT_FALSE(lv_area_intersect(&common, area, other));
+        }
+        px_sum += lv_area_get_size(area);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(30 * 30 * 2 - 20 * 20, px_sum);
+}
+
+#endif
@@ -0,0 +1,194 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define VSYNC_PERIOD_US 16000
+
+static uint32_t render_cnt;
+static uint32_t render_delay;
+static int32_t anim_value;
+
+static void render_start_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    render_cnt++;
+
+    /*Pretend that rendering takes a while*/
+    lv_tick_inc(render_delay);
+}
+
+static void anim_exec_cb(void * var, int32_t v)
+{
+    *((int32_t *)var) = v;
+}
+
+/*Invalidate the screen and let the refresh timer run*/
+static void request_frame(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_timer_ready(lv_display_get_refr_timer(NULL));
+    lv_timer_handler();
+}
+
+void setUp(void)
+{
+    /*Start with a clean state*/
+    lv_refr_now(NULL);
+
+    render_cnt = 0;
+    render_delay = 0;
+    lv_display_add_event_cb(lv_display_get_default(), render_start_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_set_vsync_period(NULL, VSYNC_PERIOD_US);
+    lv_display_set_frame_pacing(NULL, true);
+}
+
+void tearDown(void)
+{
+    lv_display_set_frame_pacing(NULL, false);
+    lv_display_set_vsync_period(NULL, 0);
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), render_start_cb, NULL);
+    lv_anim_delete(&anim_value, anim_exec_cb);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_frame_pacing_needs_vsync_period(void)
+{
+    TEST_ASSERT_TRUE(lv_display_get_frame_pacing(NULL));
+
+    lv_display_set_vsync_period(NULL, 0);
+    lv_display_report_vsync(NULL, lv_tick_get());
+
+    request_frame();
+    TEST_ASSERT_EQUAL_UINT32(1, render_cnt);
+}
+
+void test_frame_pacing_starts_just_in_time(void)
+{
+    uint32_t vsync = lv_tick_get();
+    lv_display_report_vsync(NULL, vsync);
+
+    /*Rendering took 0 ms so far, so start 1 ms before the next vsync*/
+    request_frame();
+    TEST_ASSERT_EQUAL_UINT32(0, render_cnt);
+
+    lv_tick_inc(14);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, render_cnt);
+
+    lv_tick_inc(1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, render_cnt);
+
+    lv_display_frame_pacing_info_t info;
+    lv_display_get_frame_pacing_info(NULL, &info);
+    TEST_ASSERT_EQUAL_UINT32(vsync + 16, info.present_time);
+    TEST_ASSERT_EQUAL_UINT32(1, info.render_time);
+    TEST_ASSERT_EQUAL_UINT32(0, info.skipped_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, info.late_cnt);
+
+    /*The refresh period is restored after the deferred start*/
+    lv_display_set_frame_pacing(NULL, false);
+    TEST_ASSERT_EQUAL_UINT32(LV_DEF_REFR_PERIOD, lv_display_get_refr_timer(NULL)->period);
+}
+
+void test_frame_pacing_skips_vsync_instead_of_being_late(void)
+{
+    render_delay = 20;
+
+    uint32_t vsync = lv_tick_get();
+    lv_display_report_vsync(NULL, vsync);
+
+    /*The first frame is late as the render time wasn't known*/
+    request_frame();
+    lv_tick_inc(15);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, render_cnt);
+    TEST_ASSERT_EQUAL_UINT32(vsync + 35, lv_tick_get());
+
+    lv_display_report_vsync(NULL, vsync + 32);
+
+    lv_display_frame_pacing_info_t info;
+    lv_display_get_frame_pacing_info(NULL, &info);
+    TEST_ASSERT_EQUAL_UINT32(1, info.late_cnt);
+
+    /*Now 20 ms render time is predicted, so aim to the vsync after the next one*/
+    request_frame();
+    TEST_ASSERT_EQUAL_UINT32(1, render_cnt);
+
+    lv_tick_inc(64 - 21 - 35);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, render_cnt);
+
+    lv_display_get_frame_pacing_info(NULL, &info);
+    TEST_ASSERT_EQUAL_UINT32(21, info.render_time);
+    TEST_ASSERT_EQUAL_UINT32(vsync + 64, info.present_time);
+    TEST_ASSERT_EQUAL_UINT32(1, info.skipped_cnt);
+
+    /*It was ready in time*/
+    lv_display_report_vsync(NULL, vsync + 64);
+    lv_display_get_frame_pacing_info(NULL, &info);
+    TEST_ASSERT_EQUAL_UINT32(1, info.late_cnt);
+}
+
+void test_frame_pacing_ignores_vsync_from_other_clock(void)
+{
+    /*E.g. a timestamp from an other clock. Waiting for it would stop rendering.*/
+    lv_display_report_vsync(NULL, lv_tick_get() + 100000);
+
+    request_frame();
+    TEST_ASSERT_EQUAL_UINT32(1, render_cnt);
+
+    /*Not paced until a new vsync is reported*/
+    request_frame();
+    TEST_ASSERT_EQUAL_UINT32(2, render_cnt);
+
+    lv_display_report_vsync(NULL, lv_tick_get());
+    request_frame();
+    TEST_ASSERT_EQUAL_UINT32(2, render_cnt);
+    lv_tick_inc(15);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, render_cnt);
+}
+
+void test_frame_pacing_refr_now_is_not_deferred(void)
+{
+    lv_display_report_vsync(NULL, lv_tick_get());
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, render_cnt);
+}
+
+void test_frame_pacing_updates_animations_to_present_time(void)
+{
+    uint32_t vsync = lv_tick_get();
+    lv_display_report_vsync(NULL, vsync);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &anim_value);
+    lv_anim_set_values(&a, 0, 1024);
+    lv_anim_set_duration(&a, 1024);
+    lv_anim_set_exec_cb(&a, anim_exec_cb);
+    lv_anim_start(&a);
+
+    request_frame();
+    lv_tick_inc(15);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, render_cnt);
+
+    /*The frame will be shown 16 ms after the animation started*/
+    TEST_ASSERT_EQUAL_INT32(16, anim_value);
+
+    /*Don't move the animation back in time*/
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL_INT32(16, anim_value);
+
+    lv_tick_inc(4);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL_INT32(19, anim_value);
+}
+
+#endif
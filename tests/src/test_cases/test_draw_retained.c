@@ -0,0 +1,170 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t draw_main_cnt;
+static lv_obj_t * label;
+static lv_obj_t * overlay;
+
+static void draw_main_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_main_cnt++;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    draw_main_cnt = 0;
+
+    label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "Retained drawing");
+    lv_obj_set_style_bg_opa(label, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(label, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_border_width(label, 3, 0);
+    lv_obj_set_style_shadow_width(label, 20, 0);
+    lv_obj_set_pos(label, 50, 50);
+    lv_obj_set_draw_retained(label, true);
+    lv_obj_add_event_cb(label, draw_main_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    /*Semi transparent widget partially on the label*/
+    overlay = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_bg_opa(overlay, LV_OPA_50, 0);
+    lv_obj_set_pos(overlay, 80, 60);
+    lv_obj_set_size(overlay, 100, 100);
+
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static void refr_overlay(void)
+{
+    lv_obj_invalidate(overlay);
+    lv_refr_now(NULL);
+}
+
+void test_draw_retained_replay_when_a_neighbour_is_invalidated(void)
+{
+    TEST_ASSERT_TRUE(lv_obj_get_draw_retained(label));
+    TEST_ASSERT_EQUAL_UINT32(1, draw_main_cnt);
+
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t size = buf->header.stride * buf->header.h;
+    uint8_t * ref = lv_malloc(size);
+    lv_memcpy(ref, buf->data, size);
+
+    /*The label is redrawn from the retained draw tasks*/
+    refr_overlay();
+    TEST_ASSERT_EQUAL_UINT32(1, draw_main_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref, buf->data, size);
+
+    lv_free(ref);
+}
+
+void test_draw_retained_replay_clipped(void)
+{
+    /*The label clips its text to its content area*/
+    lv_label_set_long_mode(label, LV_LABEL_LONG_MODE_CLIP);
+    lv_label_set_text(label, "A long text\nin many lines\nwhich is clipped\nby the label");
+    lv_obj_set_size(label, 100, 40);
+    lv_obj_set_style_pad_all(label, 8, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t size = buf->header.stride * buf->header.h;
+    uint8_t * ref = lv_malloc(size);
+    lv_memcpy(ref, buf->data, size);
+
+    /*The replayed text is clipped the same way*/
+    refr_overlay();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref, buf->data, size);
+
+    lv_free(ref);
+}
+
+void test_draw_retained_state_change_of_other_widgets(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_pos(cont, 200, 200);
+    lv_obj_set_style_text_color(cont, lv_palette_main(LV_PALETTE_RED), LV_STATE_PRESSED);
+    lv_obj_t * child = lv_label_create(cont);
+    lv_label_set_text(child, "Child");
+    lv_obj_set_draw_retained(child, true);
+    lv_obj_add_event_cb(child, draw_main_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_set_style_bg_color(overlay, lv_palette_main(LV_PALETTE_GREEN), LV_STATE_PRESSED);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    /*The state of an unrelated widget doesn't outdate the retained draw tasks*/
+    lv_obj_add_state(overlay, LV_STATE_PRESSED);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    /*The inherited styles of the children might change with the state*/
+    lv_obj_add_state(cont, LV_STATE_PRESSED);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, draw_main_cnt);
+    TEST_ASSERT_EQUAL_COLOR(lv_palette_main(LV_PALETTE_RED), lv_obj_get_style_text_color(child, 0));
+}
+
+void test_draw_retained_outdated_by_changes(void)
+{
+    /*Changing the widget invalidates it*/
+    lv_label_set_text(label, "Changed");
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+    refr_overlay();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    /*State change*/
+    lv_obj_add_state(label, LV_STATE_PRESSED);
+    refr_overlay();
+    TEST_ASSERT_EQUAL_UINT32(3, draw_main_cnt);
+
+    /*Inherited style of the parent*/
+    lv_obj_set_style_text_color(lv_screen_active(), lv_palette_main(LV_PALETTE_RED), 0);
+    refr_overlay();
+    TEST_ASSERT_EQUAL_UINT32(4, draw_main_cnt);
+
+    /*Moved*/
+    lv_obj_set_x(label, 60);
+    refr_overlay();
+    TEST_ASSERT_EQUAL_UINT32(5, draw_main_cnt);
+    refr_overlay();
+    TEST_ASSERT_EQUAL_UINT32(5, draw_main_cnt);
+
+    lv_obj_set_draw_retained(label, false);
+    TEST_ASSERT_FALSE(lv_obj_get_draw_retained(label));
+    refr_overlay();
+    TEST_ASSERT_EQUAL_UINT32(6, draw_main_cnt);
+}
+
+void test_draw_retained_not_recorded_if_partially_visible(void)
+{
+    /*Enabled now, so there is no recorded draw tasks yet and only a part of the label is redrawn*/
+    lv_obj_set_draw_retained(label, false);
+    lv_obj_set_draw_retained(label, true);
+    refr_overlay();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+    refr_overlay();
+    TEST_ASSERT_EQUAL_UINT32(3, draw_main_cnt);
+
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, draw_main_cnt);
+    refr_overlay();
+    TEST_ASSERT_EQUAL_UINT32(4, draw_main_cnt);
+}
+
+#endif
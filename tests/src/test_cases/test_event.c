@@ -177,4 +177,106 @@ void test_event_remove_event_cb(void)
     lv_obj_delete(obj);
 }
 
+static uint32_t code_cb_cnt;
+static void count_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    code_cb_cnt++;
+}
+
+void test_event_list_code_mask(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_allocate_spec_attr(obj);
+    lv_event_list_t * list = &obj->spec_attr->event_list;
+    TEST_ASSERT_FALSE(lv_event_list_has_code(list, LV_EVENT_CLICKED));
+
+    uint32_t custom_code = lv_event_register_id();
+    lv_obj_add_event_cb(obj, count_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(obj, count_cb, LV_EVENT_DRAW_POST_END | LV_EVENT_PREPROCESS, NULL);
+    lv_obj_add_event_cb(obj, count_cb, custom_code, NULL);
+    TEST_ASSERT_TRUE(lv_event_list_has_code(list, LV_EVENT_CLICKED));
+    TEST_ASSERT_TRUE(lv_event_list_has_code(list, LV_EVENT_DRAW_POST_END));
+    TEST_ASSERT_TRUE(lv_event_list_has_code(list, custom_code));
+    TEST_ASSERT_FALSE(lv_event_list_has_code(list, LV_EVENT_PRESSED));
+    TEST_ASSERT_FALSE(lv_event_list_has_code(list, LV_EVENT_COVER_CHECK));
+
+    code_cb_cnt = 0;
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    lv_obj_send_event(obj, LV_EVENT_DRAW_POST_END, NULL);
+    lv_obj_send_event(obj, custom_code, NULL);
+    lv_obj_send_event(obj, LV_EVENT_PRESSED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, code_cb_cnt);
+
+    /*The bits are cleared when the callbacks are removed*/
+    lv_obj_remove_event(obj, 0);
+    TEST_ASSERT_FALSE(lv_event_list_has_code(list, LV_EVENT_CLICKED));
+    TEST_ASSERT_TRUE(lv_event_list_has_code(list, LV_EVENT_DRAW_POST_END));
+
+    /*All the codes are enabled by LV_EVENT_ALL*/
+    lv_obj_add_event_cb(obj, count_cb, LV_EVENT_ALL, NULL);
+    TEST_ASSERT_TRUE(lv_event_list_has_code(list, LV_EVENT_COVER_CHECK));
+    TEST_ASSERT_TRUE(lv_event_list_has_code(list, custom_code + 1));
+    lv_obj_remove_event_cb(obj, count_cb);
+    TEST_ASSERT_FALSE(lv_event_list_has_code(list, LV_EVENT_COVER_CHECK));
+    TEST_ASSERT_FALSE(lv_event_list_has_code(list, custom_code));
+
+    lv_obj_delete(obj);
+}
+
+static void remove_self_cb(lv_event_t * e)
+{
+    code_cb_cnt++;
+    lv_obj_remove_event_cb(lv_event_get_current_target(e), remove_self_cb);
+}
+
+void test_event_list_code_mask_remove_in_event(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_event_cb(obj, remove_self_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(obj, count_cb, LV_EVENT_PRESSED, NULL);
+
+    code_cb_cnt = 0;
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    lv_obj_send_event(obj, LV_EVENT_PRESSED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, code_cb_cnt);
+    TEST_ASSERT_FALSE(lv_event_list_has_code(&obj->spec_attr->event_list, LV_EVENT_CLICKED));
+
+    lv_obj_delete(obj);
+}
+
+void test_event_dispatch_stat(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_EVENT_BUBBLE);
+    lv_obj_add_event_cb(parent, count_cb, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_reset_event_dispatch_stat();
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    lv_obj_send_event(obj, LV_EVENT_PRESSED, NULL);
+
+    /*Sent to the parent too by bubbling*/
+    const lv_obj_event_dispatch_stat_t * stat = lv_obj_get_event_dispatch_stat(LV_EVENT_CLICKED);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2, stat->send_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stat->send_cnt - 1, stat->list_skip_cnt);
+
+    stat = lv_obj_get_event_dispatch_stat(LV_EVENT_PRESSED);
+    TEST_ASSERT_EQUAL_UINT32(stat->send_cnt, stat->list_skip_cnt);
+
+    /*The drawing events are sent to every widget*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    stat = lv_obj_get_event_dispatch_stat(LV_EVENT_DRAW_MAIN_BEGIN);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(3, stat->send_cnt);
+
+    TEST_ASSERT_NULL(lv_obj_get_event_dispatch_stat(LV_EVENT_LAST));
+
+    lv_obj_reset_event_dispatch_stat();
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_event_dispatch_stat(LV_EVENT_CLICKED)->send_cnt);
+
+    lv_obj_delete(parent);
+}
+
 #endif
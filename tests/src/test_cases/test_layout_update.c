@@ -0,0 +1,218 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * active_screen;
+
+static uint32_t layout_changed_cnt;
+
+static void layout_changed_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    layout_changed_cnt++;
+}
+
+static lv_obj_t * create_column(lv_obj_t * parent, uint32_t item_cnt)
+{
+    lv_obj_t * cont = lv_obj_create(parent);
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, 100, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < item_cnt; i++) {
+        lv_obj_t * item = lv_obj_create(cont);
+        lv_obj_remove_style_all(item);
+        lv_obj_set_size(item, 100, 10);
+    }
+
+    return cont;
+}
+
+static lv_obj_t * reparent_target;
+
+static void resize_and_reparent_anim_cb(void * var, int32_t v)
+{
+    lv_obj_t * obj = var;
+    lv_obj_set_width(obj, v);
+    if(lv_obj_get_parent(obj) != reparent_target) lv_obj_set_parent(obj, reparent_target);
+}
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+    layout_changed_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+void test_layout_update_only_dirty_subtree(void)
+{
+    lv_obj_t * cont1 = create_column(active_screen, 100);
+    lv_obj_t * cont2 = create_column(active_screen, 100);
+    lv_obj_set_x(cont2, 200);
+    lv_obj_update_layout(active_screen);
+    TEST_ASSERT_EQUAL_INT32(1000, lv_obj_get_height(cont2));
+
+    /*Nothing is dirty after the update*/
+    TEST_ASSERT_FALSE(active_screen->layout_child_inv);
+    TEST_ASSERT_FALSE(cont1->layout_child_inv);
+    TEST_ASSERT_FALSE(cont2->layout_child_inv);
+
+    lv_obj_add_event_cb(cont1, layout_changed_cb, LV_EVENT_LAYOUT_CHANGED, NULL);
+    lv_obj_t * item = lv_obj_get_child(cont2, 10);
+    lv_obj_set_height(item, 30);
+    TEST_ASSERT_TRUE(item->layout_inv);
+    TEST_ASSERT_TRUE(cont2->layout_child_inv);
+    TEST_ASSERT_TRUE(active_screen->layout_child_inv);
+    TEST_ASSERT_FALSE(cont1->layout_child_inv);
+
+    lv_obj_update_layout(active_screen);
+
+    /*Only the container of the changed item was laid out again*/
+    TEST_ASSERT_EQUAL_UINT32(0, layout_changed_cnt);
+    TEST_ASSERT_EQUAL_INT32(1020, lv_obj_get_height(cont2));
+    TEST_ASSERT_EQUAL_INT32(100, lv_obj_get_y(lv_obj_get_child(cont2, 10)));
+    TEST_ASSERT_EQUAL_INT32(130, lv_obj_get_y(lv_obj_get_child(cont2, 11)));
+    TEST_ASSERT_EQUAL_INT32(1010, lv_obj_get_y(lv_obj_get_child(cont2, 99)));
+    TEST_ASSERT_EQUAL_INT32(990, lv_obj_get_y(lv_obj_get_child(cont1, 99)));
+    TEST_ASSERT_FALSE(active_screen->layout_child_inv);
+    TEST_ASSERT_FALSE(cont2->layout_child_inv);
+}
+
+void test_layout_update_nested_item(void)
+{
+    lv_obj_t * cont = create_column(active_screen, 3);
+    lv_obj_t * inner = create_column(lv_obj_get_child(cont, 1), 2);
+    lv_obj_set_height(lv_obj_get_child(cont, 1), LV_SIZE_CONTENT);
+    lv_obj_update_layout(active_screen);
+    TEST_ASSERT_EQUAL_INT32(20, lv_obj_get_height(lv_obj_get_child(cont, 1)));
+    TEST_ASSERT_EQUAL_INT32(40, lv_obj_get_height(cont));
+
+    /*The size change of a deep item goes up until the sizes change*/
+    lv_obj_set_height(lv_obj_get_child(inner, 0), 25);
+    lv_obj_update_layout(active_screen);
+    TEST_ASSERT_EQUAL_INT32(35, lv_obj_get_height(inner));
+    TEST_ASSERT_EQUAL_INT32(55, lv_obj_get_height(cont));
+    TEST_ASSERT_EQUAL_INT32(45, lv_obj_get_y(lv_obj_get_child(cont, 2)));
+}
+
+void test_layout_update_grid_content_tracks(void)
+{
+    static int32_t col_dsc[] = {LV_GRID_CONTENT, 50, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+    static int32_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+
+    uint32_t i;
+    for(i = 0; i < 9; i++) {
+        lv_obj_t * item = lv_obj_create(cont);
+        lv_obj_remove_style_all(item);
+        lv_obj_set_size(item, 10 + i, 20 + i * 2);
+        lv_obj_set_grid_cell(item, LV_GRID_ALIGN_START, i % 3, 1, LV_GRID_ALIGN_START, i / 3, 1);
+    }
+
+    /*Spans more columns so it doesn't change their size*/
+    lv_obj_t * wide = lv_obj_create(cont);
+    lv_obj_remove_style_all(wide);
+    lv_obj_set_size(wide, 60, 5);
+    lv_obj_set_grid_cell(wide, LV_GRID_ALIGN_START, 0, 2, LV_GRID_ALIGN_START, 0, 1);
+
+    lv_obj_update_layout(active_screen);
+
+    /*The widest item of the columns and the highest of the rows*/
+    TEST_ASSERT_EQUAL_INT32(16 + 50 + 18, lv_obj_get_width(cont));
+    TEST_ASSERT_EQUAL_INT32(24 + 30 + 36, lv_obj_get_height(cont));
+    TEST_ASSERT_EQUAL_INT32(16, lv_obj_get_x(lv_obj_get_child(cont, 1)));
+    TEST_ASSERT_EQUAL_INT32(66, lv_obj_get_x(lv_obj_get_child(cont, 2)));
+    TEST_ASSERT_EQUAL_INT32(54, lv_obj_get_y(lv_obj_get_child(cont, 6)));
+
+    lv_obj_set_height(lv_obj_get_child(cont, 3), 40);
+    lv_obj_update_layout(active_screen);
+    TEST_ASSERT_EQUAL_INT32(24 + 40 + 36, lv_obj_get_height(cont));
+    TEST_ASSERT_EQUAL_INT32(64, lv_obj_get_y(lv_obj_get_child(cont, 6)));
+}
+
+void test_layout_update_flex_saved_tracks(void)
+{
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, 100, 200);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * item = lv_obj_create(cont);
+        lv_obj_remove_style_all(item);
+        lv_obj_set_size(item, 30, 10 + i);
+    }
+
+    /*The last item of every track grows to the end of the track*/
+    lv_obj_set_flex_grow(lv_obj_get_child(cont, 2), 1);
+    lv_obj_set_style_min_width(lv_obj_get_child(cont, 2), 30, 0);
+    lv_obj_set_flex_grow(lv_obj_get_child(cont, 5), 1);
+    lv_obj_set_style_min_width(lv_obj_get_child(cont, 5), 30, 0);
+
+    lv_obj_update_layout(active_screen);
+
+    /*4 tracks with 3, 3, 3, 1 items, 12 + 15 + 18 + 19 px high, centered*/
+    int32_t y = (200 - 64) / 2;
+    TEST_ASSERT_EQUAL_INT32(y, lv_obj_get_y(lv_obj_get_child(cont, 0)));
+    TEST_ASSERT_EQUAL_INT32(y + 12, lv_obj_get_y(lv_obj_get_child(cont, 3)));
+    TEST_ASSERT_EQUAL_INT32(y + 27, lv_obj_get_y(lv_obj_get_child(cont, 6)));
+    TEST_ASSERT_EQUAL_INT32(y + 45, lv_obj_get_y(lv_obj_get_child(cont, 9)));
+    TEST_ASSERT_EQUAL_INT32(40, lv_obj_get_width(lv_obj_get_child(cont, 2)));
+    TEST_ASSERT_EQUAL_INT32(40, lv_obj_get_width(lv_obj_get_child(cont, 5)));
+    TEST_ASSERT_EQUAL_INT32(30, lv_obj_get_width(lv_obj_get_child(cont, 8)));
+}
+
+void test_layout_update_reparent_in_anim(void)
+{
+    lv_obj_t * cont1 = create_column(active_screen, 3);
+
+    /*A plain container doesn't mark its layout as dirty when it gets a new child*/
+    lv_obj_t * wrapper = lv_obj_create(active_screen);
+    lv_obj_remove_style_all(wrapper);
+    lv_obj_set_size(wrapper, 100, 100);
+    lv_obj_set_x(wrapper, 200);
+    reparent_target = lv_obj_create(wrapper);
+    lv_obj_remove_style_all(reparent_target);
+    lv_obj_set_size(reparent_target, 100, 100);
+    lv_obj_update_layout(active_screen);
+
+    lv_obj_t * item = lv_obj_get_child(cont1, 1);
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, item);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, resize_and_reparent_anim_cb);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_set_early_apply(&a, false);
+    lv_anim_start(&a);
+
+    /*The item's layout becomes dirty in the old parent and it's moved
+     *to the new parent while the invalidations are coalesced*/
+    lv_anim_refr_at(lv_tick_get() + 50);
+    TEST_ASSERT_EQUAL_PTR(reparent_target, lv_obj_get_parent(item));
+    TEST_ASSERT_TRUE(wrapper->layout_child_inv);
+    TEST_ASSERT_TRUE(reparent_target->layout_child_inv);
+
+    lv_obj_update_layout(active_screen);
+    TEST_ASSERT_FALSE(item->layout_inv);
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_style_width(item, LV_PART_MAIN), lv_obj_get_width(item));
+    TEST_ASSERT_EQUAL_INT32(200, item->coords.x1);
+    TEST_ASSERT_EQUAL_INT32(10, lv_obj_get_y(lv_obj_get_child(cont1, 1)));
+
+    lv_anim_delete(item, NULL);
+}
+
+#endif
@@ -0,0 +1,166 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_mem_slab_blocks(void)
+{
+    lv_mem_slab_t slab;
+    lv_mem_slab_init(&slab, 20, 4);
+    TEST_ASSERT_EQUAL_UINT32(24, slab.block_size);
+
+    uint32_t i;
+    uint8_t * blocks[5];
+    for(i = 0; i < 5; i++) {
+        blocks[i] = lv_mem_slab_alloc(&slab);
+        TEST_ASSERT_NOT_NULL(blocks[i]);
+        TEST_ASSERT_EQUAL_UINT32(0, (lv_uintptr_t)blocks[i] % 8);
+        lv_memset(blocks[i], i, 20);
+    }
+
+    /*The 5th block needed a second chunk*/
+    TEST_ASSERT_EQUAL_UINT32(5, slab.used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, slab.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, slab.hit_cnt);
+    TEST_ASSERT_EQUAL_PTR(blocks[0] + 24, blocks[1]);
+
+    for(i = 0; i < 5; i++) {
+        TEST_ASSERT_EACH_EQUAL_UINT8(i, blocks[i], 20);
+    }
+
+    /*The last freed block is given out first*/
+    lv_mem_slab_free(&slab, blocks[2]);
+    TEST_ASSERT_EQUAL_PTR(blocks[2], lv_mem_slab_alloc(&slab));
+    TEST_ASSERT_EQUAL_UINT32(4, slab.hit_cnt);
+
+    /*The chunks are freed with the last block, except a spare one*/
+    for(i = 0; i < 5; i++) {
+        lv_mem_slab_free(&slab, blocks[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, slab.used_cnt);
+    TEST_ASSERT_NOT_NULL(slab.chunks);
+    TEST_ASSERT_NULL(*(void **)slab.chunks);
+
+    /*Allocating and freeing a block again doesn't need a new chunk*/
+    for(i = 0; i < 3; i++) {
+        uint8_t * p = lv_mem_slab_alloc(&slab);
+        TEST_ASSERT_EQUAL_PTR(blocks[4], p);
+        lv_mem_slab_free(&slab, p);
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, slab.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(7, slab.hit_cnt);
+
+    /*All blocks of the spare chunk can be used*/
+    for(i = 0; i < 4; i++) {
+        blocks[i] = lv_mem_slab_alloc(&slab);
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, slab.miss_cnt);
+    TEST_ASSERT_EQUAL_PTR(blocks[0] + 24 * 3, blocks[3]);
+    for(i = 0; i < 4; i++) {
+        lv_mem_slab_free(&slab, blocks[i]);
+    }
+
+    lv_mem_slab_deinit(&slab);
+    TEST_ASSERT_NULL(slab.chunks);
+    TEST_ASSERT_NULL(slab.free_blocks);
+}
+
+#if LV_USE_MEM_SLAB
+
+void test_mem_slab_size_classes(void)
+{
+    lv_mem_monitor_t mon1;
+    lv_mem_monitor(&mon1);
+
+    uint8_t * p1 = lv_malloc_slab_zeroed(10);
+    uint8_t * p2 = lv_malloc_slab_zeroed(100);
+    TEST_ASSERT_NOT_NULL(p1);
+    TEST_ASSERT_NOT_NULL(p2);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, p1, 10);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, p2, 100);
+
+    lv_mem_monitor_t mon2;
+    lv_mem_monitor(&mon2);
+    TEST_ASSERT_EQUAL_UINT32(mon1.slab_hit_cnt + mon1.slab_miss_cnt + 2, mon2.slab_hit_cnt + mon2.slab_miss_cnt);
+    TEST_ASSERT_EQUAL(mon1.slab_used_size + 16 + 128, mon2.slab_used_size);
+
+    /*Too large for the slabs so it's allocated from the heap*/
+    uint8_t * p3 = lv_malloc_slab(1000);
+    TEST_ASSERT_NOT_NULL(p3);
+    lv_mem_monitor(&mon2);
+    TEST_ASSERT_EQUAL(mon1.slab_used_size + 16 + 128, mon2.slab_used_size);
+
+    lv_free_slab(p1, 10);
+    lv_free_slab(p2, 100);
+    lv_free_slab(p3, 1000);
+    lv_free_slab(NULL, 10);
+
+    lv_mem_monitor(&mon2);
+    TEST_ASSERT_EQUAL(mon1.slab_used_size, mon2.slab_used_size);
+}
+
+void test_mem_slab_draw_tasks(void)
+{
+    LV_DRAW_BUF_DEFINE_STATIC(buf, 40, 40, LV_COLOR_FORMAT_ARGB8888);
+    LV_DRAW_BUF_INIT_STATIC(buf);
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, &buf);
+
+    lv_mem_monitor_t mon1;
+    lv_mem_monitor(&mon1);
+
+    /*Not in a refresh so the draw tasks are allocated from the slabs*/
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.radius = 5;
+    dsc.border_width = 2;
+    dsc.shadow_width = 4;
+    lv_area_t area = {5, 5, 30, 30};
+    lv_draw_rect(&layer, &dsc, &area);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    /*All of them are freed*/
+    lv_mem_monitor_t mon2;
+    lv_mem_monitor(&mon2);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(mon1.slab_hit_cnt + mon1.slab_miss_cnt + 3,
+                                        mon2.slab_hit_cnt + mon2.slab_miss_cnt);
+    TEST_ASSERT_EQUAL(mon1.slab_used_size, mon2.slab_used_size);
+}
+
+void test_mem_slab_event_dsc(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+
+    lv_mem_monitor_t mon1;
+    lv_mem_monitor(&mon1);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_add_event_cb(obj, NULL, LV_EVENT_CLICKED, NULL);
+    }
+
+    lv_mem_monitor_t mon2;
+    lv_mem_monitor(&mon2);
+    TEST_ASSERT_GREATER_THAN(mon1.slab_used_size, mon2.slab_used_size);
+
+    lv_obj_delete(obj);
+    lv_mem_monitor(&mon2);
+    TEST_ASSERT_EQUAL(mon1.slab_used_size, mon2.slab_used_size);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,160 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_style_t style1;
+static lv_style_t style2;
+static lv_style_t style3;
+
+void setUp(void)
+{
+    lv_style_init(&style1);
+    lv_style_set_bg_opa(&style1, LV_OPA_50);
+    lv_style_init(&style2);
+    lv_style_set_radius(&style2, 7);
+    lv_style_init(&style3);
+    lv_style_set_border_width(&style3, 3);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_style_reset(&style1);
+    lv_style_reset(&style2);
+    lv_style_reset(&style3);
+}
+
+void test_obj_attr_pool_inline_styles(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+
+    lv_obj_add_style(obj, &style1, 0);
+    lv_obj_set_style_pad_left(obj, 5, 0);
+    TEST_ASSERT_EQUAL_PTR(obj->styles_inline, obj->styles);
+
+    /*Doesn't fit into the slots anymore*/
+    lv_obj_add_style(obj, &style2, 0);
+    TEST_ASSERT_NOT_EQUAL(obj->styles_inline, obj->styles);
+    lv_obj_add_style(obj, &style3, 0);
+    TEST_ASSERT_EQUAL_UINT32(4, obj->style_cnt);
+    TEST_ASSERT_EQUAL_INT32(5, lv_obj_get_style_pad_left(obj, 0));
+    TEST_ASSERT_EQUAL_INT32(7, lv_obj_get_style_radius(obj, 0));
+
+    /*Back to the slots, and the order is kept*/
+    lv_obj_remove_style(obj, &style1, 0);
+    lv_obj_remove_style(obj, &style2, 0);
+    TEST_ASSERT_EQUAL_PTR(obj->styles_inline, obj->styles);
+    TEST_ASSERT_TRUE(obj->styles[0].is_local);
+    TEST_ASSERT_EQUAL_PTR(&style3, obj->styles[1].style);
+    TEST_ASSERT_EQUAL_INT32(5, lv_obj_get_style_pad_left(obj, 0));
+    TEST_ASSERT_EQUAL_INT32(3, lv_obj_get_style_border_width(obj, 0));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_radius(obj, 0));
+
+    lv_obj_remove_style_all(obj);
+    TEST_ASSERT_EQUAL_UINT32(0, obj->style_cnt);
+}
+
+void test_obj_attr_pool_chunks(void)
+{
+    lv_mem_slab_t * style_pool = &LV_GLOBAL_DEFAULT()->obj_attr_pools[LV_OBJ_ATTR_POOL_STYLE];
+    lv_mem_slab_t * spec_attr_pool = &LV_GLOBAL_DEFAULT()->obj_attr_pools[LV_OBJ_ATTR_POOL_SPEC_ATTR];
+    uint32_t style_used = style_pool->used_cnt;
+    uint32_t spec_attr_used = spec_attr_pool->used_cnt;
+
+    uint32_t i;
+    lv_obj_t * objs[LV_OBJ_ATTR_POOL_BLOCK_CNT * 2];
+    for(i = 0; i < LV_OBJ_ATTR_POOL_BLOCK_CNT * 2; i++) {
+        objs[i] = lv_obj_create(lv_screen_active());
+        lv_obj_set_style_pad_left(objs[i], i, 0);
+        lv_obj_set_style_pad_left(objs[i], i + 1, LV_STATE_PRESSED);
+        lv_obj_set_scroll_dir(objs[i], LV_DIR_HOR);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(style_used + LV_OBJ_ATTR_POOL_BLOCK_CNT * 4, style_pool->used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(spec_attr_used + LV_OBJ_ATTR_POOL_BLOCK_CNT * 2, spec_attr_pool->used_cnt);
+
+    for(i = 0; i < LV_OBJ_ATTR_POOL_BLOCK_CNT * 2; i++) {
+        TEST_ASSERT_EQUAL_INT32(i, lv_obj_get_style_pad_left(objs[i], 0));
+        TEST_ASSERT_EQUAL_UINT8(LV_DIR_HOR, lv_obj_get_scroll_dir(objs[i]));
+    }
+
+    /*The freed blocks are reused*/
+    for(i = 0; i < LV_OBJ_ATTR_POOL_BLOCK_CNT; i++) {
+        lv_obj_delete(objs[i]);
+    }
+    void * chunks = style_pool->chunks;
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_radius(obj, 1, 0);
+    TEST_ASSERT_EQUAL_PTR(chunks, style_pool->chunks);
+    TEST_ASSERT_EQUAL_UINT32(style_used + LV_OBJ_ATTR_POOL_BLOCK_CNT * 2 + 1, style_pool->used_cnt);
+
+    lv_obj_clean(lv_screen_active());
+    TEST_ASSERT_EQUAL_UINT32(style_used, style_pool->used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(spec_attr_used, spec_attr_pool->used_cnt);
+}
+
+void test_obj_attr_pool_transition_style(void)
+{
+    static const lv_style_prop_t props[] = {LV_STYLE_BG_OPA, LV_STYLE_PROP_INV};
+    static lv_style_transition_dsc_t tr;
+    lv_style_transition_dsc_init(&tr, props, lv_anim_path_linear, 100, 0, NULL);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_bg_opa(obj, LV_OPA_50, LV_STATE_PRESSED);
+    lv_obj_set_style_transition(obj, &tr, LV_STATE_PRESSED);
+    lv_refr_now(NULL);  /*No transitions before the first rendering*/
+
+    lv_mem_slab_t * style_pool = &LV_GLOBAL_DEFAULT()->obj_attr_pools[LV_OBJ_ATTR_POOL_STYLE];
+    uint32_t used = style_pool->used_cnt;
+    /*The transition style is created when the transition starts*/
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    lv_test_wait(10);
+    TEST_ASSERT_EQUAL_UINT32(used + 1, style_pool->used_cnt);
+
+    lv_test_wait(200);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, lv_obj_get_style_bg_opa(obj, 0));
+
+    lv_obj_delete(obj);
+    TEST_ASSERT_EQUAL_UINT32(used - 1, style_pool->used_cnt);
+}
+
+void test_obj_attr_pool_class_alloc_stat(void)
+{
+    const lv_obj_class_alloc_stat_t * stat = lv_obj_class_get_alloc_stat_by_class(&lv_checkbox_class);
+    uint32_t create_cnt = stat ? stat->create_cnt : 0;
+    uint32_t obj_cnt = stat ? stat->obj_cnt : 0;
+
+    lv_obj_t * cb1 = lv_checkbox_create(lv_screen_active());
+    lv_checkbox_create(lv_screen_active());
+    lv_checkbox_create(cb1);
+
+    stat = lv_obj_class_get_alloc_stat_by_class(&lv_checkbox_class);
+    TEST_ASSERT_NOT_NULL(stat);
+    TEST_ASSERT_EQUAL_PTR(&lv_checkbox_class, stat->class_p);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(lv_checkbox_t), stat->instance_size);
+    TEST_ASSERT_EQUAL_UINT32(obj_cnt + 3, stat->obj_cnt);
+    TEST_ASSERT_EQUAL_UINT32(create_cnt + 3, stat->create_cnt);
+
+    /*The children are counted too*/
+    lv_obj_delete(cb1);
+    TEST_ASSERT_EQUAL_UINT32(obj_cnt + 1, stat->obj_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(obj_cnt + 3, stat->obj_cnt_max);
+
+    /*The screens are counted as `lv_obj`*/
+    bool found = false;
+    uint32_t i;
+    for(i = 0; i < lv_obj_class_get_alloc_stat_count(); i++) {
+        stat = lv_obj_class_get_alloc_stat(i);
+        if(stat->class_p == &lv_obj_class) {
+            TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stat->obj_cnt);
+            found = true;
+        }
+    }
+    TEST_ASSERT_TRUE(found);
+    TEST_ASSERT_NULL(lv_obj_class_get_alloc_stat(lv_obj_class_get_alloc_stat_count()));
+}
+
+#endif
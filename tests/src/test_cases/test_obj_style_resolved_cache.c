@@ -0,0 +1,130 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t get_used_cnt(void)
+{
+    uint32_t used_cnt;
+    lv_obj_style_get_resolved_cache_usage(&used_cnt, NULL);
+    return used_cnt;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_obj_style_resolved_cache_local_style(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_radius(obj, 12, 0);
+    TEST_ASSERT_EQUAL_INT32(12, lv_obj_get_style_radius(obj, 0));
+    TEST_ASSERT_EQUAL_INT32(12, lv_obj_get_style_radius(obj, 0));
+    TEST_ASSERT_NOT_NULL(obj->style_resolved);
+    TEST_ASSERT_EQUAL_INT32(12, obj->style_resolved->values[LV_STYLE_RADIUS].num);
+
+    lv_obj_set_style_radius(obj, 20, 0);
+    TEST_ASSERT_EQUAL_INT32(20, lv_obj_get_style_radius(obj, 0));
+
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_RADIUS, 0);
+    lv_obj_remove_style_all(obj);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_radius(obj, 0));
+}
+
+void test_obj_style_resolved_cache_shared_style(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_opa(&style, LV_OPA_50);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &style, 0);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, lv_obj_get_style_bg_opa(obj, 0));
+
+    lv_style_set_bg_opa(&style, LV_OPA_70);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_70, lv_obj_get_style_bg_opa(obj, 0));
+
+    lv_obj_style_set_disabled(obj, &style, 0, true);
+    TEST_ASSERT_NOT_EQUAL(LV_OPA_70, lv_obj_get_style_bg_opa(obj, 0));
+
+    lv_obj_delete(obj);
+    lv_style_reset(&style);
+}
+
+void test_obj_style_resolved_cache_state(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_border_width(obj, 3, LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(obj, 7, LV_STATE_PRESSED);
+
+    TEST_ASSERT_EQUAL_INT32(3, lv_obj_get_style_border_width(obj, 0));
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_INT32(7, lv_obj_get_style_border_width(obj, 0));
+    lv_obj_remove_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_INT32(3, lv_obj_get_style_border_width(obj, 0));
+}
+
+void test_obj_style_resolved_cache_inherited(void)
+{
+    lv_obj_t * parent1 = lv_obj_create(lv_screen_active());
+    lv_obj_t * parent2 = lv_obj_create(lv_screen_active());
+    lv_obj_t * label = lv_label_create(parent1);
+    lv_obj_set_style_text_color(parent1, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x0000ff), 0);
+
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(label, 0));
+
+    /*A change on the parent*/
+    lv_obj_set_style_text_color(parent1, lv_color_hex(0x00ff00), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(label, 0));
+
+    /*A state change of the parent*/
+    lv_obj_set_style_text_color(parent1, lv_color_hex(0x808080), LV_STATE_CHECKED);
+    lv_obj_add_state(parent1, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x808080), lv_obj_get_style_text_color(label, 0));
+
+    /*New parent*/
+    lv_obj_set_parent(label, parent2);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(label, 0));
+}
+
+void test_obj_style_resolved_cache_reuse_entries(void)
+{
+    uint32_t i;
+    lv_obj_t * objs[LV_OBJ_STYLE_RESOLVED_CACHE_CNT * 2];
+    for(i = 0; i < LV_OBJ_STYLE_RESOLVED_CACHE_CNT * 2; i++) {
+        objs[i] = lv_obj_create(lv_screen_active());
+        lv_obj_set_style_pad_left(objs[i], i, 0);
+    }
+
+    /*Twice to get values from the cache too*/
+    uint32_t j;
+    for(j = 0; j < 2; j++) {
+        for(i = 0; i < LV_OBJ_STYLE_RESOLVED_CACHE_CNT * 2; i++) {
+            TEST_ASSERT_EQUAL_INT32(i, lv_obj_get_style_pad_left(objs[i], 0));
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(LV_OBJ_STYLE_RESOLVED_CACHE_CNT, get_used_cnt());
+
+    /*The entries of the deleted widgets are freed*/
+    lv_obj_clean(lv_screen_active());
+    for(i = 0; i < LV_OBJ_STYLE_RESOLVED_CACHE_CNT; i++) {
+        const lv_obj_t * obj = LV_GLOBAL_DEFAULT()->style_resolved_cache[i].obj;
+        if(obj) TEST_ASSERT_EQUAL_PTR(lv_screen_active(), obj);
+    }
+
+    uint32_t mem_size;
+    lv_obj_style_get_resolved_cache_usage(NULL, &mem_size);
+    TEST_ASSERT_EQUAL_UINT32(LV_OBJ_STYLE_RESOLVED_CACHE_CNT * sizeof(lv_obj_style_resolved_t), mem_size);
+}
+
+#endif
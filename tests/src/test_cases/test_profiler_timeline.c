@@ -0,0 +1,222 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include <string.h>
+
+#define OUTPUT_BUF_MAX (256 * 1024)
+
+static uint64_t profiler_tick;
+static char * output_buf;
+static uint32_t output_len;
+
+static uint64_t get_tick_cb(void)
+{
+    /*Advance 1 ms on each call*/
+    profiler_tick += 1000;
+    return profiler_tick;
+}
+
+static int get_tid_cb(void)
+{
+    return 7;
+}
+
+#if LV_USE_OS == LV_OS_PTHREAD
+static void add_event_thread_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    uint64_t begin = lv_profiler_timeline_tick_get();
+    lv_profiler_timeline_add(LV_PROFILER_TIMELINE_EVENT_FRAME, "thread", 0, NULL, begin);
+}
+#endif
+
+static void write_cb(const char * buf, void * user_data)
+{
+    TEST_ASSERT_EQUAL_PTR(&output_len, user_data);
+
+    uint32_t len = lv_strlen(buf);
+    TEST_ASSERT_LESS_THAN(OUTPUT_BUF_MAX, output_len + len);
+
+    lv_memcpy(output_buf + output_len, buf, len + 1);
+    output_len += len;
+}
+
+static void export_timeline(void)
+{
+    output_len = 0;
+    output_buf[0] = '\0';
+    lv_profiler_timeline_export(write_cb, &output_len);
+}
+
+void setUp(void)
+{
+    lv_profiler_timeline_config_t config;
+    lv_profiler_timeline_config_init(&config);
+    config.tick_get_cb = get_tick_cb;
+    config.tick_per_sec = 1000000; /*1 tick is 1 us*/
+    config.tid_get_cb = get_tid_cb;
+    lv_profiler_timeline_init(&config);
+
+    profiler_tick = 0;
+    output_buf = lv_malloc(OUTPUT_BUF_MAX);
+}
+
+void tearDown(void)
+{
+    lv_free(output_buf);
+
+    /*Restore the default profiler*/
+    lv_profiler_timeline_config_t config;
+    lv_profiler_timeline_config_init(&config);
+    lv_profiler_timeline_init(&config);
+
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_profiler_timeline_disabled_by_default(void)
+{
+    TEST_ASSERT_EQUAL_UINT64(0, lv_profiler_timeline_tick_get());
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(0, lv_profiler_timeline_get_event_count());
+
+    export_timeline();
+    TEST_ASSERT_EQUAL_STRING("{\"traceEvents\":[\n],\"displayTimeUnit\":\"ms\"}\n", output_buf);
+}
+
+void test_profiler_timeline_export(void)
+{
+    lv_profiler_timeline_set_enable(true);
+
+    uint64_t begin = lv_profiler_timeline_tick_get();
+    lv_area_t area = {10, 20, 109, 69};
+    lv_profiler_timeline_add(LV_PROFILER_TIMELINE_EVENT_DRAW_TASK, "SW", LV_DRAW_TASK_TYPE_FILL, &area, begin);
+
+    begin = lv_profiler_timeline_tick_get();
+    lv_profiler_timeline_add(LV_PROFILER_TIMELINE_EVENT_FLUSH_WAIT, NULL, 0, NULL, begin);
+
+    lv_profiler_timeline_set_enable(false);
+
+    TEST_ASSERT_EQUAL_UINT32(2, lv_profiler_timeline_get_event_count());
+
+    export_timeline();
+    TEST_ASSERT_EQUAL_STRING("{\"traceEvents\":[\n"
+                             "{\"name\":\"fill\",\"cat\":\"draw\",\"ph\":\"X\",\"pid\":1,\"tid\":7,"
+                             "\"ts\":1000.000,\"dur\":1000.000,\"args\":{\"unit\":\"SW\",\"x\":10,\"y\":20,\"w\":100,\"h\":50}},\n"
+                             "{\"name\":\"flush_wait\",\"cat\":\"refr\",\"ph\":\"X\",\"pid\":1,\"tid\":7,"
+                             "\"ts\":3000.000,\"dur\":1000.000,\"args\":{}}\n"
+                             "],\"displayTimeUnit\":\"ms\"}\n", output_buf);
+}
+
+void test_profiler_timeline_records_a_frame(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 100, 100);
+    lv_obj_set_style_opa_layered(obj, LV_OPA_50, 0);
+    lv_refr_now(NULL);
+
+    lv_profiler_timeline_set_enable(true);
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    lv_profiler_timeline_set_enable(false);
+
+    export_timeline();
+    TEST_ASSERT_NOT_NULL(strstr(output_buf, "\"name\":\"frame\""));
+    TEST_ASSERT_NOT_NULL(strstr(output_buf, "\"name\":\"flush_wait\""));
+    TEST_ASSERT_NOT_NULL(strstr(output_buf, "\"name\":\"fill\",\"cat\":\"draw\""));
+    TEST_ASSERT_NOT_NULL(strstr(output_buf, "\"unit\":\"SW\""));
+    TEST_ASSERT_NOT_NULL(strstr(output_buf, "\"name\":\"layer_alloc\""));
+    TEST_ASSERT_NOT_NULL(strstr(output_buf, "\"name\":\"layer\""));
+
+    /*Nothing is recorded after disabling*/
+    uint32_t cnt = lv_profiler_timeline_get_event_count();
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(cnt, lv_profiler_timeline_get_event_count());
+
+    lv_profiler_timeline_reset();
+    TEST_ASSERT_EQUAL_UINT32(0, lv_profiler_timeline_get_event_count());
+}
+
+void test_profiler_timeline_keeps_the_latest_events(void)
+{
+    lv_profiler_timeline_set_enable(true);
+
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_TIMELINE_EVENT_CNT + 10; i++) {
+        uint64_t begin = lv_profiler_timeline_tick_get();
+        lv_profiler_timeline_add(LV_PROFILER_TIMELINE_EVENT_FRAME, NULL, 0, NULL, begin);
+    }
+
+    lv_profiler_timeline_set_enable(false);
+
+    TEST_ASSERT_EQUAL_UINT32(LV_PROFILER_TIMELINE_EVENT_CNT, lv_profiler_timeline_get_event_count());
+
+    /*The first 10 events (2 ticks each) are overwritten*/
+    export_timeline();
+    const char * expected = "{\"traceEvents\":[\n"
+                            "{\"name\":\"frame\",\"cat\":\"refr\",\"ph\":\"X\",\"pid\":1,\"tid\":7,\"ts\":21000.000,";
+    TEST_ASSERT_EQUAL_STRING_LEN(expected, output_buf, lv_strlen(expected));
+}
+
+void test_profiler_timeline_default_clock_is_finer_than_tick(void)
+{
+    lv_profiler_timeline_config_t config;
+    lv_profiler_timeline_config_init(&config);
+#if defined(__unix__) || defined(__APPLE__)
+    TEST_ASSERT_EQUAL_UINT32(1000000000, config.tick_per_sec);
+#endif
+    lv_profiler_timeline_init(&config);
+    lv_profiler_timeline_set_enable(true);
+
+    /*Much less than 1 ms passes between the calls*/
+    uint64_t tick1 = lv_profiler_timeline_tick_get();
+    uint64_t tick2 = lv_profiler_timeline_tick_get();
+    TEST_ASSERT_GREATER_THAN_UINT64(tick1, tick2);
+    TEST_ASSERT_LESS_THAN_UINT64(config.tick_per_sec / 1000, tick2 - tick1);
+
+    lv_profiler_timeline_set_enable(false);
+}
+
+#if LV_USE_OS == LV_OS_PTHREAD
+void test_profiler_timeline_threads_without_tid_cb(void)
+{
+    lv_profiler_timeline_config_t config;
+    lv_profiler_timeline_config_init(&config);
+    config.tick_get_cb = get_tick_cb;
+    config.tick_per_sec = 1000000; /*1 tick is 1 us*/
+    lv_profiler_timeline_init(&config);
+    lv_profiler_timeline_set_enable(true);
+
+    uint64_t begin = lv_profiler_timeline_tick_get();
+    lv_profiler_timeline_add(LV_PROFILER_TIMELINE_EVENT_FRAME, "main", 0, NULL, begin);
+
+    lv_thread_t thread;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_thread_init(&thread, "timeline", LV_THREAD_PRIO_MID, add_event_thread_cb,
+                                                   LV_DRAW_THREAD_STACK_SIZE, NULL));
+    lv_thread_delete(&thread);
+
+    begin = lv_profiler_timeline_tick_get();
+    lv_profiler_timeline_add(LV_PROFILER_TIMELINE_EVENT_FRAME, "main", 0, NULL, begin);
+
+    lv_profiler_timeline_set_enable(false);
+
+    /*The thread got its own ring buffer*/
+    export_timeline();
+    TEST_ASSERT_EQUAL_STRING("{\"traceEvents\":[\n"
+                             "{\"name\":\"frame\",\"cat\":\"refr\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                             "\"ts\":1000.000,\"dur\":1000.000,\"args\":{\"name\":\"main\"}},\n"
+                             "{\"name\":\"frame\",\"cat\":\"refr\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                             "\"ts\":5000.000,\"dur\":1000.000,\"args\":{\"name\":\"main\"}},\n"
+                             "{\"name\":\"frame\",\"cat\":\"refr\",\"ph\":\"X\",\"pid\":1,\"tid\":2,"
+                             "\"ts\":3000.000,\"dur\":1000.000,\"args\":{\"name\":\"thread\"}}\n"
+                             "],\"displayTimeUnit\":\"ms\"}\n", output_buf);
+}
+#endif
+
+#endif
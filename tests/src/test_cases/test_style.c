@@ -249,4 +249,77 @@ void test_style_remove_theme(void)
     TEST_ASSERT_EQUAL(0, lv_obj_get_style_bg_opa(sw, LV_PART_KNOB));
 }
 
+
+#if LV_STYLE_PROP_INDEX
+const lv_style_const_prop_t const_sorted_style_props[] = {
+    LV_STYLE_CONST_WIDTH(51),
+    LV_STYLE_CONST_HEIGHT(50),
+    LV_STYLE_CONST_BORDER_WIDTH(3),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_50),
+    LV_STYLE_CONST_PROPS_END
+};
+
+LV_STYLE_CONST_INIT_SORTED(const_sorted_style, const_sorted_style_props);
+
+void test_style_prop_index(void)
+{
+    const lv_style_prop_t props[] = {LV_STYLE_TEXT_FONT, LV_STYLE_WIDTH, LV_STYLE_BG_OPA, LV_STYLE_HEIGHT, LV_STYLE_RADIUS};
+
+    lv_style_t style;
+    lv_style_init(&style);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(props) / sizeof(props[0]); i++) {
+        lv_style_value_t v = {.num = props[i] * 10};
+        lv_style_set_prop(&style, props[i], v);
+    }
+
+    /*Overwrite an existing property*/
+    lv_style_value_t v = {.num = 1234};
+    lv_style_set_prop(&style, LV_STYLE_BG_OPA, v);
+
+    TEST_ASSERT_EQUAL(5, style.prop_cnt);
+
+    /*The properties are sorted by ID*/
+    lv_style_prop_t * style_props = (lv_style_prop_t *)style.values_and_props + style.prop_cnt * sizeof(lv_style_value_t);
+    for(i = 1; i < style.prop_cnt; i++) {
+        TEST_ASSERT_LESS_THAN(style_props[i], style_props[i - 1]);
+    }
+
+    for(i = 0; i < sizeof(props) / sizeof(props[0]); i++) {
+        TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, props[i], &v));
+        TEST_ASSERT_EQUAL(props[i] == LV_STYLE_BG_OPA ? 1234 : props[i] * 10, v.num);
+    }
+
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style, LV_STYLE_BORDER_WIDTH, &v));
+
+    TEST_ASSERT_TRUE(lv_style_remove_prop(&style, LV_STYLE_HEIGHT));
+    TEST_ASSERT_FALSE(lv_style_remove_prop(&style, LV_STYLE_HEIGHT));
+    TEST_ASSERT_EQUAL(4, style.prop_cnt);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style, LV_STYLE_HEIGHT, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_TEXT_FONT, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_TEXT_FONT * 10, v.num);
+
+    lv_style_reset(&style);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style, LV_STYLE_WIDTH, &v));
+}
+
+void test_const_style_sorted(void)
+{
+    TEST_ASSERT_EQUAL(4, const_sorted_style.const_sorted_cnt);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &const_sorted_style, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(51, lv_obj_get_style_width(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(50, lv_obj_get_style_height(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_border_width(obj, LV_PART_MAIN));
+
+    lv_style_value_t v;
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&const_sorted_style, LV_STYLE_RADIUS, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&const_sorted_style, LV_STYLE_PROP_INV, &v));
+    lv_obj_delete(obj);
+}
+#endif
+
 #endif
@@ -0,0 +1,214 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define RUN_LOG_MAX 16
+
+static uint32_t run_log[RUN_LOG_MAX];
+static uint32_t run_cnt;
+static lv_timer_t * timer_to_delete;
+
+static void log_timer_cb(lv_timer_t * t)
+{
+    if(run_cnt < RUN_LOG_MAX) run_log[run_cnt] = (uint32_t)(lv_uintptr_t)lv_timer_get_user_data(t);
+    run_cnt++;
+}
+
+static void delete_other_timer_cb(lv_timer_t * t)
+{
+    log_timer_cb(t);
+    if(timer_to_delete) {
+        lv_timer_delete(timer_to_delete);
+        timer_to_delete = NULL;
+    }
+}
+
+static void delete_self_cb(lv_timer_t * t)
+{
+    log_timer_cb(t);
+    lv_timer_delete(t);
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(t == timer) return true;
+        t = lv_timer_get_next(t);
+    }
+    return false;
+}
+
+/*Calculate the time until the next timer the same way as the list based scheduler did*/
+static uint32_t time_until_next_by_list(void)
+{
+    uint32_t time_until_next = LV_NO_TIMER_READY;
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(!t->paused) {
+            uint32_t elp = lv_tick_elaps(t->last_run);
+            uint32_t delay = elp >= t->period ? 0 : t->period - elp;
+            if(delay < time_until_next) time_until_next = delay;
+        }
+        t = lv_timer_get_next(t);
+    }
+    return time_until_next;
+}
+
+void setUp(void)
+{
+    run_cnt = 0;
+    timer_to_delete = NULL;
+    lv_memzero(run_log, sizeof(run_log));
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_timer_runs_in_deadline_order(void)
+{
+    lv_timer_t * t1 = lv_timer_create(log_timer_cb, 1030, (void *)1);
+    lv_timer_t * t2 = lv_timer_create(log_timer_cb, 1010, (void *)2);
+    lv_timer_t * t3 = lv_timer_create(log_timer_cb, 1020, (void *)3);
+
+    lv_tick_inc(1000);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt);
+
+    lv_tick_inc(40);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, run_log[0]);
+    TEST_ASSERT_EQUAL_UINT32(3, run_log[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_log[2]);
+
+    /*They are not ready again*/
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+    lv_timer_delete(t3);
+}
+
+void test_timer_same_deadline_runs_newer_first(void)
+{
+    lv_timer_t * t1 = lv_timer_create(log_timer_cb, 1000, (void *)1);
+    lv_timer_t * t2 = lv_timer_create(log_timer_cb, 1000, (void *)2);
+
+    lv_tick_inc(1000);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, run_log[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_log[1]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+}
+
+void test_timer_pause_resume_ready(void)
+{
+    lv_timer_t * t = lv_timer_create(log_timer_cb, 1000, (void *)1);
+    lv_timer_pause(t);
+
+    lv_tick_inc(2000);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt);
+    TEST_ASSERT_EQUAL_UINT32(time_until_next_by_list(), lv_timer_get_time_until_next());
+
+    /*It's over its period so it runs right after resuming*/
+    lv_timer_resume(t);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+
+    lv_timer_set_period(t, 5000);
+    lv_tick_inc(1000);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+
+    lv_timer_ready(t);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+
+    lv_timer_delete(t);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t1 = lv_timer_create(log_timer_cb, 1000, (void *)1);
+    lv_timer_set_repeat_count(t1, 2);
+    lv_timer_t * t2 = lv_timer_create(log_timer_cb, 1000, (void *)2);
+    lv_timer_set_repeat_count(t2, 1);
+    lv_timer_set_auto_delete(t2, false);
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_tick_inc(1000);
+        lv_timer_handler();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt);
+    TEST_ASSERT_FALSE(timer_exists(t1));
+    TEST_ASSERT_TRUE(timer_exists(t2));
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t2));
+
+    /*Setting 0 repeat count deletes the timer in the next call*/
+    lv_timer_set_auto_delete(t2, true);
+    lv_timer_resume(t2);
+    lv_timer_set_repeat_count(t2, 0);
+    lv_timer_handler();
+    TEST_ASSERT_FALSE(timer_exists(t2));
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt);
+}
+
+void test_timer_delete_in_callback(void)
+{
+    lv_timer_t * t1 = lv_timer_create(delete_other_timer_cb, 1000, (void *)1);
+    timer_to_delete = lv_timer_create(log_timer_cb, 1500, (void *)2);
+    lv_timer_create(delete_self_cb, 1200, (void *)3);
+
+    lv_tick_inc(2000);
+    lv_timer_handler();
+
+    /*The second timer was deleted before it could run*/
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, run_log[0]);
+    TEST_ASSERT_EQUAL_UINT32(3, run_log[1]);
+    TEST_ASSERT_NULL(timer_to_delete);
+
+    lv_timer_delete(t1);
+}
+
+void test_timer_many_timers(void)
+{
+    lv_timer_t * timers[300];
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        timers[i] = lv_timer_create(log_timer_cb, 1000 + (i * 7919) % 1000, (void *)100);
+        if(i % 3 == 0) lv_timer_pause(timers[i]);
+    }
+
+    for(i = 0; i < 100; i++) {
+        lv_tick_inc(37);
+        uint32_t time_until_next = lv_timer_handler();
+        TEST_ASSERT_EQUAL_UINT32(time_until_next_by_list(), time_until_next);
+
+        if(i % 5 == 0) lv_timer_resume(timers[i * 3]);
+        if(i % 7 == 0) lv_timer_delete(timers[i * 3 + 1]);
+        if(i % 9 == 0) lv_timer_set_period(timers[i * 3 + 2], 100);
+    }
+
+    /*The 200 not paused timers ran at least once*/
+    TEST_ASSERT_GREATER_THAN_UINT32(200, run_cnt);
+
+    for(i = 0; i < 300; i++) {
+        if(i % 3 == 1 && (i / 3) % 7 == 0) continue;
+        lv_timer_delete(timers[i]);
+    }
+}
+
+#endif
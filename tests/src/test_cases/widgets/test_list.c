@@ -5,6 +5,25 @@
 #include "unity/unity.h"
 
 static lv_obj_t * list;
+static uint32_t row_cb_cnt;
+
+static void virtual_row_cb(lv_obj_t * l, lv_obj_t * btn, uint32_t row_id)
+{
+    row_cb_cnt++;
+    char buf[32];
+    lv_snprintf(buf, sizeof(buf), "Row %" LV_PRIu32, row_id);
+    lv_list_set_button_text(l, btn, buf);
+}
+
+static lv_obj_t * find_row_button(uint32_t row_id)
+{
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(list); i++) {
+        lv_obj_t * btn = lv_obj_get_child(list, i);
+        if(lv_list_get_virtual_row_id(list, btn) == (int32_t)row_id) return btn;
+    }
+    return NULL;
+}
 
 void setUp(void)
 {
@@ -120,4 +139,78 @@ void test_list_translation_tag(void)
 
 }
 
+void test_list_virtual(void)
+{
+    lv_obj_set_size(list, 200, 200);
+    lv_obj_set_style_pad_all(list, 0, 0);
+    lv_obj_set_style_pad_row(list, 10, 0);
+    lv_obj_set_style_border_width(list, 0, 0);
+    lv_obj_update_layout(list);
+
+    row_cb_cnt = 0;
+    lv_list_set_virtual(list, 100000, 30, virtual_row_cb);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL_UINT32(100000, lv_list_get_virtual_row_count(list));
+
+    /*Buttons for the visible rows and the margin around them, but only 5 + 1 + 2 rows are shown*/
+    uint32_t btn_cnt = lv_obj_get_child_count(list);
+    TEST_ASSERT_EQUAL_UINT32(11, btn_cnt);
+    TEST_ASSERT_EQUAL_UINT32(8, row_cb_cnt);
+    TEST_ASSERT_EQUAL_STRING("Row 4", lv_list_get_button_text(list, find_row_button(4)));
+    TEST_ASSERT_EQUAL_INT32(160, lv_obj_get_y(find_row_button(4)));
+
+    /*Scroll as if all the rows existed*/
+    TEST_ASSERT_EQUAL_INT32(100000 * 40 - 10 - 200, lv_obj_get_scroll_bottom(list));
+
+    /*Only the buttons of the rows scrolled out are reused*/
+    row_cb_cnt = 0;
+    lv_obj_scroll_to_y(list, 80, LV_ANIM_OFF);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL_UINT32(2, row_cb_cnt);
+    TEST_ASSERT_NOT_NULL(find_row_button(9));
+    TEST_ASSERT_EQUAL_INT32(9 * 40 - 80, lv_obj_get_y(find_row_button(9)) - lv_obj_get_scroll_y(list));
+
+    lv_obj_scroll_to_y(list, 50000 * 40, LV_ANIM_OFF);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL_UINT32(btn_cnt, lv_obj_get_child_count(list));
+    TEST_ASSERT_NULL(find_row_button(9));
+    lv_obj_t * btn = find_row_button(50002);
+    TEST_ASSERT_EQUAL_STRING("Row 50002", lv_list_get_button_text(list, btn));
+
+    lv_area_t btn_coords;
+    lv_obj_get_coords(btn, &btn_coords);
+    TEST_ASSERT_EQUAL_INT32(list->coords.y1 + 80, btn_coords.y1);
+
+    /*Less rows*/
+    lv_list_set_virtual_row_count(list, 3);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_y(list));
+    TEST_ASSERT_NOT_NULL(find_row_button(2));
+    TEST_ASSERT_NULL(find_row_button(3));
+
+    row_cb_cnt = 0;
+    lv_list_refresh_virtual_rows(list);
+    TEST_ASSERT_EQUAL_UINT32(3, row_cb_cnt);
+
+    /*Normal list again*/
+    lv_list_set_virtual(list, 0, 0, NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_child_count(list));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_list_get_virtual_row_count(list));
+}
+
+void test_list_virtual_delete(void)
+{
+    lv_list_set_virtual(list, 1000, 30, virtual_row_cb);
+    lv_obj_update_layout(list);
+
+    /*A deleted button is recreated*/
+    uint32_t btn_cnt = lv_obj_get_child_count(list);
+    lv_obj_delete(find_row_button(1));
+    lv_list_refresh_virtual_rows(list);
+    TEST_ASSERT_EQUAL_UINT32(btn_cnt, lv_obj_get_child_count(list));
+    TEST_ASSERT_NOT_NULL(find_row_button(1));
+
+    lv_obj_delete(list);
+}
+
 #endif
@@ -383,4 +383,97 @@ void test_table_properties(void)
 #endif
 }
 
+static uint32_t virtual_cell_cnt;
+static uint32_t virtual_row_min;
+static uint32_t virtual_row_max;
+
+static const char * virtual_cell_cb(lv_obj_t * t, uint32_t row, uint32_t col)
+{
+    LV_UNUSED(t);
+    static char buf[32];
+    virtual_cell_cnt++;
+    virtual_row_min = LV_MIN(virtual_row_min, row);
+    virtual_row_max = LV_MAX(virtual_row_max, row);
+    lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32 ".%" LV_PRIu32, row, col);
+    return buf;
+}
+
+static void virtual_cell_stat_reset(void)
+{
+    virtual_cell_cnt = 0;
+    virtual_row_min = UINT32_MAX;
+    virtual_row_max = 0;
+}
+
+void test_table_virtual(void)
+{
+    lv_obj_set_size(table, 300, 200);
+    lv_obj_set_style_pad_all(table, 0, 0);
+    lv_obj_set_style_border_width(table, 0, 0);
+    lv_table_set_column_count(table, 2);
+    lv_table_set_cell_value(table, 0, 0, "stored");
+
+    lv_table_set_virtual(table, 100000, 40, virtual_cell_cb);
+    TEST_ASSERT_TRUE(lv_table_is_virtual(table));
+    TEST_ASSERT_EQUAL_UINT32(100000, lv_table_get_row_count(table));
+    TEST_ASSERT_EQUAL_UINT32(2, lv_table_get_column_count(table));
+
+    /*Nothing is stored for the rows*/
+    TEST_ASSERT_NULL(((lv_table_t *)table)->cell_data);
+    TEST_ASSERT_NULL(((lv_table_t *)table)->row_h);
+
+    /*Scroll as if all the rows existed. As on normal tables the self size is the sum of the rows - 1.*/
+    lv_obj_update_layout(table);
+    TEST_ASSERT_EQUAL_INT32(100000 * 40 - 1, lv_obj_get_self_height(table));
+    TEST_ASSERT_EQUAL_INT32(100000 * 40 - 1 - 200, lv_obj_get_scroll_bottom(table));
+
+    /*Only the visible cells are queried*/
+    virtual_cell_stat_reset();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(5 * 2, virtual_cell_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, virtual_row_min);
+    TEST_ASSERT_EQUAL_UINT32(4, virtual_row_max);
+
+    lv_obj_scroll_to_y(table, 50000 * 40 + 20, LV_ANIM_OFF);
+    virtual_cell_stat_reset();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(6 * 2, virtual_cell_cnt);
+    TEST_ASSERT_EQUAL_UINT32(50000, virtual_row_min);
+    TEST_ASSERT_EQUAL_UINT32(50005, virtual_row_max);
+
+    TEST_ASSERT_EQUAL_STRING("70000.1", lv_table_get_cell_value(table, 70000, 1));
+
+    /*Rows above 0xFFFF can be selected too*/
+    uint32_t selected_row;
+    uint32_t selected_col;
+    lv_table_set_selected_cell(table, 0xFFFF, 1);
+    lv_table_get_selected_cell(table, &selected_row, &selected_col);
+    TEST_ASSERT_EQUAL_UINT32(0xFFFF, selected_row);
+    TEST_ASSERT_EQUAL_UINT32(1, selected_col);
+    lv_table_set_selected_cell(table, 70000, 0);
+    lv_table_get_selected_cell(table, &selected_row, &selected_col);
+    TEST_ASSERT_EQUAL_UINT32(70000, selected_row);
+    TEST_ASSERT_EQUAL_UINT32(0, selected_col);
+
+    /*The cells can't be set*/
+    lv_table_set_cell_value(table, 0, 0, "x");
+    lv_table_set_cell_ctrl(table, 0, 0, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
+    TEST_ASSERT_EQUAL_STRING("0.0", lv_table_get_cell_value(table, 0, 0));
+    TEST_ASSERT_FALSE(lv_table_has_cell_ctrl(table, 0, 0, LV_TABLE_CELL_CTRL_MERGE_RIGHT));
+
+    /*Less rows*/
+    lv_table_set_row_count(table, 3);
+    lv_obj_update_layout(table);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_y(table));
+    TEST_ASSERT_EQUAL_INT32(3 * 40 - 1, lv_obj_get_self_height(table));
+
+    /*Normal table again*/
+    lv_table_set_virtual(table, 2, 0, NULL);
+    TEST_ASSERT_FALSE(lv_table_is_virtual(table));
+    TEST_ASSERT_EQUAL_UINT32(2, lv_table_get_row_count(table));
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 0, 0));
+    lv_table_set_cell_value(table, 1, 1, "normal");
+    TEST_ASSERT_EQUAL_STRING("normal", lv_table_get_cell_value(table, 1, 1));
+}
+
 #endif